@@ -0,0 +1,1799 @@
+// the factory wave library - made by tools/wav2tb2.py from harmonic recipes (--additive), don't edit
+// 64 single cycle waves of 600 unsigned 8 bit samples, 128 is silence
+#define FACTORY_WAVES 64
+const char factoryWaveNames[FACTORY_WAVES][9] = {
+    "SAW 2",
+    "SAW 3",
+    "SAW 4",
+    "SAW 6",
+    "SAW 8",
+    "SAW 12",
+    "SAW 16",
+    "SAW 24",
+    "SQR 3",
+    "SQR 5",
+    "SQR 7",
+    "SQR 9",
+    "SQR 13",
+    "SQR 17",
+    "SQR 25",
+    "SQR 33",
+    "PUL 5",
+    "PUL 10",
+    "PUL 15",
+    "PUL 20",
+    "PUL 25",
+    "PUL 30",
+    "PUL 35",
+    "PUL 40",
+    "ORGAN 1",
+    "ORGAN 2",
+    "ORGAN 3",
+    "ORGAN 4",
+    "ORGAN 5",
+    "ORGAN 6",
+    "ORGAN 7",
+    "ORGAN 8",
+    "FORM 2",
+    "FORM 3",
+    "FORM 4",
+    "FORM 6",
+    "FORM 8",
+    "FORM 10",
+    "FORM 12",
+    "FORM 16",
+    "SYNC 1.5",
+    "SYNC 2",
+    "SYNC 2.5",
+    "SYNC 3",
+    "SYNC 3.5",
+    "SYNC 4",
+    "SYNC 5",
+    "SYNC 6",
+    "FM 1 1",
+    "FM 1 3",
+    "FM 2 1",
+    "FM 2 3",
+    "FM 3 2",
+    "FM 4 2",
+    "FM 5 1.5",
+    "FM 7 1",
+    "FOLD 1.5",
+    "FOLD 2",
+    "FOLD 3",
+    "FOLD 4",
+    "FOLD 5",
+    "FOLD 6",
+    "FOLD 8",
+    "FOLD 10",
+};
+const uint8_t factoryWaves[FACTORY_WAVES][600] = {
+    {// SAW 2
+     128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,
+     176,178,180,181,183,185,187,189,191,192,194,196,197,199,201,202,204,206,207,209,210,212,213,215,
+     216,218,219,221,222,223,225,226,227,228,230,231,232,233,234,235,236,237,238,239,240,241,242,243,
+     244,245,245,246,247,247,248,249,249,250,250,251,251,252,252,253,253,253,254,254,254,254,254,255,
+     255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,253,252,252,252,251,251,250,
+     250,249,249,248,247,247,246,246,245,244,244,243,242,241,240,240,239,238,237,236,235,234,234,233,
+     232,231,230,229,228,227,226,225,224,223,222,221,219,218,217,216,215,214,213,212,211,209,208,207,
+     206,205,204,203,201,200,199,198,197,196,195,193,192,191,190,189,188,187,185,184,183,182,181,180,
+     179,178,177,176,174,173,172,171,170,169,168,167,166,165,164,163,162,162,161,160,159,158,157,156,
+     155,154,154,153,152,151,150,150,149,148,148,147,146,145,145,144,144,143,142,142,141,141,140,139,
+     139,138,138,138,137,137,136,136,135,135,135,134,134,133,133,133,133,132,132,132,131,131,131,131,
+     131,130,130,130,130,130,129,129,129,129,129,129,129,129,129,129,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,127,127,126,126,126,126,126,
+     125,125,125,125,125,124,124,124,123,123,123,123,122,122,121,121,121,120,120,119,119,118,118,118,
+     117,117,116,115,115,114,114,113,112,112,111,111,110,109,108,108,107,106,106,105,104,103,102,102,
+     101,100,99,98,97,96,95,94,94,93,92,91,90,89,88,87,86,85,84,83,82,80,79,78,
+     77,76,75,74,73,72,71,69,68,67,66,65,64,63,61,60,59,58,57,56,55,53,52,51,
+     50,49,48,47,45,44,43,42,41,40,39,38,37,35,34,33,32,31,30,29,28,27,26,25,
+     24,23,22,22,21,20,19,18,17,16,16,15,14,13,12,12,11,10,10,9,9,8,7,7,
+     6,6,5,5,4,4,4,3,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+     1,1,2,2,2,2,2,3,3,3,4,4,5,5,6,6,7,7,8,9,9,10,11,11,
+     12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,28,29,30,31,33,34,35,37,38,
+     40,41,43,44,46,47,49,50,52,54,55,57,59,60,62,64,65,67,69,71,73,75,76,78,
+     80,82,84,86,88,90,92,94,96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,
+    },
+    {// SAW 3
+     128,131,134,136,139,142,145,147,150,153,155,158,161,163,166,169,171,174,176,179,181,184,186,189,
+     191,194,196,198,200,203,205,207,209,211,213,215,217,219,221,223,224,226,228,229,231,233,234,235,
+     237,238,239,241,242,243,244,245,246,247,248,249,250,250,251,252,252,253,253,253,254,254,254,255,
+     255,255,255,255,255,255,255,255,254,254,254,254,253,253,252,252,251,251,250,249,249,248,247,247,
+     246,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,229,227,226,225,224,223,222,
+     220,219,218,217,215,214,213,212,211,209,208,207,206,205,204,202,201,200,199,198,197,196,195,194,
+     193,192,191,190,189,188,187,186,185,184,183,182,182,181,180,179,178,178,177,176,176,175,175,174,
+     173,173,172,172,172,171,171,170,170,170,169,169,169,168,168,168,168,167,167,167,167,167,167,167,
+     166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,166,167,167,167,167,
+     167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,167,166,166,166,166,166,
+     166,166,165,165,165,165,164,164,164,164,163,163,163,162,162,161,161,160,160,160,159,158,158,157,
+     157,156,156,155,154,154,153,152,152,151,150,150,149,148,147,146,146,145,144,143,142,141,141,140,
+     139,138,137,136,135,134,134,133,132,131,130,129,128,127,126,125,124,123,122,122,121,120,119,118,
+     117,116,115,115,114,113,112,111,110,110,109,108,107,106,106,105,104,104,103,102,102,101,100,100,
+     99,99,98,98,97,96,96,96,95,95,94,94,93,93,93,92,92,92,92,91,91,91,91,90,
+     90,90,90,90,90,90,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,89,
+     89,89,89,89,89,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,90,
+     90,89,89,89,89,89,89,89,88,88,88,88,87,87,87,86,86,86,85,85,84,84,84,83,
+     83,82,81,81,80,80,79,78,78,77,76,75,74,74,73,72,71,70,69,68,67,66,65,64,
+     63,62,61,60,59,58,57,56,55,54,52,51,50,49,48,47,45,44,43,42,41,39,38,37,
+     36,34,33,32,31,30,29,27,26,25,24,23,22,21,20,19,18,17,16,15,14,13,12,11,
+     10,9,9,8,7,7,6,5,5,4,4,3,3,2,2,2,2,1,1,1,1,1,1,1,
+     1,1,2,2,2,3,3,3,4,4,5,6,6,7,8,9,10,11,12,13,14,15,17,18,
+     19,21,22,23,25,27,28,30,32,33,35,37,39,41,43,45,47,49,51,53,56,58,60,62,
+     65,67,70,72,75,77,80,82,85,87,90,93,95,98,101,103,106,109,111,114,117,120,122,125,
+    },
+    {// SAW 4
+     128,131,135,138,142,145,149,152,156,159,162,166,169,172,175,179,182,185,188,191,194,197,200,202,
+     205,208,211,213,216,218,220,223,225,227,229,231,233,235,236,238,240,241,243,244,245,247,248,249,
+     250,251,251,252,253,253,254,254,254,255,255,255,255,255,255,255,254,254,254,253,253,252,252,251,
+     250,250,249,248,247,246,245,244,243,242,241,240,239,237,236,235,234,232,231,230,229,227,226,225,
+     223,222,221,219,218,217,215,214,213,212,210,209,208,207,206,204,203,202,201,200,199,198,197,196,
+     195,195,194,193,192,192,191,190,190,189,188,188,187,187,186,186,186,185,185,185,185,184,184,184,
+     184,184,184,184,183,183,183,183,183,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,
+     185,185,185,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,186,185,185,185,
+     185,184,184,184,184,183,183,182,182,182,181,181,180,180,179,178,178,177,177,176,175,174,174,173,
+     172,171,171,170,169,168,167,167,166,165,164,163,162,161,160,159,159,158,157,156,155,154,153,152,
+     151,151,150,149,148,147,146,146,145,144,143,143,142,141,140,140,139,138,138,137,137,136,136,135,
+     134,134,134,133,133,132,132,132,131,131,131,130,130,130,130,129,129,129,129,129,129,129,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,127,127,127,127,127,127,127,126,126,126,126,125,125,125,124,124,124,123,123,122,122,
+     122,121,120,120,119,119,118,118,117,116,116,115,114,113,113,112,111,110,110,109,108,107,106,105,
+     105,104,103,102,101,100,99,98,97,97,96,95,94,93,92,91,90,89,89,88,87,86,85,85,
+     84,83,82,82,81,80,79,79,78,78,77,76,76,75,75,74,74,74,73,73,72,72,72,72,
+     71,71,71,71,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,71,71,
+     71,71,71,71,71,71,72,72,72,72,72,72,72,72,72,72,73,73,73,73,73,72,72,72,
+     72,72,72,72,71,71,71,71,70,70,70,69,69,68,68,67,66,66,65,64,64,63,62,61,
+     61,60,59,58,57,56,55,54,53,52,50,49,48,47,46,44,43,42,41,39,38,37,35,34,
+     33,31,30,29,27,26,25,24,22,21,20,19,17,16,15,14,13,12,11,10,9,8,7,6,
+     6,5,4,4,3,3,2,2,2,1,1,1,1,1,1,1,2,2,2,3,3,4,5,5,
+     6,7,8,9,11,12,13,15,16,18,20,21,23,25,27,29,31,33,36,38,40,43,45,48,
+     51,54,56,59,62,65,68,71,74,77,81,84,87,90,94,97,100,104,107,111,114,118,121,125,
+    },
+    {// SAW 6
+     128,133,138,143,148,152,157,162,167,171,176,180,185,189,193,197,201,205,209,213,216,219,223,226,
+     229,231,234,237,239,241,243,245,247,248,249,251,252,253,253,254,254,255,255,255,255,255,254,254,
+     253,253,252,251,250,249,248,247,245,244,243,241,240,238,237,235,234,232,231,229,227,226,224,223,
+     221,220,218,217,215,214,213,212,210,209,208,207,206,205,205,204,203,202,202,201,201,200,200,200,
+     200,199,199,199,199,199,199,199,200,200,200,200,200,201,201,201,202,202,202,202,203,203,203,204,
+     204,204,204,205,205,205,205,205,205,205,205,205,205,205,205,204,204,204,203,203,202,202,201,201,
+     200,200,199,198,197,197,196,195,194,193,192,191,191,190,189,188,187,186,185,184,183,182,181,180,
+     179,178,178,177,176,175,174,174,173,172,172,171,170,170,169,169,168,168,168,167,167,167,166,166,
+     166,166,166,166,165,165,165,165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,166,
+     166,166,166,166,166,165,165,165,165,165,164,164,164,163,163,163,162,162,161,161,160,160,159,158,
+     158,157,156,156,155,154,153,153,152,151,150,149,149,148,147,146,145,144,144,143,142,141,140,140,
+     139,138,138,137,136,136,135,134,134,133,133,132,132,131,131,131,130,130,130,129,129,129,129,129,
+     129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     127,127,127,127,127,127,126,126,126,125,125,125,124,124,123,123,122,122,121,120,120,119,118,118,
+     117,116,116,115,114,113,112,112,111,110,109,108,107,107,106,105,104,103,103,102,101,100,100,99,
+     98,98,97,96,96,95,95,94,94,93,93,93,92,92,92,91,91,91,91,91,90,90,90,90,
+     90,90,90,90,90,90,90,90,90,90,91,91,91,91,91,91,91,91,91,91,91,90,90,90,
+     90,90,90,89,89,89,88,88,88,87,87,86,86,85,84,84,83,82,82,81,80,79,78,78,
+     77,76,75,74,73,72,71,70,69,68,67,66,65,65,64,63,62,61,60,59,59,58,57,56,
+     56,55,55,54,54,53,53,52,52,52,51,51,51,51,51,51,51,51,51,51,51,51,52,52,
+     52,52,53,53,53,54,54,54,54,55,55,55,56,56,56,56,56,57,57,57,57,57,57,57,
+     56,56,56,56,55,55,54,54,53,52,51,51,50,49,48,47,46,44,43,42,41,39,38,36,
+     35,33,32,30,29,27,25,24,22,21,19,18,16,15,13,12,11,9,8,7,6,5,4,3,
+     3,2,2,1,1,1,1,1,2,2,3,3,4,5,7,8,9,11,13,15,17,19,22,25,
+     27,30,33,37,40,43,47,51,55,59,63,67,71,76,80,85,89,94,99,104,108,113,118,123,
+    },
+    {// SAW 8
+     128,134,141,147,153,159,165,171,177,183,189,194,199,204,209,214,218,222,226,230,234,237,240,242,
+     245,247,249,250,252,253,254,254,255,255,255,255,254,254,253,252,251,250,248,247,245,244,242,240,
+     238,236,234,233,231,229,227,225,223,222,220,219,217,216,214,213,212,211,210,209,209,208,208,207,
+     207,207,206,206,206,207,207,207,207,208,208,208,209,209,210,210,211,211,212,212,213,213,214,214,
+     214,214,214,215,215,215,214,214,214,214,213,213,212,212,211,211,210,209,208,207,206,205,204,203,
+     202,201,200,199,198,197,196,195,194,193,192,191,190,190,189,188,187,187,186,186,185,185,184,184,
+     184,183,183,183,183,183,183,183,183,183,183,183,183,184,184,184,184,184,184,184,184,184,184,184,
+     184,184,184,184,184,184,183,183,183,182,182,181,181,180,180,179,178,178,177,176,175,175,174,173,
+     172,171,170,169,169,168,167,166,165,165,164,163,162,162,161,160,160,159,159,158,158,158,157,157,
+     157,157,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,156,
+     156,155,155,155,155,154,154,154,153,153,152,152,151,151,150,149,149,148,147,147,146,145,144,143,
+     143,142,141,140,139,139,138,137,136,136,135,134,134,133,133,132,132,131,131,130,130,130,129,129,
+     129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,
+     127,127,127,126,126,126,125,125,124,124,123,123,122,122,121,120,120,119,118,117,117,116,115,114,
+     113,113,112,111,110,109,109,108,107,107,106,105,105,104,104,103,103,102,102,102,101,101,101,101,
+     100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,100,99,
+     99,99,99,98,98,98,97,97,96,96,95,94,94,93,92,91,91,90,89,88,87,87,86,85,
+     84,83,82,81,81,80,79,78,78,77,76,76,75,75,74,74,73,73,73,72,72,72,72,72,
+     72,72,72,72,72,72,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,73,73,73,
+     72,72,72,71,71,70,70,69,69,68,67,66,66,65,64,63,62,61,60,59,58,57,56,55,
+     54,53,52,51,50,49,48,47,46,45,45,44,44,43,43,42,42,42,42,41,41,41,42,42,
+     42,42,42,43,43,44,44,45,45,46,46,47,47,48,48,48,49,49,49,49,50,50,50,49,
+     49,49,48,48,47,47,46,45,44,43,42,40,39,37,36,34,33,31,29,27,25,23,22,20,
+     18,16,14,12,11,9,8,6,5,4,3,2,2,1,1,1,1,2,2,3,4,6,7,9,
+     11,14,16,19,22,26,30,34,38,42,47,52,57,62,67,73,79,85,91,97,103,109,115,122,
+    },
+    {// SAW 12
+     128,137,146,155,164,173,181,190,197,205,212,218,224,230,234,239,243,246,249,251,253,254,255,255,
+     255,254,253,252,250,249,247,244,242,240,237,235,232,230,228,225,223,221,220,218,217,216,215,214,
+     214,213,213,213,214,214,214,215,216,217,217,218,219,220,221,222,222,223,223,224,224,224,224,224,
+     223,223,222,222,221,220,219,218,217,215,214,213,212,210,209,208,207,206,205,204,203,202,201,201,
+     200,200,200,200,200,200,200,200,200,201,201,201,201,202,202,202,203,203,203,203,203,203,203,203,
+     202,202,201,201,200,199,198,198,197,196,195,194,193,192,191,190,189,188,187,187,186,185,185,184,
+     184,183,183,183,183,183,183,183,183,183,183,183,183,183,183,184,184,184,184,184,184,183,183,183,
+     183,182,182,181,181,180,179,178,178,177,176,175,174,173,173,172,171,170,169,169,168,167,167,166,
+     166,166,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,165,164,164,164,
+     164,163,163,162,162,161,160,160,159,158,157,157,156,155,154,153,153,152,151,151,150,149,149,148,
+     148,148,147,147,147,147,147,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,145,145,
+     145,144,144,143,143,142,142,141,140,140,139,138,137,136,136,135,134,134,133,132,132,131,131,130,
+     130,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,
+     126,126,125,125,124,124,123,122,122,121,120,120,119,118,117,116,116,115,114,114,113,113,112,112,
+     111,111,111,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,109,109,109,109,109,108,
+     108,108,107,107,106,105,105,104,103,103,102,101,100,99,99,98,97,96,96,95,94,94,93,93,
+     92,92,92,92,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,90,
+     90,90,89,89,88,87,87,86,85,84,83,83,82,81,80,79,78,78,77,76,75,75,74,74,
+     73,73,73,73,72,72,72,72,72,72,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+     72,72,71,71,70,69,69,68,67,66,65,64,63,62,61,60,59,58,58,57,56,55,55,54,
+     54,53,53,53,53,53,53,53,53,54,54,54,55,55,55,55,56,56,56,56,56,56,56,56,
+     56,55,55,54,53,52,51,50,49,48,47,46,44,43,42,41,39,38,37,36,35,34,34,33,
+     33,32,32,32,32,32,33,33,34,34,35,36,37,38,39,39,40,41,42,42,42,43,43,43,
+     42,42,41,40,39,38,36,35,33,31,28,26,24,21,19,16,14,12,9,7,6,4,3,2,
+     1,1,1,2,3,5,7,10,13,17,22,26,32,38,44,51,59,66,75,83,92,101,110,119,
+    },
+    {// SAW 16
+     128,140,152,164,175,186,196,206,215,223,230,236,242,246,250,252,254,255,255,254,253,251,249,247,
+     244,241,238,235,232,229,226,224,222,220,219,217,217,216,216,217,217,218,219,220,221,223,224,225,
+     226,227,228,228,229,229,229,228,228,227,226,225,223,222,220,219,217,216,214,213,212,211,210,209,
+     208,208,208,208,208,208,208,209,209,210,210,211,211,212,212,212,212,212,212,212,211,211,210,209,
+     208,207,206,205,204,203,202,201,200,199,198,197,197,196,196,196,196,196,196,196,196,196,197,197,
+     197,197,197,198,198,197,197,197,197,196,195,195,194,193,192,191,190,189,188,188,187,186,185,185,
+     184,183,183,183,183,183,182,183,183,183,183,183,183,183,183,183,183,183,183,183,182,182,181,181,
+     180,179,179,178,177,176,175,174,173,173,172,171,171,170,170,170,169,169,169,169,169,169,169,169,
+     169,169,169,169,169,169,169,169,168,168,167,167,166,166,165,164,163,162,162,161,160,159,159,158,
+     158,157,157,156,156,156,156,156,155,155,155,155,156,156,156,155,155,155,155,155,155,154,154,153,
+     153,152,151,151,150,149,148,147,147,146,145,145,144,144,143,143,142,142,142,142,142,142,142,142,
+     142,142,142,142,142,141,141,141,141,140,140,139,139,138,138,137,136,136,135,134,133,133,132,131,
+     131,130,130,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,126,126,
+     125,125,124,123,123,122,121,120,120,119,118,118,117,117,116,116,115,115,115,115,114,114,114,114,
+     114,114,114,114,114,114,114,114,114,113,113,112,112,111,111,110,109,109,108,107,106,105,105,104,
+     103,103,102,102,101,101,101,101,101,101,100,100,100,101,101,101,101,100,100,100,100,100,99,99,
+     98,98,97,97,96,95,94,94,93,92,91,90,90,89,89,88,88,87,87,87,87,87,87,87,
+     87,87,87,87,87,87,87,87,87,86,86,86,85,85,84,83,83,82,81,80,79,78,77,77,
+     76,75,75,74,74,73,73,73,73,73,73,73,73,73,73,73,73,73,74,73,73,73,73,73,
+     72,71,71,70,69,68,68,67,66,65,64,63,62,61,61,60,59,59,59,59,58,58,59,59,
+     59,59,59,60,60,60,60,60,60,60,60,60,59,59,58,57,56,55,54,53,52,51,50,49,
+     48,47,46,45,45,44,44,44,44,44,44,44,45,45,46,46,47,47,48,48,48,48,48,48,
+     48,47,46,45,44,43,42,40,39,37,36,34,33,31,30,29,28,28,27,27,27,28,28,29,
+     30,31,32,33,35,36,37,38,39,39,40,40,39,39,37,36,34,32,30,27,24,21,18,15,
+     12,9,7,5,3,2,1,1,2,4,6,10,14,20,26,33,41,50,60,70,81,92,104,116,
+    },
+    {// SAW 24
+     128,146,163,180,195,209,222,232,241,247,252,254,255,254,252,249,245,241,237,233,229,226,223,221,
+     220,219,220,221,222,224,226,228,230,231,232,233,233,233,232,231,230,228,226,224,222,220,218,217,
+     216,216,215,216,216,217,218,219,220,220,221,221,222,221,221,220,219,218,217,215,214,212,211,210,
+     209,209,208,208,208,208,209,209,210,211,211,211,211,211,211,210,210,209,208,206,205,204,203,202,
+     201,201,200,200,200,200,200,200,201,201,201,202,202,202,201,201,200,200,199,198,197,196,195,194,
+     193,192,192,191,191,191,191,191,192,192,192,192,192,192,192,192,191,190,190,189,188,187,186,185,
+     184,184,183,183,183,182,182,182,182,183,183,183,183,183,183,182,182,181,181,180,179,178,178,177,
+     176,175,175,174,174,174,173,173,173,173,174,174,174,174,173,173,173,172,172,171,170,170,169,168,
+     167,167,166,165,165,165,164,164,164,164,164,164,164,164,164,164,164,163,163,162,162,161,160,159,
+     159,158,157,157,156,156,156,155,155,155,155,155,155,155,155,155,155,154,154,153,153,152,151,151,
+     150,149,148,148,147,147,147,146,146,146,146,146,146,146,146,146,146,145,145,145,144,143,143,142,
+     141,140,140,139,139,138,138,137,137,137,137,137,137,137,137,137,137,136,136,136,135,135,134,133,
+     132,132,131,130,130,129,129,128,128,128,128,128,128,128,128,128,128,128,127,127,126,126,125,124,
+     124,123,122,121,121,120,120,120,119,119,119,119,119,119,119,119,119,119,118,118,117,117,116,116,
+     115,114,113,113,112,111,111,111,110,110,110,110,110,110,110,110,110,110,109,109,109,108,108,107,
+     106,105,105,104,103,103,102,102,101,101,101,101,101,101,101,101,101,101,100,100,100,99,99,98,
+     97,97,96,95,94,94,93,93,92,92,92,92,92,92,92,92,92,92,92,91,91,91,90,89,
+     89,88,87,86,86,85,84,84,83,83,83,82,82,82,82,83,83,83,83,82,82,82,81,81,
+     80,79,78,78,77,76,75,75,74,74,73,73,73,73,73,73,74,74,74,74,73,73,73,72,
+     72,71,70,69,68,67,66,66,65,64,64,64,64,64,64,64,64,65,65,65,65,65,64,64,
+     63,62,61,60,59,58,57,56,56,55,55,54,54,54,55,55,55,56,56,56,56,56,56,55,
+     55,54,53,52,51,50,48,47,46,46,45,45,45,45,45,45,46,47,47,48,48,48,48,47,
+     47,46,45,44,42,41,39,38,37,36,35,35,34,35,35,36,36,37,38,39,40,40,41,40,
+     40,39,38,36,34,32,30,28,26,25,24,23,23,23,24,25,26,28,30,32,34,35,36,37,
+     36,35,33,30,27,23,19,15,11,7,4,2,1,2,4,9,15,24,34,47,61,76,93,110,
+    },
+    {// SQR 3
+     128,131,134,136,139,142,145,148,150,153,156,159,161,164,167,169,172,175,177,180,182,185,187,190,
+     192,195,197,199,202,204,206,208,210,212,214,216,218,220,222,224,225,227,229,230,232,234,235,236,
+     238,239,240,241,243,244,245,246,247,248,248,249,250,251,251,252,252,253,253,254,254,254,254,255,
+     255,255,255,255,255,255,255,255,254,254,254,254,253,253,253,252,252,251,251,250,250,249,249,248,
+     247,247,246,245,245,244,243,242,242,241,240,239,239,238,237,236,236,235,234,233,233,232,231,230,
+     230,229,228,228,227,226,226,225,225,224,223,223,222,222,221,221,221,220,220,220,219,219,219,219,
+     218,218,218,218,218,218,218,218,218,218,218,218,218,219,219,219,219,220,220,220,221,221,221,222,
+     222,223,223,224,225,225,226,226,227,228,228,229,230,230,231,232,233,233,234,235,236,236,237,238,
+     239,239,240,241,242,242,243,244,245,245,246,247,247,248,249,249,250,250,251,251,252,252,253,253,
+     253,254,254,254,254,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,252,252,251,251,
+     250,249,248,248,247,246,245,244,243,241,240,239,238,236,235,234,232,230,229,227,225,224,222,220,
+     218,216,214,212,210,208,206,204,202,199,197,195,192,190,187,185,182,180,177,175,172,169,167,164,
+     161,159,156,153,150,148,145,142,139,136,134,131,128,125,122,120,117,114,111,108,106,103,100,97,
+     95,92,89,87,84,81,79,76,74,71,69,66,64,61,59,57,54,52,50,48,46,44,42,40,
+     38,36,34,32,31,29,27,26,24,22,21,20,18,17,16,15,13,12,11,10,9,8,8,7,
+     6,5,5,4,4,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,2,2,2,2,
+     3,3,3,4,4,5,5,6,6,7,7,8,9,9,10,11,11,12,13,14,14,15,16,17,
+     17,18,19,20,20,21,22,23,23,24,25,26,26,27,28,28,29,30,30,31,31,32,33,33,
+     34,34,35,35,35,36,36,36,37,37,37,37,38,38,38,38,38,38,38,38,38,38,38,38,
+     38,37,37,37,37,36,36,36,35,35,35,34,34,33,33,32,31,31,30,30,29,28,28,27,
+     26,26,25,24,23,23,22,21,20,20,19,18,17,17,16,15,14,14,13,12,11,11,10,9,
+     9,8,7,7,6,6,5,5,4,4,3,3,3,2,2,2,2,1,1,1,1,1,1,1,
+     1,1,2,2,2,2,3,3,4,4,5,5,6,7,8,8,9,10,11,12,13,15,16,17,
+     18,20,21,22,24,26,27,29,31,32,34,36,38,40,42,44,46,48,50,52,54,57,59,61,
+     64,66,69,71,74,76,79,81,84,87,89,92,95,97,100,103,106,108,111,114,117,120,122,125,
+    },
+    {// SQR 5
+     128,132,137,141,145,149,153,158,162,166,170,174,178,182,185,189,193,196,200,203,207,210,213,216,
+     219,222,224,227,229,232,234,236,238,240,242,243,245,246,248,249,250,251,252,253,253,254,254,255,
+     255,255,255,255,255,255,254,254,254,253,252,252,251,250,250,249,248,247,246,245,244,243,242,241,
+     240,239,238,237,236,235,234,233,232,231,230,230,229,228,227,227,226,225,225,224,224,224,223,223,
+     223,223,222,222,222,222,222,223,223,223,223,223,224,224,225,225,226,226,227,227,228,229,229,230,
+     231,231,232,233,234,234,235,236,237,237,238,239,239,240,241,241,242,242,243,243,244,244,245,245,
+     245,245,246,246,246,246,246,246,246,246,246,245,245,245,245,244,244,243,243,242,242,241,241,240,
+     239,239,238,237,237,236,235,234,234,233,232,231,231,230,229,229,228,227,227,226,226,225,225,224,
+     224,223,223,223,223,223,222,222,222,222,222,223,223,223,223,224,224,224,225,225,226,227,227,228,
+     229,230,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,250,
+     251,252,252,253,254,254,254,255,255,255,255,255,255,255,254,254,253,253,252,251,250,249,248,246,
+     245,243,242,240,238,236,234,232,229,227,224,222,219,216,213,210,207,203,200,196,193,189,185,182,
+     178,174,170,166,162,158,153,149,145,141,137,132,128,124,119,115,111,107,103,98,94,90,86,82,
+     78,74,71,67,63,60,56,53,49,46,43,40,37,34,32,29,27,24,22,20,18,16,14,13,
+     11,10,8,7,6,5,4,3,3,2,2,1,1,1,1,1,1,1,2,2,2,3,4,4,
+     5,6,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,
+     27,28,29,29,30,31,31,32,32,32,33,33,33,33,34,34,34,34,34,33,33,33,33,33,
+     32,32,31,31,30,30,29,29,28,27,27,26,25,25,24,23,22,22,21,20,19,19,18,17,
+     17,16,15,15,14,14,13,13,12,12,11,11,11,11,10,10,10,10,10,10,10,10,10,11,
+     11,11,11,12,12,13,13,14,14,15,15,16,17,17,18,19,19,20,21,22,22,23,24,25,
+     25,26,27,27,28,29,29,30,30,31,31,32,32,33,33,33,33,33,34,34,34,34,34,33,
+     33,33,33,32,32,32,31,31,30,29,29,28,27,26,26,25,24,23,22,21,20,19,18,17,
+     16,15,14,13,12,11,10,9,8,7,6,6,5,4,4,3,2,2,2,1,1,1,1,1,
+     1,1,2,2,3,3,4,5,6,7,8,10,11,13,14,16,18,20,22,24,27,29,32,34,
+     37,40,43,46,49,53,56,60,63,67,71,74,78,82,86,90,94,98,103,107,111,115,119,124,
+    },
+    {// SQR 7
+     128,134,139,145,151,156,162,167,173,178,183,188,193,198,202,207,211,215,219,223,226,230,233,236,
+     238,241,243,245,247,249,250,251,252,253,254,255,255,255,255,255,255,254,254,253,252,251,250,249,
+     248,247,246,244,243,242,241,239,238,237,235,234,233,232,231,230,229,228,227,226,226,225,225,224,
+     224,224,224,224,224,224,224,224,225,225,226,226,227,227,228,229,230,230,231,232,233,234,235,236,
+     236,237,238,239,240,240,241,241,242,243,243,243,244,244,244,244,244,244,244,244,244,244,243,243,
+     243,242,242,241,240,240,239,239,238,237,236,236,235,234,233,233,232,231,231,230,230,229,229,228,
+     228,228,227,227,227,227,227,227,227,227,227,228,228,228,229,229,230,230,231,231,232,233,233,234,
+     235,236,236,237,238,239,239,240,240,241,242,242,243,243,243,244,244,244,244,244,244,244,244,244,
+     244,243,243,243,242,241,241,240,240,239,238,237,236,236,235,234,233,232,231,230,230,229,228,227,
+     227,226,226,225,225,224,224,224,224,224,224,224,224,224,225,225,226,226,227,228,229,230,231,232,
+     233,234,235,237,238,239,241,242,243,244,246,247,248,249,250,251,252,253,254,254,255,255,255,255,
+     255,255,254,253,252,251,250,249,247,245,243,241,238,236,233,230,226,223,219,215,211,207,202,198,
+     193,188,183,178,173,167,162,156,151,145,139,134,128,122,117,111,105,100,94,89,83,78,73,68,
+     63,58,54,49,45,41,37,33,30,26,23,20,18,15,13,11,9,7,6,5,4,3,2,1,
+     1,1,1,1,1,2,2,3,4,5,6,7,8,9,10,12,13,14,15,17,18,19,21,22,
+     23,24,25,26,27,28,29,30,30,31,31,32,32,32,32,32,32,32,32,32,31,31,30,30,
+     29,29,28,27,26,26,25,24,23,22,21,20,20,19,18,17,16,16,15,15,14,13,13,13,
+     12,12,12,12,12,12,12,12,12,12,13,13,13,14,14,15,16,16,17,17,18,19,20,20,
+     21,22,23,23,24,25,25,26,26,27,27,28,28,28,29,29,29,29,29,29,29,29,29,28,
+     28,28,27,27,26,26,25,25,24,23,23,22,21,20,20,19,18,17,17,16,16,15,14,14,
+     13,13,13,12,12,12,12,12,12,12,12,12,12,13,13,13,14,15,15,16,16,17,18,19,
+     20,20,21,22,23,24,25,26,26,27,28,29,29,30,30,31,31,32,32,32,32,32,32,32,
+     32,32,31,31,30,30,29,28,27,26,25,24,23,22,21,19,18,17,15,14,13,12,10,9,
+     8,7,6,5,4,3,2,2,1,1,1,1,1,1,2,3,4,5,6,7,9,11,13,15,
+     18,20,23,26,30,33,37,41,45,49,54,58,63,68,73,78,83,89,94,100,105,111,117,122,
+    },
+    {// SQR 9
+     128,135,142,149,156,163,170,177,183,189,195,201,207,212,217,222,226,230,234,238,241,244,246,248,
+     250,252,253,254,254,255,255,255,255,254,253,252,251,250,249,247,246,244,243,241,239,238,236,235,
+     233,232,231,229,228,227,227,226,225,225,224,224,224,224,224,225,225,226,226,227,228,229,230,231,
+     231,232,234,235,236,237,237,238,239,240,241,241,242,243,243,243,244,244,244,244,244,243,243,243,
+     242,242,241,240,240,239,238,237,237,236,235,234,233,233,232,231,231,230,230,229,229,229,228,228,
+     228,228,228,229,229,229,230,230,231,231,232,232,233,234,235,235,236,237,237,238,239,239,240,240,
+     241,241,242,242,242,242,242,242,242,242,242,241,241,240,240,239,239,238,237,237,236,235,235,234,
+     233,232,232,231,231,230,230,229,229,229,228,228,228,228,228,229,229,229,230,230,231,231,232,233,
+     233,234,235,236,237,237,238,239,240,240,241,242,242,243,243,243,244,244,244,244,244,243,243,243,
+     242,241,241,240,239,238,237,237,236,235,234,232,231,231,230,229,228,227,226,226,225,225,224,224,
+     224,224,224,225,225,226,227,227,228,229,231,232,233,235,236,238,239,241,243,244,246,247,249,250,
+     251,252,253,254,255,255,255,255,254,254,253,252,250,248,246,244,241,238,234,230,226,222,217,212,
+     207,201,195,189,183,177,170,163,156,149,142,135,128,121,114,107,100,93,86,79,73,67,61,55,
+     49,44,39,34,30,26,22,18,15,12,10,8,6,4,3,2,2,1,1,1,1,2,3,4,
+     5,6,7,9,10,12,13,15,17,18,20,21,23,24,25,27,28,29,29,30,31,31,32,32,
+     32,32,32,31,31,30,30,29,28,27,26,25,25,24,22,21,20,19,19,18,17,16,15,15,
+     14,13,13,13,12,12,12,12,12,13,13,13,14,14,15,16,16,17,18,19,19,20,21,22,
+     23,23,24,25,25,26,26,27,27,27,28,28,28,28,28,27,27,27,26,26,25,25,24,24,
+     23,22,21,21,20,19,19,18,17,17,16,16,15,15,14,14,14,14,14,14,14,14,14,15,
+     15,16,16,17,17,18,19,19,20,21,21,22,23,24,24,25,25,26,26,27,27,27,28,28,
+     28,28,28,27,27,27,26,26,25,25,24,23,23,22,21,20,19,19,18,17,16,16,15,14,
+     14,13,13,13,12,12,12,12,12,13,13,13,14,15,15,16,17,18,19,19,20,21,22,24,
+     25,25,26,27,28,29,30,30,31,31,32,32,32,32,32,31,31,30,29,29,28,27,25,24,
+     23,21,20,18,17,15,13,12,10,9,7,6,5,4,3,2,1,1,1,1,2,2,3,4,
+     6,8,10,12,15,18,22,26,30,34,39,44,49,55,61,67,73,79,86,93,100,107,114,121,
+    },
+    {// SQR 13
+     128,138,148,158,167,177,186,194,202,210,217,224,230,235,240,244,247,250,252,254,255,255,255,254,
+     254,252,251,249,247,245,243,241,238,236,234,232,231,229,228,227,226,225,225,225,225,225,226,227,
+     228,229,230,231,233,234,235,237,238,239,240,241,242,242,243,243,243,243,243,243,242,242,241,240,
+     239,238,237,236,235,234,233,232,232,231,230,230,230,229,229,230,230,230,231,231,232,233,233,234,
+     235,236,237,237,238,239,239,240,240,241,241,241,241,241,241,240,240,239,239,238,237,236,236,235,
+     234,233,233,232,232,231,231,231,231,231,231,231,231,232,232,233,233,234,235,235,236,237,237,238,
+     239,239,240,240,240,240,240,240,240,240,240,239,239,238,237,237,236,235,235,234,233,233,232,232,
+     231,231,231,231,231,231,231,231,232,232,233,233,234,235,236,236,237,238,239,239,240,240,241,241,
+     241,241,241,241,240,240,239,239,238,237,237,236,235,234,233,233,232,231,231,230,230,230,229,229,
+     230,230,230,231,232,232,233,234,235,236,237,238,239,240,241,242,242,243,243,243,243,243,243,242,
+     242,241,240,239,238,237,235,234,233,231,230,229,228,227,226,225,225,225,225,225,226,227,228,229,
+     231,232,234,236,238,241,243,245,247,249,251,252,254,254,255,255,255,254,252,250,247,244,240,235,
+     230,224,217,210,202,194,186,177,167,158,148,138,128,118,108,98,89,79,70,62,54,46,39,32,
+     26,21,16,12,9,6,4,2,1,1,1,2,2,4,5,7,9,11,13,15,18,20,22,24,
+     25,27,28,29,30,31,31,31,31,31,30,29,28,27,26,25,23,22,21,19,18,17,16,15,
+     14,14,13,13,13,13,13,13,14,14,15,16,17,18,19,20,21,22,23,24,24,25,26,26,
+     26,27,27,26,26,26,25,25,24,23,23,22,21,20,19,19,18,17,17,16,16,15,15,15,
+     15,15,15,16,16,17,17,18,19,20,20,21,22,23,23,24,24,25,25,25,25,25,25,25,
+     25,24,24,23,23,22,21,21,20,19,19,18,17,17,16,16,16,16,16,16,16,16,16,17,
+     17,18,19,19,20,21,21,22,23,23,24,24,25,25,25,25,25,25,25,25,24,24,23,23,
+     22,21,20,20,19,18,17,17,16,16,15,15,15,15,15,15,16,16,17,17,18,19,19,20,
+     21,22,23,23,24,25,25,26,26,26,27,27,26,26,26,25,24,24,23,22,21,20,19,18,
+     17,16,15,14,14,13,13,13,13,13,13,14,14,15,16,17,18,19,21,22,23,25,26,27,
+     28,29,30,31,31,31,31,31,30,29,28,27,25,24,22,20,18,15,13,11,9,7,5,4,
+     2,2,1,1,1,2,4,6,9,12,16,21,26,32,39,46,54,62,70,79,89,98,108,118,
+    },
+    {// SQR 17
+     128,141,154,166,178,190,200,210,219,227,234,240,245,249,252,254,255,255,254,253,251,249,247,244,
+     241,238,235,233,231,229,227,226,225,225,225,226,226,227,229,230,232,234,235,237,238,240,241,242,
+     243,243,243,243,243,242,241,240,239,238,237,235,234,233,232,231,231,230,230,230,230,230,231,232,
+     232,233,234,235,236,237,238,239,240,240,240,241,241,240,240,239,239,238,237,236,236,235,234,233,
+     232,232,232,231,231,231,232,232,232,233,234,235,235,236,237,238,238,239,239,239,240,240,240,239,
+     239,238,238,237,236,236,235,234,234,233,233,232,232,232,232,232,232,233,233,234,234,235,236,237,
+     237,238,238,239,239,239,239,239,239,239,238,238,237,237,236,235,234,234,233,233,232,232,232,232,
+     232,232,233,233,234,234,235,236,236,237,238,238,239,239,240,240,240,239,239,239,238,238,237,236,
+     235,235,234,233,232,232,232,231,231,231,232,232,232,233,234,235,236,236,237,238,239,239,240,240,
+     241,241,240,240,240,239,238,237,236,235,234,233,232,232,231,230,230,230,230,230,231,231,232,233,
+     234,235,237,238,239,240,241,242,243,243,243,243,243,242,241,240,238,237,235,234,232,230,229,227,
+     226,226,225,225,225,226,227,229,231,233,235,238,241,244,247,249,251,253,254,255,255,254,252,249,
+     245,240,234,227,219,210,200,190,178,166,154,141,128,115,102,90,78,66,56,46,37,29,22,16,
+     11,7,4,2,1,1,2,3,5,7,9,12,15,18,21,23,25,27,29,30,31,31,31,30,
+     30,29,27,26,24,22,21,19,18,16,15,14,13,13,13,13,13,14,15,16,17,18,19,21,
+     22,23,24,25,25,26,26,26,26,26,25,24,24,23,22,21,20,19,18,17,16,16,16,15,
+     15,16,16,17,17,18,19,20,20,21,22,23,24,24,24,25,25,25,24,24,24,23,22,21,
+     21,20,19,18,18,17,17,17,16,16,16,17,17,18,18,19,20,20,21,22,22,23,23,24,
+     24,24,24,24,24,23,23,22,22,21,20,19,19,18,18,17,17,17,17,17,17,17,18,18,
+     19,19,20,21,22,22,23,23,24,24,24,24,24,24,23,23,22,22,21,20,20,19,18,18,
+     17,17,16,16,16,17,17,17,18,18,19,20,21,21,22,23,24,24,24,25,25,25,24,24,
+     24,23,22,21,20,20,19,18,17,17,16,16,15,15,16,16,16,17,18,19,20,21,22,23,
+     24,24,25,26,26,26,26,26,25,25,24,23,22,21,19,18,17,16,15,14,13,13,13,13,
+     13,14,15,16,18,19,21,22,24,26,27,29,30,30,31,31,31,30,29,27,25,23,21,18,
+     15,12,9,7,5,3,2,1,1,2,4,7,11,16,22,29,37,46,56,66,78,90,102,115,
+    },
+    {// SQR 25
+     128,147,165,182,198,212,225,235,243,249,253,255,255,254,251,248,244,240,236,232,229,227,226,225,
+     226,227,228,230,233,235,237,240,241,242,243,243,243,242,240,239,237,235,234,232,231,230,230,230,
+     231,232,233,234,236,237,238,239,240,240,240,240,240,239,238,237,235,234,233,233,232,232,232,232,
+     233,234,235,236,237,238,238,239,239,239,239,239,238,237,236,235,235,234,233,233,233,233,233,233,
+     234,235,236,237,237,238,238,239,239,239,238,238,237,236,236,235,234,234,233,233,233,233,234,234,
+     235,236,236,237,238,238,238,239,238,238,238,237,236,236,235,234,234,233,233,233,233,234,234,235,
+     236,236,237,238,238,238,238,238,238,238,237,236,236,235,234,234,233,233,233,233,234,234,235,236,
+     236,237,238,238,238,239,238,238,238,237,236,236,235,234,234,233,233,233,233,234,234,235,236,236,
+     237,238,238,239,239,239,238,238,237,237,236,235,234,233,233,233,233,233,233,234,235,235,236,237,
+     238,239,239,239,239,239,238,238,237,236,235,234,233,232,232,232,232,233,233,234,235,237,238,239,
+     240,240,240,240,240,239,238,237,236,234,233,232,231,230,230,230,231,232,234,235,237,239,240,242,
+     243,243,243,242,241,240,237,235,233,230,228,227,226,225,226,227,229,232,236,240,244,248,251,254,
+     255,255,253,249,243,235,225,212,198,182,165,147,128,109,91,74,58,44,31,21,13,7,3,1,
+     1,2,5,8,12,16,20,24,27,29,30,31,30,29,28,26,23,21,19,16,15,14,13,13,
+     13,14,16,17,19,21,22,24,25,26,26,26,25,24,23,22,20,19,18,17,16,16,16,16,
+     16,17,18,19,21,22,23,23,24,24,24,24,23,22,21,20,19,18,18,17,17,17,17,17,
+     18,19,20,21,21,22,23,23,23,23,23,23,22,21,20,19,19,18,18,17,17,17,18,18,
+     19,20,20,21,22,22,23,23,23,23,22,22,21,20,20,19,18,18,18,17,18,18,18,19,
+     20,20,21,22,22,23,23,23,23,22,22,21,20,20,19,18,18,18,18,18,18,18,19,20,
+     20,21,22,22,23,23,23,23,22,22,21,20,20,19,18,18,18,17,18,18,18,19,20,20,
+     21,22,22,23,23,23,23,22,22,21,20,20,19,18,18,17,17,17,18,18,19,19,20,21,
+     22,23,23,23,23,23,23,22,21,21,20,19,18,17,17,17,17,17,18,18,19,20,21,22,
+     23,24,24,24,24,23,23,22,21,19,18,17,16,16,16,16,16,17,18,19,20,22,23,24,
+     25,26,26,26,25,24,22,21,19,17,16,14,13,13,13,14,15,16,19,21,23,26,28,29,
+     30,31,30,29,27,24,20,16,12,8,5,2,1,1,3,7,13,21,31,44,58,74,91,109,
+    },
+    {// SQR 33
+     128,152,175,197,215,231,242,250,254,255,253,250,245,240,234,230,227,225,225,226,229,231,235,238,
+     240,242,243,243,242,240,238,236,234,232,231,230,230,231,232,234,236,238,239,240,240,240,239,238,
+     237,235,234,233,232,232,232,233,234,235,236,238,238,239,239,239,238,237,236,235,234,233,233,233,
+     233,234,235,236,237,237,238,238,238,238,237,237,236,235,234,233,233,233,234,234,235,236,237,237,
+     238,238,238,238,237,236,235,235,234,234,233,234,234,235,235,236,237,238,238,238,238,237,237,236,
+     235,234,234,234,234,234,234,235,236,236,237,238,238,238,237,237,236,236,235,234,234,234,234,234,
+     235,235,236,237,237,238,238,238,237,237,236,235,235,234,234,234,234,234,235,236,236,237,237,238,
+     238,238,237,236,236,235,234,234,234,234,234,234,235,236,237,237,238,238,238,238,237,236,235,235,
+     234,234,233,234,234,235,235,236,237,238,238,238,238,237,237,236,235,234,234,233,233,233,234,235,
+     236,237,237,238,238,238,238,237,237,236,235,234,233,233,233,233,234,235,236,237,238,239,239,239,
+     238,238,236,235,234,233,232,232,232,233,234,235,237,238,239,240,240,240,239,238,236,234,232,231,
+     230,230,231,232,234,236,238,240,242,243,243,242,240,238,235,231,229,226,225,225,227,230,234,240,
+     245,250,253,255,254,250,242,231,215,197,175,152,128,104,81,59,41,25,14,6,2,1,3,6,
+     11,16,22,26,29,31,31,30,27,25,21,18,16,14,13,13,14,16,18,20,22,24,25,26,
+     26,25,24,22,20,18,17,16,16,16,17,18,19,21,22,23,24,24,24,23,22,21,20,18,
+     18,17,17,17,18,19,20,21,22,23,23,23,23,22,21,20,19,19,18,18,18,18,19,19,
+     20,21,22,23,23,23,22,22,21,20,19,19,18,18,18,18,19,20,21,21,22,22,23,22,
+     22,21,21,20,19,18,18,18,18,19,19,20,21,22,22,22,22,22,22,21,20,20,19,18,
+     18,18,19,19,20,20,21,22,22,22,22,22,21,21,20,19,19,18,18,18,19,19,20,21,
+     21,22,22,22,22,22,21,20,20,19,19,18,18,18,19,20,20,21,22,22,22,22,22,22,
+     21,20,19,19,18,18,18,18,19,20,21,21,22,22,23,22,22,21,21,20,19,18,18,18,
+     18,19,19,20,21,22,22,23,23,23,22,21,20,19,19,18,18,18,18,19,19,20,21,22,
+     23,23,23,23,22,21,20,19,18,17,17,17,18,18,20,21,22,23,24,24,24,23,22,21,
+     19,18,17,16,16,16,17,18,20,22,24,25,26,26,25,24,22,20,18,16,14,13,13,14,
+     16,18,21,25,27,30,31,31,29,26,22,16,11,6,3,1,2,6,14,25,41,59,81,104,
+    },
+    {// PUL 5
+     135,136,136,136,136,135,135,134,134,133,133,133,133,133,133,134,134,135,135,135,136,136,136,135,
+     135,135,134,134,133,133,133,133,133,134,134,134,135,135,136,136,136,135,135,135,134,134,133,133,
+     133,133,133,133,134,134,135,135,135,136,136,135,135,135,134,134,134,133,133,133,133,133,134,134,
+     134,135,135,135,136,135,135,135,135,134,134,133,133,133,133,133,134,134,134,135,135,135,135,135,
+     135,135,135,134,134,134,133,133,133,133,133,134,134,134,135,135,135,135,135,135,135,135,134,134,
+     133,133,133,133,133,134,134,134,135,135,135,135,135,135,135,135,134,134,134,133,133,133,133,133,
+     134,134,135,135,135,135,135,135,135,135,135,134,134,133,133,133,133,133,134,134,134,135,135,135,
+     135,135,135,135,135,134,134,134,133,133,133,133,133,134,134,135,135,135,135,135,135,135,135,134,
+     134,134,133,133,133,133,133,134,134,134,135,135,135,135,135,135,135,135,134,134,134,133,133,133,
+     133,133,134,134,135,135,135,135,136,135,135,135,134,134,134,133,133,133,133,133,134,134,134,135,
+     135,135,136,136,135,135,135,134,134,133,133,133,133,133,133,134,134,135,135,135,136,136,136,135,
+     135,134,134,134,133,133,133,133,133,134,134,135,135,135,136,136,136,135,135,135,134,134,133,133,
+     133,133,133,133,134,134,135,135,136,136,136,136,135,135,134,134,133,133,133,133,133,133,134,134,
+     135,135,136,136,136,136,136,135,135,134,133,133,133,132,132,133,133,134,134,135,136,136,136,136,
+     136,136,135,134,134,133,132,132,132,132,133,133,134,135,136,136,137,137,137,136,135,135,134,133,
+     132,132,132,132,132,133,134,135,136,136,137,137,137,137,136,135,134,133,132,131,131,131,131,132,
+     133,134,136,137,138,138,138,138,137,136,134,133,132,131,130,130,130,131,132,134,136,137,139,140,
+     140,140,139,137,135,133,130,128,127,126,127,128,130,133,137,141,144,147,148,147,145,139,132,122,
+     111,97,83,68,54,41,29,19,11,5,2,1,1,3,5,8,10,11,12,11,10,8,5,3,
+     1,1,2,5,11,19,29,41,54,68,83,97,111,122,132,139,145,147,148,147,144,141,137,133,
+     130,128,127,126,127,128,130,133,135,137,139,140,140,140,139,137,136,134,132,131,130,130,130,131,
+     132,133,134,136,137,138,138,138,138,137,136,134,133,132,131,131,131,131,132,133,134,135,136,137,
+     137,137,137,136,136,135,134,133,132,132,132,132,132,133,134,135,135,136,137,137,137,136,136,135,
+     134,133,133,132,132,132,132,133,134,134,135,136,136,136,136,136,136,135,134,134,133,133,132,132,
+     133,133,133,134,135,135,136,136,136,136,136,135,135,134,134,133,133,133,133,133,133,134,134,135,
+    },
+    {// PUL 10
+     142,142,142,142,142,141,141,141,140,140,140,140,140,140,140,140,141,141,142,142,142,142,142,142,
+     141,141,140,140,140,140,140,140,140,140,141,141,141,142,142,142,142,142,141,141,141,140,140,140,
+     140,140,140,140,141,141,141,141,142,142,142,142,141,141,141,140,140,140,140,140,140,140,140,141,
+     141,141,142,142,142,142,142,141,141,141,140,140,140,140,140,140,140,141,141,141,141,142,142,142,
+     142,141,141,141,141,140,140,140,140,140,140,140,141,141,141,142,142,142,142,142,141,141,141,140,
+     140,140,140,140,140,140,141,141,141,141,142,142,142,142,141,141,141,141,140,140,140,140,140,140,
+     140,141,141,141,142,142,142,142,142,141,141,141,140,140,140,140,140,140,140,141,141,141,141,142,
+     142,142,142,141,141,141,141,140,140,140,140,140,140,140,141,141,141,142,142,142,142,142,141,141,
+     141,140,140,140,140,140,140,140,141,141,141,141,142,142,142,142,141,141,141,141,140,140,140,140,
+     140,140,140,141,141,141,142,142,142,142,142,141,141,141,140,140,140,140,140,140,140,140,141,141,
+     141,142,142,142,142,141,141,141,141,140,140,140,140,140,140,140,141,141,141,142,142,142,142,142,
+     141,141,141,140,140,140,140,140,140,140,140,141,141,142,142,142,142,142,142,141,141,140,140,140,
+     140,140,140,140,140,141,141,141,142,142,142,142,142,142,141,141,140,140,140,139,139,140,140,140,
+     141,141,142,142,142,142,142,142,141,141,140,140,140,139,139,139,140,140,140,141,142,142,142,143,
+     142,142,142,141,141,140,140,139,139,139,139,140,140,141,141,142,143,143,143,143,142,142,141,140,
+     140,139,139,138,138,139,139,140,141,142,143,143,144,144,143,143,142,141,140,139,138,138,137,138,
+     138,139,140,142,143,144,145,145,145,145,144,142,140,139,137,136,135,134,135,136,138,141,144,146,
+     149,151,152,152,150,147,141,134,125,114,103,90,77,64,51,39,29,20,13,7,3,1,1,2,
+     4,6,9,12,15,17,19,20,20,19,18,17,15,13,11,9,8,7,7,7,8,9,11,13,
+     15,17,18,19,20,20,19,17,15,12,9,6,4,2,1,1,3,7,13,20,29,39,51,64,
+     77,90,103,114,125,134,141,147,150,152,152,151,149,146,144,141,138,136,135,134,135,136,137,139,
+     140,142,144,145,145,145,145,144,143,142,140,139,138,138,137,138,138,139,140,141,142,143,143,144,
+     144,143,143,142,141,140,139,139,138,138,139,139,140,140,141,142,142,143,143,143,143,142,141,141,
+     140,140,139,139,139,139,140,140,141,141,142,142,142,143,142,142,142,141,140,140,140,139,139,139,
+     140,140,140,141,141,142,142,142,142,142,142,141,141,140,140,140,139,139,140,140,140,141,141,142,
+    },
+    {// PUL 15
+     148,148,147,147,147,147,147,148,148,148,149,149,149,149,149,149,148,148,148,148,148,147,147,147,
+     148,148,148,148,148,149,149,149,149,149,148,148,148,148,148,147,147,147,148,148,148,148,148,149,
+     149,149,149,149,148,148,148,148,148,148,147,147,148,148,148,148,148,148,149,149,149,149,149,148,
+     148,148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,148,148,148,148,148,148,148,
+     148,148,148,148,148,148,148,149,149,149,149,148,148,148,148,148,148,148,148,148,148,148,148,148,
+     148,149,149,149,149,148,148,148,148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,148,
+     148,148,148,148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,148,148,148,148,148,148,
+     148,148,148,148,148,148,148,148,149,149,149,149,148,148,148,148,148,148,148,148,148,148,148,148,
+     148,148,149,149,149,149,148,148,148,148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,
+     149,148,148,148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,148,148,148,148,148,
+     148,147,147,148,148,148,148,148,148,149,149,149,149,149,148,148,148,148,148,147,147,147,148,148,
+     148,148,148,149,149,149,149,149,148,148,148,148,148,147,147,147,148,148,148,148,148,149,149,149,
+     149,149,149,148,148,148,147,147,147,147,147,148,148,148,148,149,149,149,149,149,149,148,148,148,
+     147,147,147,147,147,147,148,148,149,149,149,149,149,149,149,148,148,148,147,147,147,147,147,147,
+     148,148,149,149,149,150,150,149,149,149,148,148,147,147,146,146,147,147,147,148,149,149,150,150,
+     150,150,150,149,148,147,147,146,145,145,146,146,147,148,149,150,151,152,152,152,151,150,148,147,
+     145,144,143,142,143,144,146,148,151,154,157,159,159,158,156,151,144,135,124,111,97,82,67,53,
+     40,28,18,10,5,2,1,2,4,7,11,14,17,20,21,22,21,20,18,16,14,11,10,9,
+     8,8,10,11,13,15,17,18,19,19,19,18,17,15,13,12,10,9,9,9,10,12,13,15,
+     17,18,19,19,19,18,17,15,13,11,10,8,8,9,10,11,14,16,18,20,21,22,21,20,
+     17,14,11,7,4,2,1,2,5,10,18,28,40,53,67,82,97,111,124,135,144,151,156,158,
+     159,159,157,154,151,148,146,144,143,142,143,144,145,147,148,150,151,152,152,152,151,150,149,148,
+     147,146,146,145,145,146,147,147,148,149,150,150,150,150,150,149,149,148,147,147,147,146,146,147,
+     147,148,148,149,149,149,150,150,149,149,149,148,148,147,147,147,147,147,147,148,148,148,149,149,
+     149,149,149,149,149,148,148,147,147,147,147,147,147,148,148,148,149,149,149,149,149,149,148,148,
+    },
+    {// PUL 20
+     155,155,155,155,155,155,156,157,158,158,159,159,159,159,158,158,157,156,156,155,155,155,155,155,
+     156,157,157,158,158,159,159,159,158,158,157,157,156,156,155,155,155,155,156,156,157,158,158,158,
+     159,159,158,158,158,157,156,156,155,155,155,155,156,156,157,157,158,158,158,159,158,158,158,157,
+     157,156,156,155,155,155,156,156,156,157,157,158,158,158,158,158,158,157,157,156,156,156,155,155,
+     155,156,156,157,157,158,158,158,158,158,158,158,157,157,156,156,155,155,155,156,156,156,157,157,
+     158,158,158,158,158,158,157,157,156,156,156,155,155,156,156,156,157,157,158,158,158,158,158,158,
+     158,157,157,156,156,155,155,155,156,156,157,157,158,158,158,158,158,158,158,157,157,156,156,156,
+     155,155,156,156,156,157,157,158,158,158,158,158,158,157,157,156,156,156,155,155,155,156,156,157,
+     157,158,158,158,158,158,158,158,157,157,156,156,155,155,155,156,156,156,157,157,158,158,158,158,
+     158,158,157,157,156,156,156,155,155,155,156,156,157,157,158,158,158,159,158,158,158,157,157,156,
+     156,155,155,155,155,156,156,157,158,158,158,159,159,158,158,158,157,156,156,155,155,155,155,156,
+     156,157,157,158,158,159,159,159,158,158,157,157,156,155,155,155,155,155,156,156,157,158,158,159,
+     159,159,159,158,158,157,156,155,155,155,155,155,155,156,157,157,158,159,159,159,159,159,158,157,
+     156,156,155,154,154,154,155,155,156,157,158,159,160,160,160,159,159,158,157,156,155,154,154,154,
+     154,155,156,157,158,159,160,161,161,160,160,159,157,156,154,153,153,152,152,153,154,156,158,159,
+     161,162,163,162,162,160,158,156,154,151,150,149,149,150,152,155,158,162,165,168,170,171,169,166,
+     160,151,141,128,114,99,84,68,53,40,28,18,11,5,2,1,1,3,5,8,11,14,16,17,
+     18,18,17,16,15,13,12,11,10,9,9,10,10,11,12,13,14,14,14,15,14,14,14,13,
+     13,12,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,12,12,12,12,12,12,12,12,12,13,13,14,14,14,15,14,14,14,13,12,11,
+     10,10,9,9,10,11,12,13,15,16,17,18,18,17,16,14,11,8,5,3,1,1,2,5,
+     11,18,28,40,53,68,84,99,114,128,141,151,160,166,169,171,170,168,165,162,158,155,152,150,
+     149,149,150,151,154,156,158,160,162,162,163,162,161,159,158,156,154,153,152,152,153,153,154,156,
+     157,159,160,160,161,161,160,159,158,157,156,155,154,154,154,154,155,156,157,158,159,159,160,160,
+     160,159,158,157,156,155,155,154,154,154,155,156,156,157,158,159,159,159,159,159,158,157,157,156,
+    },
+    {// PUL 25
+     164,164,164,165,165,166,166,167,167,167,167,167,166,166,166,165,165,165,164,164,165,165,165,165,
+     166,166,166,167,167,167,166,166,166,166,165,165,165,165,165,165,165,165,166,166,166,166,166,167,
+     166,166,166,166,166,165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,166,166,165,
+     165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,166,166,165,165,165,165,165,165,
+     165,165,166,166,166,166,166,166,166,166,166,166,166,165,165,165,165,165,165,165,165,166,166,166,
+     166,166,166,166,166,166,166,166,165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,
+     166,166,165,165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,166,166,165,165,165,
+     165,165,165,165,165,166,166,166,166,166,166,166,166,166,166,166,165,165,165,165,165,165,165,165,
+     166,166,166,166,166,166,166,166,166,166,166,165,165,165,165,165,165,165,165,166,166,166,166,166,
+     166,166,166,166,166,165,165,165,165,165,165,165,165,165,166,166,166,166,166,166,166,166,166,166,
+     165,165,165,165,165,165,165,165,166,166,166,166,166,167,166,166,166,166,166,165,165,165,165,165,
+     165,165,165,166,166,166,166,167,167,167,166,166,166,165,165,165,165,164,164,165,165,165,166,166,
+     166,167,167,167,167,167,166,166,165,165,164,164,164,164,164,165,165,166,166,167,167,167,167,167,
+     167,166,166,165,164,164,164,164,164,164,165,165,166,167,168,168,168,168,168,167,166,165,164,163,
+     163,162,162,163,164,165,166,167,168,169,170,170,170,169,168,166,164,162,161,160,159,159,160,162,
+     165,168,171,174,177,178,178,177,173,167,159,149,136,122,107,91,75,60,45,32,22,13,7,3,
+     1,1,3,6,9,13,17,20,22,23,23,23,21,19,17,15,12,11,10,9,9,10,12,13,
+     15,17,18,19,20,20,19,18,17,16,14,13,12,11,11,11,12,13,14,16,17,18,19,19,
+     19,18,17,16,15,14,13,12,12,12,12,13,14,15,16,17,18,19,19,19,18,17,16,15,
+     14,13,12,12,12,12,13,14,15,16,17,18,19,19,19,18,17,16,14,13,12,11,11,11,
+     12,13,14,16,17,18,19,20,20,19,18,17,15,13,12,10,9,9,10,11,12,15,17,19,
+     21,23,23,23,22,20,17,13,9,6,3,1,1,3,7,13,22,32,45,60,75,91,107,122,
+     136,149,159,167,173,177,178,178,177,174,171,168,165,162,160,159,159,160,161,162,164,166,168,169,
+     170,170,170,169,168,167,166,165,164,163,162,162,163,163,164,165,166,167,168,168,168,168,168,167,
+     166,165,165,164,164,164,164,164,164,165,166,166,167,167,167,167,167,167,166,166,165,165,164,164,
+    },
+    {// PUL 30
+     177,178,178,179,179,178,178,177,177,176,175,174,174,174,174,175,175,176,177,177,178,178,178,178,
+     178,177,177,176,175,175,174,174,174,175,175,176,176,177,178,178,178,178,178,177,177,176,176,175,
+     175,175,175,175,175,176,176,177,177,178,178,178,178,177,177,176,176,175,175,175,175,175,175,176,
+     176,177,177,177,178,178,178,177,177,176,176,176,175,175,175,175,175,176,176,176,177,177,178,178,
+     178,177,177,177,176,176,175,175,175,175,175,175,176,176,177,177,177,178,178,177,177,177,176,176,
+     175,175,175,175,175,175,176,176,177,177,177,177,177,177,177,177,176,176,176,175,175,175,175,175,
+     176,176,176,177,177,177,177,177,177,177,176,176,176,175,175,175,175,175,176,176,176,177,177,177,
+     177,177,177,177,177,176,176,175,175,175,175,175,175,176,176,177,177,177,178,178,177,177,177,176,
+     176,175,175,175,175,175,175,176,176,177,177,177,178,178,178,177,177,176,176,176,175,175,175,175,
+     175,176,176,176,177,177,178,178,178,177,177,177,176,176,175,175,175,175,175,175,176,176,177,177,
+     178,178,178,178,177,177,176,176,175,175,175,175,175,175,176,176,177,177,178,178,178,178,178,177,
+     176,176,175,175,174,174,174,175,175,176,177,177,178,178,178,178,178,177,177,176,175,175,174,174,
+     174,174,175,176,177,177,178,178,179,179,178,178,177,176,175,174,174,173,173,174,174,175,176,177,
+     178,179,180,180,179,178,177,176,175,174,173,172,172,173,173,175,176,178,179,181,181,182,181,180,
+     178,176,174,172,170,169,168,169,171,173,177,180,184,188,190,191,189,186,180,171,160,146,130,113,
+     96,78,61,46,32,21,12,6,2,1,2,4,7,11,15,18,21,23,23,23,22,20,18,15,
+     13,12,10,10,10,11,12,14,16,17,18,19,20,19,19,18,16,15,14,13,12,12,12,13,
+     14,15,16,17,18,18,18,18,18,17,16,15,14,13,13,13,13,13,14,15,16,17,17,18,
+     18,18,17,17,16,15,14,14,13,13,13,14,14,15,16,17,17,18,18,18,17,17,16,15,
+     14,14,13,13,13,14,14,15,16,17,17,18,18,18,17,17,16,15,14,13,13,13,13,13,
+     14,15,16,17,18,18,18,18,18,17,16,15,14,13,12,12,12,13,14,15,16,18,19,19,
+     20,19,18,17,16,14,12,11,10,10,10,12,13,15,18,20,22,23,23,23,21,18,15,11,
+     7,4,2,1,2,6,12,21,32,46,61,78,96,113,130,146,160,171,180,186,189,191,190,188,
+     184,180,177,173,171,169,168,169,170,172,174,176,178,180,181,182,181,181,179,178,176,175,173,173,
+     172,172,173,174,175,176,177,178,179,180,180,179,178,177,176,175,174,174,173,173,174,174,175,176,
+    },
+    {// PUL 35
+     192,193,193,192,191,190,189,188,187,186,185,185,185,186,187,188,189,190,191,191,192,192,191,190,
+     189,188,187,187,186,186,186,186,187,187,188,189,190,191,191,191,191,190,190,189,188,187,187,186,
+     186,186,187,187,188,189,189,190,191,191,191,190,190,189,188,188,187,187,186,186,187,187,188,188,
+     189,190,190,191,191,190,190,190,189,188,187,187,187,186,187,187,187,188,189,189,190,190,190,190,
+     190,190,189,189,188,187,187,187,187,187,187,188,188,189,190,190,190,190,190,190,189,189,188,188,
+     187,187,187,187,187,187,188,189,189,190,190,190,190,190,190,189,189,188,187,187,187,187,187,187,
+     188,188,189,189,190,190,190,190,190,189,189,188,188,187,187,187,187,187,187,188,189,189,190,190,
+     190,190,190,190,189,189,188,187,187,187,187,187,187,188,188,189,189,190,190,190,190,190,190,189,
+     188,188,187,187,187,187,187,187,188,189,189,190,190,190,190,190,190,189,189,188,187,187,187,186,
+     187,187,187,188,189,190,190,190,191,191,190,190,189,188,188,187,187,186,186,187,187,188,188,189,
+     190,190,191,191,191,190,189,189,188,187,187,186,186,186,187,187,188,189,190,190,191,191,191,191,
+     190,189,188,187,187,186,186,186,186,187,187,188,189,190,191,192,192,191,191,190,189,188,187,186,
+     185,185,185,186,187,188,189,190,191,192,193,193,192,191,190,188,187,185,184,184,183,184,185,186,
+     188,190,192,193,195,195,195,193,192,189,187,184,182,180,179,180,181,183,187,191,195,199,202,204,
+     204,203,198,191,181,169,154,138,120,101,83,65,49,35,23,14,7,3,1,1,3,6,10,13,
+     17,20,22,23,23,23,21,19,17,15,13,12,11,11,11,12,13,14,16,17,18,19,19,19,
+     19,18,17,16,15,14,13,13,13,13,13,14,15,16,17,17,18,18,18,18,17,17,16,15,
+     15,14,14,14,14,14,15,15,16,16,17,17,17,17,17,17,16,16,16,15,15,14,14,14,
+     14,15,15,16,16,16,17,17,17,17,17,17,16,16,15,15,15,14,14,14,15,15,15,16,
+     16,17,17,17,17,17,17,16,16,16,15,15,14,14,14,14,15,15,16,16,16,17,17,17,
+     17,17,17,16,16,15,15,14,14,14,14,14,15,15,16,17,17,18,18,18,18,17,17,16,
+     15,14,13,13,13,13,13,14,15,16,17,18,19,19,19,19,18,17,16,14,13,12,11,11,
+     11,12,13,15,17,19,21,23,23,23,22,20,17,13,10,6,3,1,1,3,7,14,23,35,
+     49,65,83,101,120,138,154,169,181,191,198,203,204,204,202,199,195,191,187,183,181,180,179,180,
+     182,184,187,189,192,193,195,195,195,193,192,190,188,186,185,184,183,184,184,185,187,188,190,191,
+    },
+    {// PUL 40
+     205,204,202,201,199,198,198,197,198,198,199,200,201,202,203,204,204,204,203,203,202,201,200,200,
+     199,199,199,199,200,200,201,202,202,203,203,203,203,202,202,201,201,200,200,200,200,200,200,200,
+     201,201,202,202,202,202,202,202,202,201,201,201,200,200,200,200,200,201,201,201,201,202,202,202,
+     202,202,202,201,201,201,201,201,200,200,201,201,201,201,201,201,202,202,202,202,202,201,201,201,
+     201,201,201,201,201,201,201,201,201,201,201,201,202,202,201,201,201,201,201,201,201,201,201,201,
+     201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
+     201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,
+     201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,202,
+     202,201,201,201,201,201,201,201,201,201,201,201,201,201,201,201,202,202,202,202,202,201,201,201,
+     201,201,201,200,200,201,201,201,201,201,202,202,202,202,202,202,201,201,201,201,200,200,200,200,
+     200,201,201,201,202,202,202,202,202,202,202,201,201,200,200,200,200,200,200,200,201,201,202,202,
+     203,203,203,203,202,202,201,200,200,199,199,199,199,200,200,201,202,203,203,204,204,204,203,202,
+     201,200,199,198,198,197,198,198,199,201,202,204,205,206,206,206,205,204,202,200,198,196,194,193,
+     193,194,196,199,203,207,211,214,216,217,215,211,204,194,181,166,149,130,111,91,72,54,38,25,
+     15,7,3,1,2,4,8,12,17,21,24,27,28,28,27,25,22,19,17,14,12,11,11,12,
+     13,15,17,19,21,23,24,24,24,23,21,19,18,16,15,14,14,14,14,16,17,18,20,21,
+     22,22,22,22,21,20,18,17,16,15,15,14,15,16,17,18,19,20,21,22,22,22,21,20,
+     19,18,17,16,15,15,15,16,16,17,19,20,21,21,21,21,21,20,19,18,17,16,16,15,
+     15,16,16,17,18,19,20,21,21,21,21,20,20,19,18,17,16,15,15,15,16,17,18,19,
+     20,20,21,21,21,21,20,19,18,17,16,16,15,15,16,16,17,18,19,20,21,21,21,21,
+     21,20,19,17,16,16,15,15,15,16,17,18,19,20,21,22,22,22,21,20,19,18,17,16,
+     15,14,15,15,16,17,18,20,21,22,22,22,22,21,20,18,17,16,14,14,14,14,15,16,
+     18,19,21,23,24,24,24,23,21,19,17,15,13,12,11,11,12,14,17,19,22,25,27,28,
+     28,27,24,21,17,12,8,4,2,1,3,7,15,25,38,54,72,91,111,130,149,166,181,194,
+     204,211,215,217,216,214,211,207,203,199,196,194,193,193,194,196,198,200,202,204,205,206,206,206,
+    },
+    {// ORGAN 1
+     128,131,134,138,141,144,147,150,153,156,160,163,166,169,172,175,178,181,183,186,189,192,195,197,
+     200,202,205,208,210,212,215,217,219,221,223,225,227,229,231,233,235,236,238,240,241,242,244,245,
+     246,247,248,249,250,251,252,252,253,253,254,254,255,255,255,255,255,255,255,255,254,254,254,253,
+     253,252,251,251,250,249,248,247,246,245,244,243,242,240,239,238,236,235,233,232,230,228,227,225,
+     223,221,220,218,216,214,212,210,208,206,204,202,200,198,196,194,192,190,188,186,184,182,180,178,
+     176,174,172,170,168,167,165,163,161,159,157,155,154,152,150,149,147,145,144,142,141,139,138,137,
+     135,134,133,131,130,129,128,127,126,125,124,123,122,122,121,120,120,119,119,118,118,117,117,117,
+     116,116,116,116,116,116,116,116,116,116,116,116,117,117,117,118,118,118,119,119,120,120,121,122,
+     122,123,124,124,125,126,126,127,128,129,130,130,131,132,133,134,135,136,136,137,138,139,140,141,
+     142,143,143,144,145,146,147,148,148,149,150,151,151,152,153,153,154,154,155,156,156,157,157,157,
+     158,158,159,159,159,159,160,160,160,160,160,160,160,160,160,160,160,160,160,159,159,159,159,158,
+     158,157,157,157,156,156,155,154,154,153,152,152,151,150,149,149,148,147,146,145,144,143,142,141,
+     140,139,138,137,136,135,134,133,132,131,130,129,128,127,126,125,124,123,122,121,120,119,118,117,
+     116,115,114,113,112,111,110,109,108,107,107,106,105,104,104,103,102,102,101,100,100,99,99,99,
+     98,98,97,97,97,97,96,96,96,96,96,96,96,96,96,96,96,96,96,97,97,97,97,98,
+     98,99,99,99,100,100,101,102,102,103,103,104,105,105,106,107,108,108,109,110,111,112,113,113,
+     114,115,116,117,118,119,120,120,121,122,123,124,125,126,126,127,128,129,130,130,131,132,132,133,
+     134,134,135,136,136,137,137,138,138,138,139,139,139,140,140,140,140,140,140,140,140,140,140,140,
+     140,139,139,139,138,138,137,137,136,136,135,134,134,133,132,131,130,129,128,127,126,125,123,122,
+     121,119,118,117,115,114,112,111,109,107,106,104,102,101,99,97,95,93,91,89,88,86,84,82,
+     80,78,76,74,72,70,68,66,64,62,60,58,56,54,52,50,48,46,44,42,40,38,36,35,
+     33,31,29,28,26,24,23,21,20,18,17,16,14,13,12,11,10,9,8,7,6,5,5,4,
+     3,3,2,2,2,1,1,1,1,1,1,1,1,2,2,3,3,4,4,5,6,7,8,9,
+     10,11,12,14,15,16,18,20,21,23,25,27,29,31,33,35,37,39,41,44,46,48,51,54,
+     56,59,61,64,67,70,73,75,78,81,84,87,90,93,96,100,103,106,109,112,115,118,122,125,
+    },
+    {// ORGAN 2
+     128,137,147,155,164,171,178,184,189,193,196,198,198,198,197,195,192,189,185,182,178,174,171,168,
+     166,164,163,164,165,167,170,174,179,184,190,197,204,211,218,225,231,237,243,247,251,253,255,255,
+     254,252,249,245,240,234,228,221,214,207,199,192,186,180,174,169,166,163,161,160,160,161,163,166,
+     169,173,177,181,185,189,193,196,198,199,200,200,199,196,193,188,183,177,170,162,154,146,138,130,
+     122,114,107,101,96,91,88,85,84,84,85,87,90,94,98,103,108,113,119,124,129,133,137,140,
+     142,143,143,142,140,138,134,130,125,120,114,109,103,97,92,88,84,81,78,77,77,78,80,83,
+     88,93,99,105,113,120,128,136,144,151,158,164,170,174,178,181,182,183,182,181,179,176,172,168,
+     164,159,154,150,146,143,140,138,137,136,137,139,142,145,150,155,161,168,175,182,189,196,203,209,
+     215,220,224,227,229,229,229,228,225,222,218,213,207,201,195,188,182,176,170,165,160,157,154,152,
+     151,152,153,155,158,162,166,171,176,181,186,191,196,200,203,206,208,209,208,207,205,201,197,192,
+     186,179,172,165,157,150,143,136,130,124,119,116,113,111,110,111,112,115,118,122,126,131,137,142,
+     148,153,158,162,165,168,170,171,171,169,167,164,160,155,150,144,138,131,125,118,112,107,102,98,
+     95,92,91,91,92,94,96,100,105,110,116,122,128,134,140,146,151,156,160,162,164,165,165,164,
+     161,158,154,149,144,138,131,125,118,112,106,101,96,92,89,87,85,85,86,88,91,94,98,103,
+     108,114,119,125,130,134,138,141,144,145,146,145,143,140,137,132,126,120,113,106,99,91,84,77,
+     70,64,59,55,51,49,48,47,48,50,53,56,60,65,70,75,80,85,90,94,98,101,103,104,
+     105,104,102,99,96,91,86,80,74,68,61,55,49,43,38,34,31,28,27,27,27,29,32,36,
+     41,47,53,60,67,74,81,88,95,101,106,111,114,117,119,120,119,118,116,113,110,106,102,97,
+     92,88,84,80,77,75,74,73,74,75,78,82,86,92,98,105,112,120,128,136,143,151,157,163,
+     168,173,176,178,179,179,178,175,172,168,164,159,153,147,142,136,131,126,122,118,116,114,113,113,
+     114,116,119,123,127,132,137,143,148,153,158,162,166,169,171,172,172,171,168,165,160,155,149,142,
+     134,126,118,110,102,94,86,79,73,68,63,60,57,56,56,57,58,60,63,67,71,75,79,83,
+     87,90,93,95,96,96,95,93,90,87,82,76,70,64,57,49,42,35,28,22,16,11,7,4,
+     2,1,1,3,5,9,13,19,25,31,38,45,52,59,66,72,77,82,86,89,91,92,93,92,
+     90,88,85,82,78,74,71,67,64,61,59,58,58,58,60,63,67,72,78,85,92,101,109,119,
+    },
+    {// ORGAN 3
+     128,132,136,140,144,148,152,156,160,164,168,171,175,179,182,186,190,193,196,200,203,206,209,212,
+     215,218,221,223,226,229,231,233,235,237,239,241,243,244,246,247,249,250,251,252,253,253,254,254,
+     255,255,255,255,255,255,254,254,253,253,252,251,250,249,248,247,246,244,243,241,240,238,236,234,
+     232,230,228,226,224,222,220,217,215,213,210,208,206,203,201,198,196,193,191,188,186,183,181,178,
+     176,173,171,168,166,164,161,159,157,155,153,150,148,146,144,142,141,139,137,135,134,132,131,129,
+     128,127,125,124,123,122,121,120,120,119,118,117,117,116,116,116,115,115,115,115,115,115,115,115,
+     115,115,116,116,116,117,117,117,118,119,119,120,120,121,122,123,123,124,125,126,126,127,128,129,
+     130,130,131,132,133,134,135,135,136,137,138,138,139,140,140,141,142,142,143,143,144,144,145,145,
+     145,146,146,146,147,147,147,147,147,147,147,147,147,147,147,147,146,146,146,146,145,145,144,144,
+     144,143,143,142,141,141,140,140,139,138,138,137,136,136,135,134,134,133,132,132,131,130,129,129,
+     128,127,127,126,125,125,124,124,123,122,122,121,121,120,120,119,119,119,118,118,118,118,117,117,
+     117,117,117,117,117,117,117,117,117,117,117,117,117,118,118,118,118,119,119,119,120,120,121,121,
+     122,122,122,123,124,124,125,125,126,126,127,127,128,129,129,130,130,131,131,132,132,133,134,134,
+     134,135,135,136,136,137,137,137,138,138,138,138,139,139,139,139,139,139,139,139,139,139,139,139,
+     139,139,139,138,138,138,138,137,137,137,136,136,135,135,134,134,133,132,132,131,131,130,129,129,
+     128,127,127,126,125,124,124,123,122,122,121,120,120,119,118,118,117,116,116,115,115,114,113,113,
+     112,112,112,111,111,110,110,110,110,109,109,109,109,109,109,109,109,109,109,109,109,110,110,110,
+     111,111,111,112,112,113,113,114,114,115,116,116,117,118,118,119,120,121,121,122,123,124,125,126,
+     126,127,128,129,130,130,131,132,133,133,134,135,136,136,137,137,138,139,139,139,140,140,140,141,
+     141,141,141,141,141,141,141,141,141,140,140,140,139,139,138,137,136,136,135,134,133,132,131,129,
+     128,127,125,124,122,121,119,117,115,114,112,110,108,106,103,101,99,97,95,92,90,88,85,83,
+     80,78,75,73,70,68,65,63,60,58,55,53,50,48,46,43,41,39,36,34,32,30,28,26,
+     24,22,20,18,16,15,13,12,10,9,8,7,6,5,4,3,3,2,2,1,1,1,1,1,
+     1,2,2,3,3,4,5,6,7,9,10,12,13,15,17,19,21,23,25,27,30,33,35,38,
+     41,44,47,50,53,56,60,63,66,70,74,77,81,85,88,92,96,100,104,108,112,116,120,124,
+    },
+    {// ORGAN 4
+     128,137,146,155,162,170,176,181,185,187,188,188,187,185,181,177,171,166,159,153,147,141,135,130,
+     126,123,121,120,121,122,125,130,135,141,149,157,165,174,183,191,200,208,215,221,226,230,233,234,
+     235,233,231,228,223,218,212,205,198,191,184,178,172,167,162,159,157,156,157,158,161,165,170,177,
+     183,191,199,207,215,223,230,237,243,247,251,254,255,255,254,251,247,242,236,230,223,215,207,199,
+     192,185,178,173,168,164,162,161,161,163,165,169,174,179,186,193,200,207,214,221,227,232,237,241,
+     243,244,244,242,240,236,231,224,217,210,202,193,185,176,168,161,154,148,144,140,138,137,137,138,
+     141,145,149,155,161,167,174,181,187,193,199,204,207,210,211,211,210,208,204,199,193,186,179,171,
+     162,153,145,136,129,121,115,110,105,102,100,100,101,103,106,110,116,121,128,135,141,148,155,161,
+     166,170,173,176,177,176,175,172,168,163,157,150,142,134,126,117,109,102,94,88,82,78,75,73,
+     72,73,75,78,82,87,93,100,107,114,122,129,136,142,147,152,155,157,158,158,156,153,149,144,
+     138,132,124,117,109,101,94,87,81,75,71,68,66,65,66,68,71,75,80,87,94,101,109,117,
+     125,132,139,146,151,156,159,161,162,161,160,157,153,148,142,135,128,121,114,107,100,94,88,84,
+     81,78,77,78,79,82,86,91,97,104,112,120,128,136,144,152,159,165,170,174,177,178,179,178,
+     175,172,168,162,156,149,142,135,128,121,114,108,103,99,96,95,94,95,97,100,105,110,117,124,
+     131,139,147,155,162,169,176,181,185,188,190,191,190,188,185,181,175,169,162,155,147,139,132,124,
+     118,112,107,103,100,98,98,99,101,104,109,114,120,127,134,142,149,156,163,169,174,178,181,183,
+     184,183,181,178,174,168,162,154,147,139,130,122,114,106,99,93,88,84,81,80,79,80,83,86,
+     90,95,101,108,115,121,128,135,140,146,150,153,155,156,156,154,151,146,141,135,127,120,111,103,
+     94,85,77,70,63,57,52,48,46,45,45,46,49,52,57,63,69,75,82,89,95,101,107,111,
+     115,118,119,119,118,116,112,108,102,95,88,80,71,63,54,46,39,32,25,20,16,14,12,12,
+     13,15,19,24,29,35,42,49,56,63,70,77,82,87,91,93,95,95,94,92,88,83,78,71,
+     64,57,49,41,33,26,20,14,9,5,2,1,1,2,5,9,13,19,26,33,41,49,57,65,
+     73,79,86,91,95,98,99,100,99,97,94,89,84,78,72,65,58,51,44,38,33,28,25,23,
+     21,22,23,26,30,35,41,48,56,65,73,82,91,99,107,115,121,126,131,134,135,136,135,133,
+     130,126,121,115,109,103,97,90,85,79,75,71,69,68,68,69,71,75,80,86,94,101,110,119,
+    },
+    {// ORGAN 5
+     128,142,156,170,183,195,207,217,226,234,241,247,251,253,255,255,254,252,249,245,240,235,230,224,
+     218,212,206,200,195,190,186,182,179,177,175,173,172,172,172,173,173,174,175,176,177,178,179,179,
+     180,180,180,179,179,178,177,176,174,173,172,171,170,169,168,168,167,168,168,169,170,171,172,174,
+     176,178,179,181,182,183,184,185,185,184,183,182,180,178,175,172,168,164,160,156,152,148,144,140,
+     137,134,131,129,128,127,127,128,129,131,133,136,139,142,146,150,154,157,160,163,166,168,169,170,
+     170,169,167,165,162,158,154,150,145,139,134,129,123,118,113,109,105,102,100,98,98,98,99,100,
+     103,106,109,114,118,123,128,133,138,143,147,151,154,157,159,160,160,160,159,157,154,151,147,143,
+     139,134,129,125,120,116,112,109,106,104,103,102,102,103,105,107,110,114,118,122,127,132,136,141,
+     146,150,154,157,160,163,164,165,166,166,165,164,162,159,157,154,151,148,145,141,139,136,134,132,
+     131,130,129,129,129,130,132,133,135,137,139,142,144,146,148,150,152,153,154,155,155,155,155,155,
+     154,153,151,150,149,147,146,145,144,143,142,141,141,141,141,141,141,142,142,142,142,142,142,141,
+     139,137,135,132,128,124,119,113,107,101,94,86,79,72,64,57,50,44,39,34,30,28,26,26,
+     27,29,33,38,44,52,60,70,81,92,104,116,128,140,152,164,175,186,196,204,212,218,223,227,
+     229,230,230,228,226,222,217,212,206,199,192,184,177,170,162,155,149,143,137,132,128,124,121,119,
+     117,115,114,114,114,114,114,114,115,115,115,115,115,115,114,113,112,111,110,109,107,106,105,103,
+     102,101,101,101,101,101,102,103,104,106,108,110,112,114,117,119,121,123,124,126,127,127,127,126,
+     125,124,122,120,117,115,111,108,105,102,99,97,94,92,91,90,90,91,92,93,96,99,102,106,
+     110,115,120,124,129,134,138,142,146,149,151,153,154,154,153,152,150,147,144,140,136,131,127,122,
+     117,113,109,105,102,99,97,96,96,96,97,99,102,105,109,113,118,123,128,133,138,142,147,150,
+     153,156,157,158,158,158,156,154,151,147,143,138,133,127,122,117,111,106,102,98,94,91,89,87,
+     86,86,87,88,90,93,96,99,102,106,110,114,117,120,123,125,127,128,129,129,128,127,125,122,
+     119,116,112,108,104,100,96,92,88,84,81,78,76,74,73,72,71,71,72,73,74,75,77,78,
+     80,82,84,85,86,87,88,88,89,88,88,87,86,85,84,83,82,80,79,78,77,77,76,76,
+     76,77,77,78,79,80,81,82,83,83,84,84,84,83,81,79,77,74,70,66,61,56,50,44,
+     38,32,26,21,16,11,7,4,2,1,1,3,5,9,15,22,30,39,49,61,73,86,100,114,
+    },
+    {// ORGAN 6
+     128,134,141,147,153,160,166,172,178,183,189,195,200,205,210,215,219,223,227,231,235,238,241,244,
+     246,248,250,252,253,254,255,255,255,255,254,254,253,251,250,248,246,244,242,239,236,233,230,227,
+     223,220,216,212,208,204,200,196,192,188,184,180,176,172,168,165,161,157,154,150,147,144,141,138,
+     135,133,130,128,126,124,122,121,120,119,118,117,116,116,116,116,116,116,117,117,118,119,120,121,
+     122,124,125,126,128,130,131,133,135,136,138,140,142,143,145,147,148,150,151,153,154,155,156,157,
+     158,159,159,160,160,160,160,160,160,160,159,159,158,157,156,155,154,152,151,149,148,146,144,142,
+     140,138,136,134,132,130,128,126,124,122,120,118,116,114,112,110,108,107,105,104,102,101,100,99,
+     98,97,97,96,96,96,96,96,96,96,97,97,98,99,100,101,102,103,105,106,108,109,111,113,
+     114,116,118,120,121,123,125,126,128,130,131,132,134,135,136,137,138,139,139,140,140,140,140,140,
+     140,139,138,137,136,135,134,132,130,128,126,123,121,118,115,112,109,106,102,99,95,91,88,84,
+     80,76,72,68,64,60,56,52,48,44,40,36,33,29,26,23,20,17,14,12,10,8,6,5,
+     3,2,2,1,1,1,1,2,3,4,6,8,10,12,15,18,21,25,29,33,37,41,46,51,
+     56,61,67,73,78,84,90,96,103,109,115,122,128,134,141,147,153,160,166,172,178,183,189,195,
+     200,205,210,215,219,223,227,231,235,238,241,244,246,248,250,252,253,254,255,255,255,255,254,254,
+     253,251,250,248,246,244,242,239,236,233,230,227,223,220,216,212,208,204,200,196,192,188,184,180,
+     176,172,168,165,161,157,154,150,147,144,141,138,135,133,130,128,126,124,122,121,120,119,118,117,
+     116,116,116,116,116,116,117,117,118,119,120,121,122,124,125,126,128,130,131,133,135,136,138,140,
+     142,143,145,147,148,150,151,153,154,155,156,157,158,159,159,160,160,160,160,160,160,160,159,159,
+     158,157,156,155,154,152,151,149,148,146,144,142,140,138,136,134,132,130,128,126,124,122,120,118,
+     116,114,112,110,108,107,105,104,102,101,100,99,98,97,97,96,96,96,96,96,96,96,97,97,
+     98,99,100,101,102,103,105,106,108,109,111,113,114,116,118,120,121,123,125,126,128,130,131,132,
+     134,135,136,137,138,139,139,140,140,140,140,140,140,139,138,137,136,135,134,132,130,128,126,123,
+     121,118,115,112,109,106,102,99,95,91,88,84,80,76,72,68,64,60,56,52,48,44,40,36,
+     33,29,26,23,20,17,14,12,10,8,6,5,3,2,2,1,1,1,1,2,3,4,6,8,
+     10,12,15,18,21,25,29,33,37,41,46,51,56,61,67,73,78,84,90,96,103,109,115,122,
+    },
+    {// ORGAN 7
+     128,133,138,143,148,152,157,161,165,169,173,177,180,183,186,188,191,193,194,196,197,198,198,199,
+     199,199,199,199,199,198,198,197,196,196,195,195,195,194,194,194,194,195,195,196,197,198,199,200,
+     202,204,206,208,210,213,216,218,221,224,227,229,232,235,238,240,243,245,247,249,251,252,253,254,
+     255,255,255,255,254,253,252,251,249,247,245,242,239,237,234,230,227,224,220,217,213,210,206,203,
+     200,197,194,191,188,186,183,181,180,178,177,176,175,174,174,174,174,174,174,175,175,176,177,178,
+     179,180,181,181,182,183,183,184,184,184,184,184,183,182,181,180,179,177,175,173,171,168,165,163,
+     160,156,153,150,146,143,140,136,133,130,127,124,121,118,116,113,111,110,108,107,106,105,105,105,
+     105,106,106,107,109,110,112,113,115,118,120,122,124,127,129,132,134,136,138,140,142,144,145,147,
+     148,148,149,150,150,150,149,149,148,147,146,145,143,142,140,138,136,134,132,130,128,126,125,123,
+     121,120,119,118,117,116,116,115,116,116,116,117,118,119,121,123,125,127,129,131,134,136,139,142,
+     144,147,149,152,154,157,159,161,163,164,166,167,168,169,169,169,169,168,168,167,165,164,162,160,
+     158,156,154,151,149,146,143,140,138,135,132,130,127,125,123,121,119,118,116,115,114,114,113,113,
+     113,113,114,115,116,117,118,119,121,123,124,126,128,130,132,133,135,137,138,139,140,141,142,143,
+     143,143,143,142,142,141,140,138,137,135,133,131,129,126,124,121,118,116,113,110,107,105,102,100,
+     98,96,94,92,91,89,88,88,87,87,87,87,88,89,90,92,93,95,97,99,102,104,107,109,
+     112,114,117,120,122,125,127,129,131,133,135,137,138,139,140,140,140,141,140,140,139,138,137,136,
+     135,133,131,130,128,126,124,122,120,118,116,114,113,111,110,109,108,107,107,106,106,106,107,108,
+     108,109,111,112,114,116,118,120,122,124,127,129,132,134,136,138,141,143,144,146,147,149,150,150,
+     151,151,151,151,150,149,148,146,145,143,140,138,135,132,129,126,123,120,116,113,110,106,103,100,
+     96,93,91,88,85,83,81,79,77,76,75,74,73,72,72,72,72,72,73,73,74,75,75,76,
+     77,78,79,80,81,81,82,82,82,82,82,82,81,80,79,78,76,75,73,70,68,65,62,59,
+     56,53,50,46,43,39,36,32,29,26,22,19,17,14,11,9,7,5,4,3,2,1,1,1,
+     1,2,3,4,5,7,9,11,13,16,18,21,24,27,29,32,35,38,40,43,46,48,50,52,
+     54,56,57,58,59,60,61,61,62,62,62,62,61,61,61,60,60,59,58,58,57,57,57,57,
+     57,57,58,58,59,60,62,63,65,68,70,73,76,79,83,87,91,95,99,104,108,113,118,123,
+    },
+    {// ORGAN 8
+     128,141,154,166,178,189,199,209,217,224,230,234,238,240,241,241,240,238,235,232,229,225,222,218,
+     215,212,209,207,206,205,206,206,208,210,213,216,220,224,228,233,237,241,245,248,251,253,254,255,
+     255,254,253,251,248,244,241,236,232,227,223,219,214,210,207,204,202,200,199,199,199,200,202,204,
+     206,209,211,214,217,220,223,225,226,227,228,227,226,224,222,218,214,210,205,199,193,187,181,175,
+     169,164,159,154,150,146,143,141,139,139,138,139,139,141,142,143,145,147,148,149,149,149,148,147,
+     145,142,138,134,129,123,117,110,104,97,90,83,77,71,66,62,59,57,56,56,57,60,64,69,
+     75,82,90,99,108,118,128,138,148,157,166,175,182,189,195,199,202,204,205,205,204,202,199,195,
+     190,185,180,174,169,163,158,154,150,146,143,141,140,140,140,141,143,146,148,152,155,159,162,166,
+     169,172,174,176,177,178,178,177,176,173,171,168,164,160,156,152,148,144,141,137,135,132,131,130,
+     130,130,132,134,136,139,143,146,150,155,159,163,166,170,173,175,177,178,178,177,176,174,172,168,
+     165,160,156,151,147,142,137,133,129,126,123,121,119,118,118,118,119,121,123,125,127,130,133,135,
+     138,139,141,142,142,141,140,138,135,131,126,121,116,110,103,97,91,84,78,73,68,64,61,59,
+     58,58,59,62,66,71,77,84,91,100,109,118,128,138,147,156,165,172,179,185,190,194,197,198,
+     198,197,195,192,188,183,178,172,165,159,153,146,140,135,130,125,121,118,116,115,114,114,115,117,
+     118,121,123,126,129,131,133,135,137,138,138,138,137,135,133,130,127,123,119,114,109,105,100,96,
+     91,88,84,82,80,79,78,78,79,81,83,86,90,93,97,101,106,110,113,117,120,122,124,126,
+     126,126,125,124,121,119,115,112,108,104,100,96,92,88,85,83,80,79,78,78,79,80,82,84,
+     87,90,94,97,101,104,108,110,113,115,116,116,116,115,113,110,106,102,98,93,87,82,76,71,
+     66,61,57,54,52,51,51,52,54,57,61,67,74,81,90,99,108,118,128,138,148,157,166,174,
+     181,187,192,196,199,200,200,199,197,194,190,185,179,173,166,159,152,146,139,133,127,122,118,114,
+     111,109,108,107,107,107,108,109,111,113,114,115,117,117,118,117,117,115,113,110,106,102,97,92,
+     87,81,75,69,63,57,51,46,42,38,34,32,30,29,28,29,30,31,33,36,39,42,45,47,
+     50,52,54,56,57,57,57,56,54,52,49,46,42,37,33,29,24,20,15,12,8,5,3,2,
+     1,1,2,3,5,8,11,15,19,23,28,32,36,40,43,46,48,50,50,51,50,49,47,44,
+     41,38,34,31,27,24,21,18,16,15,15,16,18,22,26,32,39,47,57,67,78,90,102,115,
+    },
+    {// FORM 2
+     128,136,144,152,159,165,171,175,179,183,185,187,189,191,192,194,195,197,200,202,205,208,211,214,
+     216,219,222,224,226,228,230,231,232,234,235,236,237,239,240,242,243,245,246,248,249,250,251,252,
+     253,253,253,253,254,254,254,254,254,254,255,255,255,255,255,255,255,254,254,253,252,251,250,249,
+     248,247,246,246,245,244,243,242,241,240,239,237,236,235,233,231,230,228,226,225,223,222,220,219,
+     217,216,214,213,211,210,208,206,204,203,201,199,197,195,193,192,190,189,187,186,184,183,181,180,
+     178,176,175,173,172,170,168,167,165,164,163,161,160,159,158,157,156,155,153,152,151,150,149,148,
+     147,146,145,144,143,142,141,140,140,139,138,138,137,137,136,135,135,134,133,133,132,132,131,131,
+     131,130,130,130,130,129,129,129,129,128,128,128,128,127,127,127,127,127,127,127,127,127,127,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+     130,130,130,130,130,130,130,130,130,130,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,126,126,126,126,126,126,126,126,126,
+     126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,129,129,129,129,129,129,129,129,129,129,128,128,128,128,127,127,127,127,126,126,126,126,
+     125,125,125,124,124,123,123,122,121,121,120,119,119,118,118,117,116,116,115,114,113,112,111,110,
+     109,108,107,106,105,104,103,101,100,99,98,97,96,95,93,92,91,89,88,86,84,83,81,80,
+     78,76,75,73,72,70,69,67,66,64,63,61,59,57,55,53,52,50,48,46,45,43,42,40,
+     39,37,36,34,33,31,30,28,26,25,23,21,20,19,17,16,15,14,13,12,11,10,10,9,
+     8,7,6,5,4,3,2,2,1,1,1,1,1,1,1,2,2,2,2,2,2,3,3,3,
+     3,4,5,6,7,8,10,11,13,14,16,17,19,20,21,22,24,25,26,28,30,32,34,37,
+     40,42,45,48,51,54,56,59,61,62,64,65,67,69,71,73,77,81,85,91,97,104,112,120,
+    },
+    {// FORM 3
+     128,137,145,153,160,167,173,179,183,187,191,194,196,199,201,203,206,209,211,214,217,221,224,227,
+     230,233,235,238,240,242,243,244,246,247,248,248,249,250,251,252,253,253,254,255,255,255,255,255,
+     254,253,252,251,250,249,248,246,245,244,242,241,239,238,236,235,233,231,228,226,224,221,218,216,
+     213,211,208,206,203,201,198,196,193,191,188,185,183,180,177,174,172,169,166,164,161,158,156,154,
+     152,149,147,145,143,141,139,137,135,133,131,129,127,125,123,122,120,119,118,117,116,115,114,113,
+     112,111,110,109,108,107,107,106,106,105,105,105,105,104,104,104,105,105,105,105,105,105,105,105,
+     106,106,106,106,107,107,108,109,109,110,110,111,112,112,113,114,114,115,115,116,116,117,118,118,
+     119,120,121,121,122,123,124,124,125,125,126,126,127,127,128,128,129,129,130,130,131,131,132,132,
+     133,133,134,134,134,135,135,135,135,135,136,136,136,136,136,137,137,137,137,137,138,138,138,138,
+     138,138,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,137,136,136,136,136,136,
+     136,135,135,135,135,135,135,135,135,135,135,134,134,134,134,134,133,133,133,133,133,133,132,132,
+     132,132,132,132,132,132,132,131,131,131,131,131,130,130,130,130,130,130,130,130,130,130,130,130,
+     129,129,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,
+     127,126,126,126,126,126,126,126,126,126,126,126,126,125,125,125,125,125,124,124,124,124,124,124,
+     124,124,124,123,123,123,123,123,123,122,122,122,122,122,121,121,121,121,121,121,121,121,121,121,
+     120,120,120,120,120,120,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,119,118,
+     118,118,118,118,118,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,123,
+     123,124,124,125,125,126,126,127,127,128,128,129,129,130,130,131,131,132,132,133,134,135,135,136,
+     137,138,138,139,140,140,141,141,142,142,143,144,144,145,146,146,147,147,148,149,149,150,150,150,
+     150,151,151,151,151,151,151,151,151,152,152,152,151,151,151,151,150,150,149,149,148,147,146,145,
+     144,143,142,141,140,139,138,137,136,134,133,131,129,127,125,123,121,119,117,115,113,111,109,107,
+     104,102,100,98,95,92,90,87,84,82,79,76,73,71,68,65,63,60,58,55,53,50,48,45,
+     43,40,38,35,32,30,28,25,23,21,20,18,17,15,14,12,11,10,8,7,6,5,4,3,
+     2,1,1,1,1,1,2,3,3,4,5,6,7,8,8,9,10,12,13,14,16,18,21,23,
+     26,29,32,35,39,42,45,47,50,53,55,57,60,62,65,69,73,77,83,89,96,103,111,119,
+    },
+    {// FORM 4
+     128,137,147,155,164,172,179,185,190,195,200,203,207,210,213,216,219,222,225,228,231,235,238,241,
+     244,246,249,251,252,253,254,255,255,255,255,255,254,254,253,253,252,251,250,249,248,246,244,242,
+     239,236,233,230,227,224,221,217,214,211,207,204,200,197,193,190,186,182,178,174,170,166,162,158,
+     154,150,147,143,140,136,133,130,127,124,121,118,115,113,110,107,105,102,100,98,96,95,93,92,
+     91,89,89,88,87,86,86,85,85,85,85,85,85,85,85,86,86,87,88,89,90,91,92,93,
+     95,96,97,98,100,101,103,104,105,107,109,110,112,114,115,117,119,120,122,124,125,127,128,129,
+     131,132,133,134,136,137,138,139,141,142,143,144,145,146,147,147,148,148,149,149,150,150,151,151,
+     151,151,152,152,152,152,152,152,152,152,152,152,152,151,151,151,150,150,150,149,149,149,148,148,
+     148,147,147,146,146,145,145,144,144,143,142,142,141,141,141,140,140,139,139,139,138,138,137,137,
+     136,136,135,135,135,134,134,134,133,133,133,133,133,132,132,132,132,131,131,131,131,130,130,130,
+     130,130,130,130,130,130,130,130,130,130,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,129,129,129,129,129,129,129,129,129,128,128,128,128,128,128,128,129,129,129,129,129,129,
+     129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     127,127,127,127,127,127,127,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,127,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,126,126,126,126,126,126,126,126,126,
+     126,126,126,126,125,125,125,125,124,124,124,124,123,123,123,123,123,122,122,122,121,121,121,120,
+     120,119,119,118,118,117,117,117,116,116,115,115,115,114,114,113,112,112,111,111,110,110,109,109,
+     108,108,108,107,107,107,106,106,106,105,105,105,104,104,104,104,104,104,104,104,104,104,104,105,
+     105,105,105,106,106,107,107,108,108,109,109,110,111,112,113,114,115,117,118,119,120,122,123,124,
+     125,127,128,129,131,132,134,136,137,139,141,142,144,146,147,149,151,152,153,155,156,158,159,160,
+     161,163,164,165,166,167,168,169,170,170,171,171,171,171,171,171,171,171,170,170,169,168,167,167,
+     165,164,163,161,160,158,156,154,151,149,146,143,141,138,135,132,129,126,123,120,116,113,109,106,
+     102,98,94,90,86,82,78,74,70,66,63,59,56,52,49,45,42,39,35,32,29,26,23,20,
+     17,14,12,10,8,7,6,5,4,3,3,2,2,1,1,1,1,1,2,3,4,5,7,10,
+     12,15,18,21,25,28,31,34,37,40,43,46,49,53,56,61,66,71,77,84,92,101,109,119,
+    },
+    {// FORM 6
+     128,139,150,161,171,181,189,197,204,211,216,221,225,229,233,236,239,242,244,247,249,251,253,254,
+     255,255,255,254,252,250,248,245,241,238,233,229,224,220,215,210,204,199,194,188,182,176,170,164,
+     158,151,145,138,132,126,120,115,109,104,100,95,91,87,84,80,77,74,72,69,67,66,64,63,
+     63,62,63,63,64,65,67,69,71,73,76,79,81,84,88,91,94,98,102,105,109,113,117,121,
+     126,130,134,138,142,145,149,152,156,159,162,164,167,169,172,174,176,177,179,180,182,183,183,184,
+     184,184,184,184,183,182,181,180,179,178,177,175,174,172,170,169,167,165,163,161,159,156,154,152,
+     150,148,145,143,141,140,138,136,134,133,131,130,129,127,126,125,124,123,122,121,120,120,119,119,
+     119,119,119,119,119,119,119,120,120,120,121,121,121,122,123,123,124,124,125,126,127,127,128,129,
+     130,131,131,132,132,133,134,134,135,135,135,136,136,137,137,138,138,138,138,139,139,139,139,139,
+     139,139,139,139,139,138,138,138,138,138,138,138,137,137,137,137,136,136,136,135,135,135,134,134,
+     134,133,133,133,133,133,132,132,132,132,132,131,131,131,131,130,130,130,130,130,129,129,129,129,
+     129,129,129,129,129,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,
+     127,127,127,127,127,126,126,126,126,126,125,125,125,125,124,124,124,124,124,123,123,123,123,123,
+     122,122,122,121,121,121,120,120,120,119,119,119,119,118,118,118,118,118,118,118,117,117,117,117,
+     117,117,117,117,117,117,118,118,118,118,119,119,120,120,121,121,121,122,122,123,124,124,125,125,
+     126,127,128,129,129,130,131,132,132,133,133,134,135,135,135,136,136,136,137,137,137,137,137,137,
+     137,137,137,136,136,135,134,133,132,131,130,129,127,126,125,123,122,120,118,116,115,113,111,108,
+     106,104,102,100,97,95,93,91,89,87,86,84,82,81,79,78,77,76,75,74,73,72,72,72,
+     72,72,73,73,74,76,77,79,80,82,84,87,89,92,94,97,100,104,107,111,114,118,122,126,
+     130,135,139,143,147,151,154,158,162,165,168,172,175,177,180,183,185,187,189,191,192,193,193,194,
+     193,193,192,190,189,187,184,182,179,176,172,169,165,161,156,152,147,141,136,130,124,118,111,105,
+     98,92,86,80,74,68,62,57,52,46,41,36,32,27,23,18,15,11,8,6,4,2,1,1,
+     1,2,3,5,7,9,12,14,17,20,23,27,31,35,40,45,52,59,67,75,85,95,106,117,
+    },
+    {// FORM 8
+     128,142,155,168,180,192,202,212,220,228,234,239,244,247,250,252,254,255,255,255,254,253,251,248,
+     245,241,236,230,224,217,210,201,193,184,175,167,158,149,140,132,124,116,108,101,94,87,81,75,
+     70,65,61,58,55,53,51,51,51,52,53,55,58,62,65,70,75,80,85,91,97,103,109,116,
+     122,129,136,142,149,156,162,168,174,179,184,189,193,196,199,202,204,206,207,207,208,207,207,206,
+     204,202,200,197,194,191,187,183,179,175,170,165,161,156,151,147,142,138,134,130,126,123,119,116,
+     113,110,108,106,104,102,101,100,100,99,100,100,101,102,103,104,106,108,110,112,114,116,118,121,
+     123,126,128,131,133,135,138,140,142,144,146,148,150,151,153,154,155,155,156,156,157,157,157,157,
+     156,156,155,155,154,153,152,151,150,149,148,146,145,144,142,141,140,138,137,136,135,134,133,132,
+     131,130,130,129,128,128,127,127,126,126,126,126,126,126,126,126,126,127,127,127,128,128,129,129,
+     129,130,130,130,131,131,132,132,132,133,133,134,134,134,135,135,135,135,135,135,135,135,135,135,
+     135,135,135,135,135,134,134,134,134,134,134,133,133,133,132,132,132,132,131,131,131,131,131,130,
+     130,130,130,130,130,130,129,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,126,126,126,126,126,
+     126,126,125,125,125,125,125,124,124,124,124,123,123,123,122,122,122,122,122,122,121,121,121,121,
+     121,121,121,121,121,121,121,121,121,121,121,122,122,122,123,123,124,124,124,125,125,126,126,126,
+     127,127,127,128,128,129,129,129,130,130,130,130,130,130,130,130,130,129,129,128,128,127,126,126,
+     125,124,123,122,121,120,119,118,116,115,114,112,111,110,108,107,106,105,104,103,102,101,101,100,
+     100,99,99,99,99,100,100,101,101,102,103,105,106,108,110,112,114,116,118,121,123,125,128,130,
+     133,135,138,140,142,144,146,148,150,152,153,154,155,156,156,157,156,156,155,154,152,150,148,146,
+     143,140,137,133,130,126,122,118,114,109,105,100,95,91,86,81,77,73,69,65,62,59,56,54,
+     52,50,49,49,48,49,49,50,52,54,57,60,63,67,72,77,82,88,94,100,107,114,120,127,
+     134,140,147,153,159,165,171,176,181,186,191,194,198,201,203,204,205,205,205,203,201,198,195,191,
+     186,181,175,169,162,155,148,140,132,124,116,107,98,89,81,72,63,55,46,39,32,26,20,15,
+     11,8,5,3,2,1,1,1,2,4,6,9,12,17,22,28,36,44,54,64,76,88,101,114,
+    },
+    {// FORM 10
+     128,144,159,174,188,201,212,223,232,239,245,249,253,254,255,255,253,250,247,243,237,231,225,217,
+     209,200,190,179,169,158,146,135,124,113,103,93,85,76,69,63,58,54,51,49,48,48,49,51,
+     54,58,63,68,75,82,89,98,106,115,125,134,144,153,162,171,179,186,193,199,205,209,213,216,
+     218,220,220,220,219,217,214,211,207,202,197,191,184,178,171,163,156,149,141,134,128,121,115,110,
+     105,100,96,93,90,88,86,85,85,85,86,87,89,92,95,98,102,106,111,116,121,125,130,135,
+     140,145,149,153,157,160,163,166,169,171,172,174,174,175,175,175,174,173,171,169,167,165,162,159,
+     156,153,150,147,144,140,138,135,132,130,127,125,123,121,120,119,118,117,116,116,116,116,116,117,
+     118,119,120,122,123,125,126,128,130,131,133,134,136,137,138,140,141,142,143,144,144,145,145,146,
+     146,146,146,146,145,145,144,143,142,142,141,140,139,138,137,136,136,135,134,133,132,132,131,130,
+     130,129,129,128,128,128,128,128,128,128,128,128,129,129,129,129,130,130,130,130,131,131,131,131,
+     132,132,132,133,133,133,133,133,133,133,134,133,133,133,133,133,133,133,132,132,132,132,132,131,
+     131,131,131,131,131,130,130,130,130,129,129,129,129,129,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,126,126,126,126,125,125,125,125,
+     125,125,124,124,124,124,124,123,123,123,123,123,123,123,122,123,123,123,123,123,123,123,124,124,
+     124,125,125,125,125,126,126,126,126,127,127,127,127,128,128,128,128,128,128,128,128,128,127,127,
+     126,126,125,124,124,123,122,121,120,120,119,118,117,116,115,114,114,113,112,111,111,110,110,110,
+     110,110,111,111,112,112,113,114,115,116,118,119,120,122,123,125,126,128,130,131,133,134,136,137,
+     138,139,140,140,140,140,140,139,138,137,136,135,133,131,129,126,124,121,118,116,112,109,106,103,
+     100,97,94,91,89,87,85,83,82,81,81,81,82,82,84,85,87,90,93,96,99,103,107,111,
+     116,121,126,131,135,140,145,150,154,158,161,164,167,169,170,171,171,171,170,168,166,163,160,156,
+     151,146,141,135,128,122,115,107,100,93,85,78,72,65,59,54,49,45,42,39,37,36,36,36,
+     38,40,43,47,51,57,63,70,77,85,94,103,112,122,131,141,150,158,167,174,181,188,193,198,
+     202,205,207,208,208,207,205,202,198,193,187,180,171,163,153,143,132,121,110,98,87,77,66,56,
+     47,39,31,25,19,13,9,6,3,1,1,2,3,7,11,17,24,33,44,55,68,82,97,112,
+    },
+    {// FORM 12
+     128,146,163,179,195,209,221,232,240,247,252,254,255,254,251,247,241,234,225,216,206,195,183,171,
+     159,146,134,121,109,97,86,76,67,60,54,49,46,45,45,48,51,56,63,71,79,89,99,110,
+     121,133,144,155,166,177,186,196,204,211,217,222,225,228,228,228,226,222,218,212,205,198,189,180,
+     171,161,152,142,132,123,115,107,100,93,87,83,79,76,75,74,75,76,79,82,87,92,98,105,
+     111,119,126,134,141,148,155,161,167,173,177,181,184,187,188,189,189,189,187,185,182,179,175,171,
+     166,161,155,150,145,139,134,129,124,120,116,113,110,108,106,105,105,105,105,106,108,110,112,114,
+     117,120,124,127,130,134,137,141,144,147,149,152,154,156,157,158,158,158,158,157,157,155,154,153,
+     151,149,147,145,143,140,138,136,134,132,130,129,127,126,125,124,123,123,123,123,123,123,124,125,
+     126,127,128,129,130,131,132,133,134,135,136,137,138,139,139,140,140,140,141,141,141,140,140,139,
+     139,138,138,137,136,135,135,134,133,133,132,132,131,131,130,130,129,129,129,129,129,129,128,129,
+     129,129,129,129,130,130,130,131,131,131,131,132,132,132,132,132,132,132,132,132,132,132,132,132,
+     132,132,132,132,131,131,131,131,130,130,130,129,129,129,129,129,129,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,127,127,127,127,127,127,126,126,126,125,125,125,125,124,124,124,
+     124,124,124,124,124,124,124,124,124,124,124,124,124,124,125,125,125,125,126,126,126,127,127,127,
+     127,127,128,127,127,127,127,127,127,126,126,125,125,124,124,123,123,122,121,121,120,119,118,118,
+     117,117,116,116,115,115,115,116,116,116,117,117,118,119,120,121,122,123,124,125,126,127,128,129,
+     130,131,132,133,133,133,133,133,133,132,131,130,129,127,126,124,122,120,118,116,113,111,109,107,
+     105,103,102,101,99,99,98,98,98,98,99,100,102,104,107,109,112,115,119,122,126,129,132,136,
+     139,142,144,146,148,150,151,151,151,151,150,148,146,143,140,136,132,127,122,117,111,106,101,95,
+     90,85,81,77,74,71,69,67,67,67,68,69,72,75,79,83,89,95,101,108,115,122,130,137,
+     145,151,158,164,169,174,177,180,181,182,181,180,177,173,169,163,156,149,141,133,124,114,104,95,
+     85,76,67,58,51,44,38,34,30,28,28,28,31,34,39,45,52,60,70,79,90,101,112,123,
+     135,146,157,167,177,185,193,200,205,208,211,211,210,207,202,196,189,180,170,159,147,135,122,110,
+     97,85,73,61,50,40,31,22,15,9,5,2,1,2,4,9,16,24,35,47,61,77,93,110,
+    },
+    {// FORM 16
+     128,150,171,190,208,224,236,246,252,255,254,250,243,233,221,207,191,174,157,139,122,106,91,78,
+     67,58,51,47,45,46,50,57,66,77,90,104,119,135,152,168,183,197,209,220,228,234,237,237,
+     235,230,223,213,202,189,175,161,146,132,118,105,93,83,75,68,64,62,62,65,69,76,84,94,
+     105,117,129,142,154,166,177,187,195,202,207,210,211,209,206,202,195,188,179,169,159,148,138,128,
+     119,110,102,96,91,88,86,86,87,89,93,98,104,111,119,127,135,144,151,159,165,171,175,179,
+     181,182,182,180,178,174,169,164,159,152,146,140,134,128,123,118,114,111,109,107,107,107,108,110,
+     113,116,120,124,128,133,137,142,146,149,153,155,157,159,159,159,159,157,156,153,151,148,145,142,
+     138,135,132,130,127,125,123,122,121,121,121,121,122,123,124,126,128,130,132,134,136,138,140,141,
+     142,143,144,144,145,144,144,143,142,141,140,138,137,135,134,133,132,131,130,129,128,128,127,127,
+     127,128,128,128,129,130,130,131,132,133,133,134,135,135,136,136,136,136,136,136,135,135,134,134,
+     133,133,132,132,131,131,131,130,130,130,129,129,129,129,129,129,129,129,129,129,130,130,130,130,
+     131,131,131,131,131,131,131,131,131,131,131,130,130,130,130,130,129,129,129,129,129,129,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,127,127,127,127,127,127,126,126,126,126,126,125,125,125,125,125,125,125,125,125,125,
+     125,126,126,126,126,127,127,127,127,127,127,127,127,127,127,126,126,126,125,125,125,124,124,123,
+     123,122,122,121,121,120,120,120,120,120,120,121,121,122,123,123,124,125,126,126,127,128,128,128,
+     129,129,129,128,128,127,126,125,124,123,122,121,119,118,116,115,114,113,112,112,111,112,112,113,
+     114,115,116,118,120,122,124,126,128,130,132,133,134,135,135,135,135,134,133,131,129,126,124,121,
+     118,114,111,108,105,103,100,99,97,97,97,97,99,101,103,107,110,114,119,123,128,132,136,140,
+     143,146,148,149,149,149,147,145,142,138,133,128,122,116,110,104,97,92,87,82,78,76,74,74,
+     75,77,81,85,91,97,105,112,121,129,137,145,152,158,163,167,169,170,170,168,165,160,154,146,
+     137,128,118,108,97,87,77,68,61,54,50,47,45,46,49,54,61,69,79,90,102,114,127,139,
+     151,162,172,180,187,191,194,194,192,188,181,173,163,151,138,124,110,95,81,67,54,43,33,26,
+     21,19,19,22,28,36,47,59,73,88,104,121,137,152,166,179,190,199,206,210,211,209,205,198,
+     189,178,165,150,134,117,99,82,65,49,35,23,13,6,2,1,4,10,20,32,48,66,85,106,
+    },
+    {// SYNC 1.5
+     128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,163,165,167,169,171,173,
+     175,177,178,180,182,184,186,187,189,191,193,194,196,198,199,201,203,204,206,207,209,210,212,213,
+     215,216,218,219,221,222,223,225,226,227,228,230,231,232,233,234,235,236,237,238,239,240,241,242,
+     243,244,245,245,246,247,247,248,249,249,250,250,251,251,252,252,253,253,253,254,254,254,254,255,
+     255,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,253,252,252,251,251,250,250,249,
+     249,248,247,247,246,245,245,244,243,242,241,240,239,238,237,236,235,234,233,232,231,230,228,227,
+     226,225,223,222,221,219,218,216,215,213,212,210,209,207,206,204,203,201,199,198,196,194,193,191,
+     189,187,186,184,182,180,178,177,175,173,171,169,167,165,163,162,160,158,156,154,152,150,148,146,
+     144,142,140,138,136,134,132,130,128,126,124,122,120,118,116,114,112,110,108,106,104,102,100,98,
+     96,94,93,91,89,87,85,83,81,79,78,76,74,72,70,69,67,65,63,62,60,58,57,55,
+     53,52,50,49,47,46,44,43,41,40,38,37,35,34,33,31,30,29,28,26,25,24,23,22,
+     21,20,19,18,17,16,15,14,13,12,11,11,10,9,9,8,7,7,6,6,5,5,4,4,
+     3,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,3,3,
+     3,4,4,5,5,6,6,7,7,8,9,9,10,11,11,12,13,14,15,16,17,18,19,20,
+     21,22,23,24,25,26,28,29,30,31,33,34,35,37,38,40,41,43,44,46,47,49,50,52,
+     53,55,57,58,60,62,63,65,67,69,70,72,74,76,78,79,81,83,85,87,89,91,93,94,
+     96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,128,130,132,134,136,138,140,142,
+     144,146,148,150,152,154,156,158,160,162,163,165,167,169,171,173,175,177,178,180,182,184,186,187,
+     189,191,193,194,196,198,199,201,203,204,206,207,209,210,212,213,215,216,218,219,221,222,223,225,
+     226,227,228,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,245,246,247,247,248,
+     249,249,250,250,251,251,252,252,253,253,253,254,254,254,254,255,255,255,255,255,255,255,255,255,
+     255,255,254,254,254,254,253,253,253,252,252,251,251,250,250,249,249,248,247,247,246,245,245,244,
+     243,242,241,240,239,238,237,236,235,234,233,232,231,230,228,227,226,225,223,222,221,219,218,216,
+     215,213,212,210,209,207,206,204,203,201,199,198,196,194,193,191,189,187,186,184,182,180,178,177,
+     175,173,171,169,167,165,163,162,160,158,156,154,152,150,148,146,144,142,140,138,136,134,132,130,
+    },
+    {// SYNC 2
+     128,131,133,136,139,141,144,147,149,152,154,157,160,162,165,167,170,172,175,177,180,182,184,187,
+     189,192,194,196,198,200,203,205,207,209,211,213,215,217,219,221,222,224,226,228,229,231,232,234,
+     235,237,238,239,241,242,243,244,245,246,247,248,249,250,250,251,252,252,253,253,254,254,254,255,
+     255,255,255,255,255,255,255,255,254,254,254,253,253,252,252,251,250,250,249,248,247,246,245,244,
+     243,242,241,239,238,237,235,234,232,231,229,228,226,224,222,221,219,217,215,213,211,209,207,205,
+     203,200,198,196,194,192,189,187,184,182,180,177,175,172,170,167,165,162,160,157,154,152,149,147,
+     144,141,139,136,133,131,128,125,123,120,117,115,112,109,107,104,102,99,96,94,91,89,86,84,
+     81,79,76,74,72,69,67,65,62,60,58,56,53,51,49,47,45,43,41,39,37,35,34,32,
+     30,28,27,25,24,22,21,19,18,17,15,14,13,12,11,10,9,8,7,6,6,5,4,4,
+     3,3,2,2,2,1,1,1,1,1,1,1,1,1,2,2,2,3,3,4,4,5,6,6,
+     7,8,9,10,11,12,13,14,15,17,18,19,21,22,24,25,27,28,30,32,34,35,37,39,
+     41,43,45,47,49,51,53,56,58,60,62,65,67,69,72,74,76,79,81,84,86,89,91,94,
+     96,99,102,104,107,109,112,115,117,120,123,125,128,131,133,136,139,141,144,147,149,152,154,157,
+     160,162,165,167,170,172,175,177,180,182,184,187,189,191,194,196,198,200,203,205,207,209,211,213,
+     215,217,219,221,222,224,226,228,229,231,232,234,235,237,238,239,241,242,243,244,245,246,247,248,
+     249,250,250,251,252,252,253,253,254,254,254,255,255,255,255,255,255,255,255,255,254,254,254,253,
+     253,252,252,251,250,250,249,248,247,246,245,244,243,242,241,239,238,237,235,234,232,231,229,228,
+     226,224,222,221,219,217,215,213,211,209,207,205,203,200,198,196,194,192,189,187,184,182,180,177,
+     175,172,170,167,165,162,160,157,154,152,149,147,144,141,139,136,133,131,128,125,123,120,117,115,
+     112,109,107,104,102,99,96,94,91,89,86,84,81,79,76,74,72,69,67,64,62,60,58,56,
+     53,51,49,47,45,43,41,39,37,35,34,32,30,28,27,25,24,22,21,19,18,17,15,14,
+     13,12,11,10,9,8,7,6,6,5,4,4,3,3,2,2,2,1,1,1,1,1,1,1,
+     1,1,2,2,2,3,3,4,4,5,6,6,7,8,9,10,11,12,13,14,15,17,18,19,
+     21,22,24,25,27,28,30,32,34,35,37,39,41,43,45,47,49,51,53,56,58,60,62,64,
+     67,69,72,74,76,79,81,84,86,89,91,94,96,99,102,104,107,109,112,115,117,120,123,125,
+    },
+    {// SYNC 2.5
+     128,131,135,138,141,145,148,151,154,158,161,164,167,170,174,177,180,183,186,189,192,194,197,200,
+     203,205,208,210,213,215,218,220,222,225,227,229,231,233,235,236,238,240,241,243,244,245,247,248,
+     249,250,251,251,252,253,253,254,254,255,255,255,255,255,255,255,254,254,253,253,252,251,251,250,
+     249,248,247,245,244,243,241,240,238,236,235,233,231,229,227,225,222,220,218,215,213,210,208,205,
+     203,200,197,194,192,189,186,183,180,177,174,170,167,164,161,158,154,151,148,145,141,138,135,131,
+     128,125,121,118,115,111,108,105,102,98,95,92,89,86,82,79,76,73,70,67,65,62,59,56,
+     53,51,48,46,43,41,38,36,34,31,29,27,25,23,21,20,18,16,15,13,12,11,9,8,
+     7,6,5,5,4,3,3,2,2,1,1,1,1,1,1,1,2,2,3,3,4,5,5,6,
+     7,8,9,11,12,13,15,16,18,20,21,23,25,27,29,31,34,36,38,41,43,46,48,51,
+     53,56,59,62,65,67,70,73,76,79,82,86,89,92,95,98,102,105,108,111,115,118,121,125,
+     128,131,135,138,141,145,148,151,154,158,161,164,167,170,174,177,180,183,186,189,191,194,197,200,
+     203,205,208,210,213,215,218,220,222,225,227,229,231,233,235,236,238,240,241,243,244,245,247,248,
+     249,250,251,251,252,253,253,254,254,255,255,255,255,255,255,255,254,254,253,253,252,251,251,250,
+     249,248,247,245,244,243,241,240,238,236,235,233,231,229,227,225,222,220,218,215,213,210,208,205,
+     203,200,197,194,192,189,186,183,180,177,174,170,167,164,161,158,154,151,148,145,141,138,135,131,
+     128,125,121,118,115,111,108,105,102,98,95,92,89,86,82,79,76,73,70,67,64,62,59,56,
+     53,51,48,46,43,41,38,36,34,31,29,27,25,23,21,20,18,16,15,13,12,11,9,8,
+     7,6,5,5,4,3,3,2,2,1,1,1,1,1,1,1,2,2,3,3,4,5,5,6,
+     7,8,9,11,12,13,15,16,18,20,21,23,25,27,29,31,34,36,38,41,43,46,48,51,
+     53,56,59,62,64,67,70,73,76,79,82,86,89,92,95,98,102,105,108,111,115,118,121,125,
+     128,131,135,138,141,145,148,151,154,158,161,164,167,170,174,177,180,183,186,189,192,194,197,200,
+     203,205,208,210,213,215,218,220,222,225,227,229,231,233,235,236,238,240,241,243,244,245,247,248,
+     249,250,251,251,252,253,253,254,254,255,255,255,255,255,255,255,254,254,253,253,252,251,251,250,
+     249,248,247,245,244,243,241,240,238,236,235,233,231,229,227,225,222,220,218,215,213,210,208,205,
+     203,200,197,194,192,189,186,183,180,177,174,170,167,164,161,158,154,151,148,145,141,138,135,131,
+    },
+    {// SYNC 3
+     128,132,136,140,144,148,152,156,160,163,167,171,175,178,182,186,189,193,196,199,203,206,209,212,
+     215,218,221,223,226,228,231,233,235,237,239,241,243,245,246,247,249,250,251,252,253,253,254,254,
+     255,255,255,255,255,254,254,253,253,252,251,250,249,247,246,245,243,241,239,237,235,233,231,228,
+     226,223,221,218,215,212,209,206,203,199,196,193,189,186,182,178,175,171,167,163,160,156,152,148,
+     144,140,136,132,128,124,120,116,112,108,104,100,96,93,89,85,81,78,74,70,67,63,60,57,
+     53,50,47,44,41,38,35,33,30,28,25,23,21,19,17,15,13,11,10,9,7,6,5,4,
+     3,3,2,2,1,1,1,1,1,2,2,3,3,4,5,6,7,9,10,11,13,15,17,19,
+     21,23,25,28,30,33,35,38,41,44,47,50,53,57,60,63,67,70,74,78,81,85,89,93,
+     96,100,104,108,112,116,120,124,128,132,136,140,144,148,152,156,160,163,167,171,175,178,182,186,
+     189,193,196,199,203,206,209,212,215,218,221,223,226,228,231,233,235,237,239,241,243,245,246,247,
+     249,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,253,252,251,250,249,247,246,245,
+     243,241,239,237,235,233,231,228,226,223,221,218,215,212,209,206,203,199,196,193,189,186,182,178,
+     175,171,167,163,160,156,152,148,144,140,136,132,128,124,120,116,112,108,104,100,96,93,89,85,
+     81,78,74,70,67,63,60,57,53,50,47,44,41,38,35,33,30,28,25,23,21,19,17,15,
+     13,11,10,9,7,6,5,4,3,3,2,2,1,1,1,1,1,2,2,3,3,4,5,6,
+     7,9,10,11,13,15,17,19,21,23,25,28,30,33,35,38,41,44,47,50,53,57,60,63,
+     67,70,74,78,81,85,89,93,96,100,104,108,112,116,120,124,128,132,136,140,144,148,152,156,
+     160,163,167,171,175,178,182,186,189,193,196,199,203,206,209,212,215,218,221,223,226,228,231,233,
+     235,237,239,241,243,245,246,247,249,250,251,252,253,253,254,254,255,255,255,255,255,254,254,253,
+     253,252,251,250,249,247,246,245,243,241,239,237,235,233,231,228,226,223,221,218,215,212,209,206,
+     203,199,196,193,189,186,182,178,175,171,167,163,160,156,152,148,144,140,136,132,128,124,120,116,
+     112,108,104,100,96,93,89,85,81,78,74,70,67,63,60,57,53,50,47,44,41,38,35,33,
+     30,28,25,23,21,19,17,15,13,11,10,9,7,6,5,4,3,3,2,2,1,1,1,1,
+     1,2,2,3,3,4,5,6,7,9,10,11,13,15,17,19,21,23,25,28,30,33,35,38,
+     41,44,47,50,53,57,60,63,67,70,74,78,81,85,89,93,96,100,104,108,112,116,120,124,
+    },
+    {// SYNC 3.5
+     128,133,137,142,147,151,156,160,165,169,174,178,182,186,190,194,198,202,206,209,213,216,220,223,
+     226,229,232,234,237,239,241,243,245,247,248,250,251,252,253,254,254,255,255,255,255,255,254,254,
+     253,252,251,249,248,246,245,243,241,238,236,233,231,228,225,222,219,215,212,208,205,201,197,193,
+     189,185,181,177,172,168,163,159,154,150,145,141,136,131,127,122,117,113,108,104,99,94,90,86,
+     81,77,73,69,65,61,57,53,49,46,42,39,35,32,29,26,24,21,19,16,14,12,10,9,
+     7,6,5,4,3,2,2,1,1,1,1,2,2,3,4,5,6,7,9,10,12,14,16,18,
+     21,23,26,29,32,35,38,42,45,49,52,56,60,64,68,72,76,81,85,89,94,98,103,107,
+     112,117,121,126,131,135,140,145,149,154,158,163,167,172,176,180,184,189,193,197,200,204,208,211,
+     215,218,221,225,228,230,233,236,238,240,242,244,246,248,249,250,252,253,253,254,255,255,255,255,
+     255,254,254,253,252,251,250,249,247,245,243,241,239,237,235,232,229,226,223,220,217,213,210,206,
+     203,199,195,191,187,183,178,174,170,165,161,156,152,147,143,138,133,129,124,119,115,110,106,101,
+     96,92,87,83,79,75,70,66,62,58,54,51,47,44,40,37,34,31,28,25,22,20,17,15,
+     13,11,9,8,6,5,4,3,2,2,1,1,1,1,1,2,2,3,4,5,6,8,9,11,
+     13,15,17,20,22,25,28,31,34,37,40,44,47,51,54,58,62,66,70,75,79,83,87,92,
+     96,101,106,110,115,119,124,129,133,138,143,147,152,156,161,165,170,174,178,183,187,191,195,199,
+     203,206,210,213,217,220,223,226,229,232,235,237,239,241,243,245,247,249,250,251,252,253,254,254,
+     255,255,255,255,255,254,253,253,252,250,249,248,246,244,242,240,238,236,233,230,228,225,221,218,
+     215,211,208,204,200,197,193,189,184,180,176,172,167,163,158,154,149,145,140,135,131,126,121,117,
+     112,107,103,98,94,89,85,81,76,72,68,64,60,56,52,49,45,42,38,35,32,29,26,23,
+     21,18,16,14,12,10,9,7,6,5,4,3,2,2,1,1,1,1,2,2,3,4,5,6,
+     7,9,10,12,14,16,19,21,24,26,29,32,35,39,42,46,49,53,57,61,64,69,73,77,
+     81,86,90,94,99,104,108,113,117,122,127,131,136,141,145,150,154,159,163,168,172,177,181,185,
+     189,193,197,201,205,208,212,215,219,222,225,228,231,233,236,238,241,243,245,246,248,249,251,252,
+     253,254,254,255,255,255,255,255,254,254,253,252,251,250,248,247,245,243,241,239,237,234,232,229,
+     226,223,220,216,213,209,206,202,198,194,190,186,182,178,174,169,165,160,156,151,147,142,137,133,
+    },
+    {// SYNC 4
+     128,133,139,144,149,154,160,165,170,175,180,184,189,194,198,203,207,211,215,219,222,226,229,232,
+     235,238,241,243,245,247,249,250,252,253,254,254,255,255,255,255,254,254,253,252,250,249,247,245,
+     243,241,238,235,232,229,226,222,219,215,211,207,203,198,194,189,184,180,175,170,165,160,154,149,
+     144,139,133,128,123,117,112,107,102,96,91,86,81,76,72,67,62,58,53,49,45,41,37,34,
+     30,27,24,21,18,15,13,11,9,7,6,4,3,2,2,1,1,1,1,2,2,3,4,6,
+     7,9,11,13,15,18,21,24,27,30,34,37,41,45,49,53,58,62,67,72,76,81,86,91,
+     96,102,107,112,117,123,128,133,139,144,149,154,160,165,170,175,180,184,189,194,198,203,207,211,
+     215,219,222,226,229,232,235,238,241,243,245,247,249,250,252,253,254,254,255,255,255,255,254,254,
+     253,252,250,249,247,245,243,241,238,235,232,229,226,222,219,215,211,207,203,198,194,189,184,180,
+     175,170,165,160,154,149,144,139,133,128,123,117,112,107,102,96,91,86,81,76,72,67,62,58,
+     53,49,45,41,37,34,30,27,24,21,18,15,13,11,9,7,6,4,3,2,2,1,1,1,
+     1,2,2,3,4,6,7,9,11,13,15,18,21,24,27,30,34,37,41,45,49,53,58,62,
+     67,72,76,81,86,91,96,102,107,112,117,123,128,133,139,144,149,154,160,165,170,175,180,184,
+     189,194,198,203,207,211,215,219,222,226,229,232,235,238,241,243,245,247,249,250,252,253,254,254,
+     255,255,255,255,254,254,253,252,250,249,247,245,243,241,238,235,232,229,226,222,219,215,211,207,
+     203,198,194,189,184,180,175,170,165,160,154,149,144,139,133,128,123,117,112,107,102,96,91,86,
+     81,76,72,67,62,58,53,49,45,41,37,34,30,27,24,21,18,15,13,11,9,7,6,4,
+     3,2,2,1,1,1,1,2,2,3,4,6,7,9,11,13,15,18,21,24,27,30,34,37,
+     41,45,49,53,58,62,67,72,76,81,86,91,96,102,107,112,117,123,128,133,139,144,149,154,
+     160,165,170,175,180,184,189,194,198,203,207,211,215,219,222,226,229,232,235,238,241,243,245,247,
+     249,250,252,253,254,254,255,255,255,255,254,254,253,252,250,249,247,245,243,241,238,235,232,229,
+     226,222,219,215,211,207,203,198,194,189,184,180,175,170,165,160,154,149,144,139,133,128,123,117,
+     112,107,102,96,91,86,81,76,72,67,62,58,53,49,45,41,37,34,30,27,24,21,18,15,
+     13,11,9,7,6,4,3,2,2,1,1,1,1,2,2,3,4,6,7,9,11,13,15,18,
+     21,24,27,30,34,37,41,45,49,53,58,62,67,72,76,81,86,91,96,102,107,112,117,123,
+    },
+    {// SYNC 5
+     128,135,141,148,154,161,167,174,180,186,192,197,203,208,213,218,222,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,222,218,213,208,
+     203,197,192,186,180,174,167,161,154,148,141,135,128,121,115,108,102,95,89,82,76,70,65,59,
+     53,48,43,38,34,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,34,38,43,48,53,59,65,70,76,82,89,95,102,108,115,121,
+     128,135,141,148,154,161,167,174,180,186,191,197,203,208,213,218,222,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,222,218,213,208,
+     203,197,192,186,180,174,167,161,154,148,141,135,128,121,115,108,102,95,89,82,76,70,64,59,
+     53,48,43,38,34,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,34,38,43,48,53,59,64,70,76,82,89,95,102,108,115,121,
+     128,135,141,148,154,161,167,174,180,186,192,197,203,208,213,218,222,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,222,218,213,208,
+     203,197,192,186,180,174,167,161,154,148,141,135,128,121,115,108,102,95,89,82,76,70,65,59,
+     53,48,43,38,34,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,34,38,43,48,53,59,64,70,76,82,89,95,102,108,115,121,
+     128,135,141,148,154,161,167,174,180,186,191,197,203,208,213,218,222,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,222,218,213,208,
+     203,197,192,186,180,174,167,161,154,148,141,135,128,121,115,108,102,95,89,82,76,70,65,59,
+     53,48,43,38,34,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,34,38,43,48,53,59,64,70,76,82,89,95,102,108,115,121,
+     128,135,141,148,154,161,167,174,180,186,191,197,203,208,213,218,222,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,222,218,213,208,
+     203,197,192,186,180,174,167,161,154,148,141,135,128,121,115,108,102,95,89,82,76,70,65,59,
+     53,48,43,38,34,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,34,38,43,48,53,59,64,70,76,82,89,95,102,108,115,121,
+    },
+    {// SYNC 6
+     128,136,144,152,160,167,175,182,189,196,203,209,215,221,226,231,235,239,243,246,249,251,253,254,
+     255,255,255,254,253,251,249,246,243,239,235,231,226,221,215,209,203,196,189,182,175,167,160,152,
+     144,136,128,120,112,104,96,89,81,74,67,60,53,47,41,35,30,25,21,17,13,10,7,5,
+     3,2,1,1,1,2,3,5,7,10,13,17,21,25,30,35,41,47,53,60,67,74,81,89,
+     96,104,112,120,128,136,144,152,160,167,175,182,189,196,203,209,215,221,226,231,235,239,243,246,
+     249,251,253,254,255,255,255,254,253,251,249,246,243,239,235,231,226,221,215,209,203,196,189,182,
+     175,167,160,152,144,136,128,120,112,104,96,89,81,74,67,60,53,47,41,35,30,25,21,17,
+     13,10,7,5,3,2,1,1,1,2,3,5,7,10,13,17,21,25,30,35,41,47,53,60,
+     67,74,81,89,96,104,112,120,128,136,144,152,160,167,175,182,189,196,203,209,215,221,226,231,
+     235,239,243,246,249,251,253,254,255,255,255,254,253,251,249,246,243,239,235,231,226,221,215,209,
+     203,196,189,182,175,167,160,152,144,136,128,120,112,104,96,89,81,74,67,60,53,47,41,35,
+     30,25,21,17,13,10,7,5,3,2,1,1,1,2,3,5,7,10,13,17,21,25,30,35,
+     41,47,53,60,67,74,81,89,96,104,112,120,128,136,144,152,160,167,175,182,189,196,203,209,
+     215,221,226,231,235,239,243,246,249,251,253,254,255,255,255,254,253,251,249,246,243,239,235,231,
+     226,221,215,209,203,196,189,182,175,167,160,152,144,136,128,120,112,104,96,89,81,74,67,60,
+     53,47,41,35,30,25,21,17,13,10,7,5,3,2,1,1,1,2,3,5,7,10,13,17,
+     21,25,30,35,41,47,53,60,67,74,81,89,96,104,112,120,128,136,144,152,160,167,175,182,
+     189,196,203,209,215,221,226,231,235,239,243,246,249,251,253,254,255,255,255,254,253,251,249,246,
+     243,239,235,231,226,221,215,209,203,196,189,182,175,167,160,152,144,136,128,120,112,104,96,89,
+     81,74,67,60,53,47,41,35,30,25,21,17,13,10,7,5,3,2,1,1,1,2,3,5,
+     7,10,13,17,21,25,30,35,41,47,53,60,67,74,81,89,96,104,112,120,128,136,144,152,
+     160,167,175,182,189,196,203,209,215,221,226,231,235,239,243,246,249,251,253,254,255,255,255,254,
+     253,251,249,246,243,239,235,231,226,221,215,209,203,196,189,182,175,167,160,152,144,136,128,120,
+     112,104,96,89,81,74,67,60,53,47,41,35,30,25,21,17,13,10,7,5,3,2,1,1,
+     1,2,3,5,7,10,13,17,21,25,30,35,41,47,53,60,67,74,81,89,96,104,112,120,
+    },
+    {// FM 1 1
+     128,131,133,136,139,141,144,147,149,152,154,157,160,162,165,167,170,172,175,177,179,182,184,187,
+     189,191,193,196,198,200,202,204,206,208,210,212,214,216,218,220,221,223,225,226,228,229,231,232,
+     234,235,236,238,239,240,241,242,243,244,245,246,247,248,249,249,250,251,251,252,252,253,253,254,
+     254,254,254,255,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,253,252,252,251,251,
+     250,250,249,248,248,247,246,246,245,244,243,242,242,241,240,239,238,237,236,235,234,233,232,231,
+     230,229,228,227,226,225,224,223,222,220,219,218,217,216,215,214,213,211,210,209,208,207,206,205,
+     203,202,201,200,199,198,197,196,194,193,192,191,190,189,188,187,186,185,184,183,182,180,179,178,
+     177,176,175,175,174,173,172,171,170,169,168,167,166,165,164,164,163,162,161,160,160,159,158,157,
+     156,156,155,154,154,153,152,152,151,150,150,149,148,148,147,147,146,145,145,144,144,143,143,142,
+     142,141,141,140,140,140,139,139,138,138,138,137,137,136,136,136,135,135,135,135,134,134,134,133,
+     133,133,133,132,132,132,132,132,131,131,131,131,131,130,130,130,130,130,130,130,130,129,129,129,
+     129,129,129,129,129,129,129,129,129,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,127,127,127,127,127,127,127,127,
+     127,127,127,127,126,126,126,126,126,126,126,126,125,125,125,125,125,124,124,124,124,124,123,123,
+     123,123,122,122,122,121,121,121,121,120,120,120,119,119,118,118,118,117,117,116,116,116,115,115,
+     114,114,113,113,112,112,111,111,110,109,109,108,108,107,106,106,105,104,104,103,102,102,101,100,
+     100,99,98,97,96,96,95,94,93,92,92,91,90,89,88,87,86,85,84,83,82,81,81,80,
+     79,78,77,76,74,73,72,71,70,69,68,67,66,65,64,63,62,60,59,58,57,56,55,54,
+     53,51,50,49,48,47,46,45,43,42,41,40,39,38,37,36,34,33,32,31,30,29,28,27,
+     26,25,24,23,22,21,20,19,18,17,16,15,14,14,13,12,11,10,10,9,8,8,7,6,
+     6,5,5,4,4,3,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,
+     2,2,3,3,4,4,5,5,6,7,7,8,9,10,11,12,13,14,15,16,17,18,20,21,
+     22,24,25,27,28,30,31,33,35,36,38,40,42,44,46,48,50,52,54,56,58,60,63,65,
+     67,69,72,74,77,79,81,84,86,89,91,94,96,99,102,104,107,109,112,115,117,120,123,125,
+    },
+    {// FM 1 3
+     128,133,139,144,149,154,160,165,170,175,180,184,189,194,198,202,207,211,215,218,222,225,229,232,
+     235,237,240,242,244,246,248,250,251,252,253,254,254,255,255,255,255,254,254,253,252,251,249,248,
+     246,244,242,240,238,235,233,230,227,224,221,218,215,211,208,204,201,197,193,189,185,182,178,174,
+     170,166,162,158,154,149,145,141,137,133,130,126,122,118,114,110,107,103,99,96,92,89,85,82,
+     79,76,73,70,67,64,61,58,56,53,51,48,46,44,41,39,37,35,33,31,30,28,26,25,
+     23,22,21,19,18,17,16,15,14,13,12,11,10,9,9,8,7,7,6,6,5,5,5,4,
+     4,3,3,3,3,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,
+     2,2,3,3,3,3,4,4,4,4,5,5,6,6,7,7,8,8,9,9,10,11,11,12,
+     13,14,15,15,16,17,18,19,20,22,23,24,25,27,28,29,31,32,34,35,37,38,40,42,
+     44,45,47,49,51,53,55,57,59,61,63,65,68,70,72,75,77,79,82,84,87,89,91,94,
+     97,99,102,104,107,109,112,115,117,120,123,125,128,131,133,136,139,141,144,147,149,152,154,157,
+     159,162,165,167,169,172,174,177,179,181,184,186,188,191,193,195,197,199,201,203,205,207,209,211,
+     212,214,216,218,219,221,222,224,225,227,228,229,231,232,233,234,236,237,238,239,240,241,241,242,
+     243,244,245,245,246,247,247,248,248,249,249,250,250,251,251,252,252,252,252,253,253,253,253,254,
+     254,254,254,254,254,254,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+     255,255,255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,254,254,254,253,253,253,253,
+     252,252,251,251,251,250,250,249,249,248,247,247,246,245,244,243,242,241,240,239,238,237,235,234,
+     233,231,230,228,226,225,223,221,219,217,215,212,210,208,205,203,200,198,195,192,189,186,183,180,
+     177,174,171,167,164,160,157,153,149,146,142,138,134,130,126,123,119,115,111,107,102,98,94,90,
+     86,82,78,74,71,67,63,59,55,52,48,45,41,38,35,32,29,26,23,21,18,16,14,12,
+     10,8,7,5,4,3,2,2,1,1,1,1,2,2,3,4,5,6,8,10,12,14,16,19,
+     21,24,27,31,34,38,41,45,49,54,58,62,67,72,76,81,86,91,96,102,107,112,117,123,
+    },
+    {// FM 2 1
+     128,132,136,140,144,148,152,156,159,163,167,171,174,178,182,185,188,192,195,198,201,204,207,210,
+     213,216,218,221,223,225,228,230,232,234,236,237,239,240,242,243,245,246,247,248,249,250,250,251,
+     252,252,253,253,254,254,254,255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,
+     253,253,252,252,252,252,251,251,251,250,250,250,250,249,249,249,249,249,248,248,248,248,248,248,
+     248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,249,249,249,249,249,249,250,250,250,
+     250,250,251,251,251,251,252,252,252,252,253,253,253,253,253,254,254,254,254,254,254,254,255,255,
+     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,254,254,254,253,253,
+     253,253,253,252,252,252,252,251,251,251,251,250,250,250,250,250,249,249,249,249,249,249,248,248,
+     248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,248,249,249,249,249,249,
+     250,250,250,250,251,251,251,252,252,252,252,253,253,253,253,254,254,254,254,255,255,255,255,255,
+     255,255,255,255,255,255,254,254,254,253,253,252,252,251,250,250,249,248,247,246,245,243,242,240,
+     239,237,236,234,232,230,228,225,223,221,218,216,213,210,207,204,201,198,195,192,188,185,182,178,
+     174,171,167,163,159,156,152,148,144,140,136,132,128,124,120,116,112,108,104,100,97,93,89,85,
+     82,78,74,71,68,64,61,58,55,52,49,46,43,40,38,35,33,31,28,26,24,22,20,19,
+     17,16,14,13,11,10,9,8,7,6,6,5,4,4,3,3,2,2,2,1,1,1,1,1,
+     1,1,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,6,6,6,
+     6,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+     8,8,8,7,7,7,7,7,7,6,6,6,6,6,5,5,5,5,4,4,4,4,3,3,
+     3,3,3,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,2,2,2,2,2,2,2,3,3,3,3,3,4,4,4,4,5,5,5,5,6,
+     6,6,6,6,7,7,7,7,7,7,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+     8,8,8,8,8,8,8,7,7,7,7,7,6,6,6,6,5,5,5,4,4,4,4,3,
+     3,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,3,3,4,
+     4,5,6,6,7,8,9,10,11,13,14,16,17,19,20,22,24,26,28,31,33,35,38,40,
+     43,46,49,52,55,58,61,64,68,71,74,78,82,85,89,93,97,100,104,108,112,116,120,124,
+    },
+    {// FM 2 3
+     128,137,147,156,165,173,182,190,198,206,213,219,225,231,236,240,244,247,250,252,254,255,255,255,
+     254,253,251,249,246,243,239,235,231,226,221,216,211,205,200,194,188,182,176,170,164,159,153,147,
+     141,136,131,125,120,115,110,106,101,97,93,89,86,82,79,76,73,70,68,65,63,61,59,57,
+     56,54,53,52,51,50,49,49,48,48,48,48,48,48,48,49,49,50,51,52,53,54,55,57,
+     59,60,62,64,67,69,72,74,77,80,83,87,90,94,98,102,106,110,115,119,124,129,133,138,
+     143,149,154,159,164,169,175,180,185,190,195,200,205,210,215,219,223,227,231,235,238,241,244,247,
+     249,251,252,253,254,255,255,255,254,253,252,251,249,247,244,241,238,235,231,227,223,219,215,210,
+     205,200,195,190,185,180,175,169,164,159,154,149,143,138,133,129,124,119,115,110,106,102,98,94,
+     90,87,83,80,77,74,72,69,67,64,62,60,59,57,55,54,53,52,51,50,49,49,48,48,
+     48,48,48,48,48,49,49,50,51,52,53,54,56,57,59,61,63,65,68,70,73,76,79,82,
+     86,89,93,97,101,106,110,115,120,125,131,136,141,147,153,159,164,170,176,182,188,194,200,205,
+     211,216,221,226,231,235,239,243,246,249,251,253,254,255,255,255,254,252,250,247,244,240,236,231,
+     225,219,213,206,198,190,182,173,165,156,147,137,128,119,109,100,91,83,74,66,58,50,43,37,
+     31,25,20,16,12,9,6,4,2,1,1,1,2,3,5,7,10,13,17,21,25,30,35,40,
+     45,51,56,62,68,74,80,86,92,97,103,109,115,120,125,131,136,141,146,150,155,159,163,167,
+     170,174,177,180,183,186,188,191,193,195,197,199,200,202,203,204,205,206,207,207,208,208,208,208,
+     208,208,208,207,207,206,205,204,203,202,201,199,197,196,194,192,189,187,184,182,179,176,173,169,
+     166,162,158,154,150,146,141,137,132,127,123,118,113,107,102,97,92,87,81,76,71,66,61,56,
+     51,46,41,37,33,29,25,21,18,15,12,9,7,5,4,3,2,1,1,1,2,3,4,5,
+     7,9,12,15,18,21,25,29,33,37,41,46,51,56,61,66,71,76,81,87,92,97,102,107,
+     113,118,123,127,132,137,141,146,150,154,158,162,166,169,173,176,179,182,184,187,189,192,194,196,
+     197,199,201,202,203,204,205,206,207,207,208,208,208,208,208,208,208,207,207,206,205,204,203,202,
+     200,199,197,195,193,191,188,186,183,180,177,174,170,167,163,159,155,150,146,141,136,131,125,120,
+     115,109,103,97,92,86,80,74,68,62,56,51,45,40,35,30,25,21,17,13,10,7,5,3,
+     2,1,1,1,2,4,6,9,12,16,20,25,31,37,43,50,58,66,74,83,91,100,109,119,
+    },
+    {// FM 3 2
+     128,137,147,156,165,173,182,190,198,205,212,218,224,230,235,239,243,246,249,251,253,254,255,255,
+     255,254,253,252,251,249,247,245,242,240,237,234,232,229,226,224,221,218,216,214,211,209,207,206,
+     204,203,202,201,200,199,199,199,199,199,199,200,201,202,203,204,206,208,210,212,214,216,218,221,
+     223,226,228,231,233,236,238,241,243,245,247,249,250,252,253,254,255,255,255,255,254,253,252,251,
+     249,247,244,241,238,235,231,227,222,218,213,208,203,198,193,187,182,176,171,165,160,154,149,143,
+     138,133,128,124,119,115,110,106,103,99,96,93,90,87,85,82,80,78,77,76,74,73,73,72,
+     72,72,72,73,73,74,75,76,78,80,82,84,87,90,93,96,99,103,107,112,116,121,126,131,
+     137,143,149,155,161,167,173,180,186,192,199,205,211,217,222,227,232,237,241,245,248,250,252,254,
+     255,255,255,253,252,249,246,242,238,233,228,222,215,208,201,193,185,177,168,160,151,143,134,126,
+     117,109,101,93,86,79,72,65,59,53,48,43,38,34,30,26,23,20,17,15,13,11,9,8,
+     7,6,5,4,3,3,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,2,2,2,
+     2,3,3,3,4,5,5,6,8,9,10,12,14,16,18,21,24,27,30,33,37,41,46,50,
+     55,60,66,71,77,83,89,95,102,108,115,121,128,135,141,148,154,161,167,173,179,185,190,196,
+     201,206,210,215,219,223,226,229,232,235,238,240,242,244,246,247,248,250,251,251,252,253,253,253,
+     254,254,254,254,255,255,255,255,255,255,255,255,255,255,254,254,254,254,254,253,253,252,251,250,
+     249,248,247,245,243,241,239,236,233,230,226,222,218,213,208,203,197,191,184,177,170,163,155,147,
+     139,130,122,113,105,96,88,79,71,63,55,48,41,34,28,23,18,14,10,7,4,3,1,1,
+     1,2,4,6,8,11,15,19,24,29,34,39,45,51,57,64,70,76,83,89,95,101,107,113,
+     119,125,130,135,140,144,149,153,157,160,163,166,169,172,174,176,178,180,181,182,183,183,184,184,
+     184,184,183,183,182,180,179,178,176,174,171,169,166,163,160,157,153,150,146,141,137,132,128,123,
+     118,113,107,102,96,91,85,80,74,69,63,58,53,48,43,38,34,29,25,21,18,15,12,9,
+     7,5,4,3,2,1,1,1,1,2,3,4,6,7,9,11,13,15,18,20,23,25,28,30,
+     33,35,38,40,42,44,46,48,50,52,53,54,55,56,57,57,57,57,57,57,56,55,54,53,
+     52,50,49,47,45,42,40,38,35,32,30,27,24,22,19,16,14,11,9,7,5,4,3,2,
+     1,1,1,2,3,5,7,10,13,17,21,26,32,38,44,51,58,66,74,83,91,100,109,119,
+    },
+    {// FM 4 2
+     128,140,152,163,175,185,195,205,214,222,229,235,241,245,249,251,253,255,255,255,254,253,251,249,
+     246,244,241,238,235,232,229,227,224,222,220,218,216,215,214,213,213,213,213,214,215,216,218,220,
+     222,224,226,229,232,234,237,240,243,245,248,250,252,253,254,255,255,255,254,252,250,247,244,240,
+     235,230,224,218,211,204,196,188,180,172,163,155,146,138,129,121,113,106,99,92,85,79,73,68,
+     63,59,55,51,48,45,42,40,38,37,35,35,34,34,34,34,35,35,37,38,40,42,45,48,
+     52,56,60,65,70,76,82,89,96,104,112,121,130,139,148,158,168,177,187,196,205,214,222,229,
+     236,241,246,250,253,254,255,254,253,250,246,241,236,229,222,214,205,196,187,177,168,158,148,139,
+     130,121,112,104,96,89,82,76,70,65,60,56,52,48,45,42,40,38,37,35,35,34,34,34,
+     34,35,35,37,38,40,42,45,48,51,55,59,63,68,73,79,85,92,99,106,113,121,129,138,
+     146,155,163,172,180,188,196,204,211,218,224,230,235,240,244,247,250,252,254,255,255,255,254,253,
+     252,250,248,245,243,240,237,234,232,229,226,224,222,220,218,216,215,214,213,213,213,213,214,215,
+     216,218,220,222,224,227,229,232,235,238,241,244,246,249,251,253,254,255,255,255,253,251,249,245,
+     241,235,229,222,214,205,195,185,175,163,152,140,128,116,104,93,81,71,61,51,42,34,27,21,
+     15,11,7,5,3,1,1,1,2,3,5,7,10,12,15,18,21,24,27,29,32,34,36,38,
+     40,41,42,43,43,43,43,42,41,40,38,36,34,32,30,27,24,22,19,16,13,11,8,6,
+     4,3,2,1,1,1,2,4,6,9,12,16,21,26,32,38,45,52,60,68,76,84,93,101,
+     110,118,127,135,143,150,157,164,171,177,183,188,193,197,201,205,208,211,214,216,218,219,221,221,
+     222,222,222,222,221,221,219,218,216,214,211,208,204,200,196,191,186,180,174,167,160,152,144,135,
+     126,117,108,98,88,79,69,60,51,42,34,27,20,15,10,6,3,2,1,2,3,6,10,15,
+     20,27,34,42,51,60,69,79,88,98,108,117,126,135,144,152,160,167,174,180,186,191,196,200,
+     204,208,211,214,216,218,219,221,221,222,222,222,222,221,221,219,218,216,214,211,208,205,201,197,
+     193,188,183,177,171,164,157,150,143,135,127,118,110,101,93,84,76,68,60,52,45,38,32,26,
+     21,16,12,9,6,4,2,1,1,1,2,3,4,6,8,11,13,16,19,22,24,27,30,32,
+     34,36,38,40,41,42,43,43,43,43,42,41,40,38,36,34,32,29,27,24,21,18,15,12,
+     10,7,5,3,2,1,1,1,3,5,7,11,15,21,27,34,42,51,61,71,81,93,104,116,
+    },
+    {// FM 5 1.5
+     128,139,150,161,172,182,192,201,209,217,224,230,235,240,244,247,250,252,253,254,255,255,255,255,
+     254,254,253,253,252,252,251,251,251,251,251,251,252,252,253,253,254,254,255,255,255,255,255,254,
+     253,251,249,247,244,241,237,232,227,222,216,209,203,195,188,180,173,165,157,149,141,133,126,119,
+     112,105,99,93,88,83,79,75,71,68,66,64,62,61,60,59,59,60,61,62,64,66,69,72,
+     76,80,85,90,96,103,110,117,125,133,141,150,159,168,178,187,196,204,213,221,228,234,240,245,
+     249,252,254,255,255,254,252,249,246,242,237,232,226,220,213,207,200,193,187,181,175,169,164,159,
+     154,150,146,143,141,139,137,136,135,135,136,137,138,140,143,146,149,153,157,162,167,172,177,183,
+     189,195,201,207,213,218,224,229,234,238,242,246,249,251,253,254,255,255,255,254,252,250,248,246,
+     243,240,237,234,230,227,224,221,219,216,214,212,211,210,209,208,208,209,210,211,213,214,217,219,
+     222,225,228,232,235,239,242,245,248,250,252,254,255,255,255,253,251,248,244,239,234,227,220,211,
+     203,193,183,173,162,152,141,130,120,109,99,90,81,73,65,57,51,45,39,34,30,26,23,20,
+     18,16,14,13,12,11,10,10,10,10,10,10,11,12,13,14,15,17,19,22,25,28,32,36,
+     41,46,52,58,64,71,78,86,94,102,111,119,128,137,145,154,162,170,178,185,192,198,204,210,
+     215,220,224,228,231,234,237,239,241,242,243,244,245,246,246,246,246,246,246,245,244,243,242,240,
+     238,236,233,230,226,222,217,211,205,199,191,183,175,166,157,147,136,126,115,104,94,83,73,63,
+     53,45,36,29,22,17,12,8,5,3,1,1,1,2,4,6,8,11,14,17,21,24,28,31,
+     34,37,39,42,43,45,46,47,48,48,47,46,45,44,42,40,37,35,32,29,26,22,19,16,
+     13,10,8,6,4,2,1,1,1,2,3,5,7,10,14,18,22,27,32,38,43,49,55,61,
+     67,73,79,84,89,94,99,103,107,110,113,116,118,119,120,121,121,120,119,117,115,113,110,106,
+     102,97,92,87,81,75,69,63,56,49,43,36,30,24,19,14,10,7,4,2,1,1,2,4,
+     7,11,16,22,28,35,43,52,60,69,78,88,97,106,115,123,131,139,146,153,160,166,171,176,
+     180,184,187,190,192,194,195,196,197,197,196,195,194,192,190,188,185,181,177,173,168,163,157,151,
+     144,137,130,123,115,107,99,91,83,76,68,61,53,47,40,34,29,24,19,15,12,9,7,5,
+     3,2,1,1,1,1,1,2,2,3,3,4,4,5,5,5,5,5,5,4,4,3,3,2,
+     2,1,1,1,1,2,3,4,6,9,12,16,21,26,32,39,47,55,64,74,84,95,106,117,
+    },
+    {// FM 7 1
+     128,139,149,159,169,179,188,196,204,211,217,222,227,231,235,238,241,243,244,246,247,247,248,248,
+     248,248,247,246,245,244,242,241,238,235,232,228,224,219,214,209,202,196,189,182,175,167,160,152,
+     145,138,131,124,118,113,107,103,98,95,92,89,88,87,86,86,87,88,90,93,96,100,105,111,
+     117,123,130,138,146,154,163,172,181,190,199,207,215,222,229,235,241,245,249,251,253,255,255,255,
+     254,253,251,250,248,246,244,242,240,238,237,236,236,236,236,236,237,238,239,241,243,245,247,249,
+     250,252,253,254,255,255,255,254,253,251,249,246,243,240,236,232,228,224,220,216,212,208,205,202,
+     200,198,197,196,196,196,197,198,200,202,205,209,213,217,221,225,230,234,239,243,246,249,252,254,
+     255,255,254,253,250,247,243,238,233,227,220,214,207,200,193,186,180,173,168,162,158,153,150,147,
+     145,143,142,142,143,144,146,148,151,154,159,163,168,173,179,185,191,197,203,209,215,221,226,231,
+     235,239,243,246,248,250,252,253,254,255,255,255,255,255,255,254,254,254,254,254,254,255,255,255,
+     255,255,255,254,253,252,250,248,245,241,236,231,225,218,211,203,194,184,175,165,155,144,134,124,
+     115,105,97,89,81,74,68,62,57,53,49,46,43,41,40,39,38,38,39,40,41,43,45,48,
+     52,56,60,65,71,76,83,90,97,104,112,120,128,136,144,152,159,166,173,180,185,191,196,200,
+     204,208,211,213,215,216,217,218,218,217,216,215,213,210,207,203,199,194,188,182,175,167,159,151,
+     141,132,122,112,101,91,81,72,62,53,45,38,31,25,20,15,11,8,6,4,3,2,1,1,
+     1,1,1,1,2,2,2,2,2,2,1,1,1,1,1,1,2,3,4,6,8,10,13,17,
+     21,25,30,35,41,47,53,59,65,71,77,83,88,93,97,102,105,108,110,112,113,114,114,113,
+     111,109,106,103,98,94,88,83,76,70,63,56,49,42,36,29,23,18,13,9,6,3,2,1,
+     1,2,4,7,10,13,17,22,26,31,35,39,43,47,51,54,56,58,59,60,60,60,59,58,
+     56,54,51,48,44,40,36,32,28,24,20,16,13,10,7,5,3,2,1,1,1,2,3,4,
+     6,7,9,11,13,15,17,18,19,20,20,20,20,20,19,18,16,14,12,10,8,6,5,3,
+     2,1,1,1,3,5,7,11,15,21,27,34,41,49,57,66,75,84,93,102,110,118,126,133,
+     139,145,151,156,160,163,166,168,169,170,170,169,168,167,164,161,158,153,149,143,138,132,125,118,
+     111,104,96,89,81,74,67,60,54,47,42,37,32,28,24,21,18,15,14,12,11,10,9,8,
+     8,8,8,9,9,10,12,13,15,18,21,25,29,34,39,45,52,60,68,77,87,97,107,117,
+    },
+    {// FOLD 1.5
+     128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,161,163,165,167,169,171,173,
+     174,176,178,180,181,183,185,187,188,190,192,193,195,196,198,199,201,202,204,205,207,208,210,211,
+     212,214,215,216,217,218,220,221,222,223,224,225,226,227,228,229,230,231,232,233,234,235,235,236,
+     237,238,238,239,240,240,241,242,242,243,243,244,245,245,246,246,246,247,247,248,248,248,249,249,
+     249,250,250,250,251,251,251,251,252,252,252,252,252,253,253,253,253,253,253,253,254,254,254,254,
+     254,254,254,254,254,254,254,254,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+     255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+     255,255,255,255,255,254,254,254,254,254,254,254,254,254,254,254,254,253,253,253,253,253,253,253,
+     252,252,252,252,252,251,251,251,251,250,250,250,249,249,249,248,248,248,247,247,246,246,246,245,
+     245,244,243,243,242,242,241,240,240,239,238,238,237,236,235,235,234,233,232,231,230,229,228,227,
+     226,225,224,223,222,221,220,218,217,216,215,214,212,211,210,208,207,205,204,202,201,199,198,196,
+     195,193,192,190,188,187,185,183,181,180,178,176,174,173,171,169,167,165,163,161,160,158,156,154,
+     152,150,148,146,144,142,140,138,136,134,132,130,128,126,124,122,120,118,116,114,112,110,108,106,
+     104,102,100,98,96,95,93,91,89,87,85,83,82,80,78,76,75,73,71,69,68,66,64,63,
+     61,60,58,57,55,54,52,51,49,48,46,45,44,42,41,40,39,38,36,35,34,33,32,31,
+     30,29,28,27,26,25,24,23,22,21,21,20,19,18,18,17,16,16,15,14,14,13,13,12,
+     11,11,10,10,10,9,9,8,8,8,7,7,7,6,6,6,5,5,5,5,4,4,4,4,
+     4,3,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,
+     2,2,2,2,2,3,3,3,3,3,3,3,4,4,4,4,4,5,5,5,5,6,6,6,
+     7,7,7,8,8,8,9,9,10,10,10,11,11,12,13,13,14,14,15,16,16,17,18,18,
+     19,20,21,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,38,39,40,41,42,
+     44,45,46,48,49,51,52,54,55,57,58,60,61,63,64,66,68,69,71,73,75,76,78,80,
+     82,83,85,87,89,91,93,95,96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,
+    },
+    {// FOLD 2
+     128,131,133,136,139,141,144,147,149,152,154,157,160,162,165,167,170,172,174,177,179,182,184,186,
+     189,191,193,195,197,200,202,204,206,208,210,211,213,215,217,219,220,222,224,225,227,228,230,231,
+     232,234,235,236,237,238,240,241,242,243,243,244,245,246,247,248,248,249,249,250,251,251,252,252,
+     252,253,253,253,254,254,254,254,255,255,255,255,255,255,255,255,255,255,255,255,255,255,254,254,
+     254,254,254,254,253,253,253,253,252,252,252,252,251,251,251,251,250,250,250,249,249,249,249,248,
+     248,248,248,247,247,247,247,246,246,246,246,245,245,245,245,245,245,244,244,244,244,244,244,244,
+     244,244,244,244,244,243,243,243,244,244,244,244,244,244,244,244,244,244,244,244,245,245,245,245,
+     245,245,246,246,246,246,247,247,247,247,248,248,248,248,249,249,249,249,250,250,250,251,251,251,
+     251,252,252,252,252,253,253,253,253,254,254,254,254,254,254,255,255,255,255,255,255,255,255,255,
+     255,255,255,255,255,254,254,254,254,253,253,253,252,252,252,251,251,250,249,249,248,248,247,246,
+     245,244,243,243,242,241,240,238,237,236,235,234,232,231,230,228,227,225,224,222,220,219,217,215,
+     213,211,210,208,206,204,202,200,197,195,193,191,189,186,184,182,179,177,174,172,170,167,165,162,
+     160,157,154,152,149,147,144,141,139,136,133,131,128,125,123,120,117,115,112,109,107,104,102,99,
+     96,94,91,89,86,84,82,79,77,74,72,70,67,65,63,61,59,56,54,52,50,48,46,45,
+     43,41,39,37,36,34,32,31,29,28,26,25,24,22,21,20,19,18,16,15,14,13,13,12,
+     11,10,9,8,8,7,7,6,5,5,4,4,4,3,3,3,2,2,2,2,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,3,3,3,3,4,4,4,4,
+     5,5,5,5,6,6,6,7,7,7,7,8,8,8,8,9,9,9,9,10,10,10,10,11,
+     11,11,11,11,11,12,12,12,12,12,12,12,12,12,12,12,12,13,13,13,12,12,12,12,
+     12,12,12,12,12,12,12,12,11,11,11,11,11,11,10,10,10,10,9,9,9,9,8,8,
+     8,8,7,7,7,7,6,6,6,5,5,5,5,4,4,4,4,3,3,3,3,2,2,2,
+     2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,3,3,3,
+     4,4,4,5,5,6,7,7,8,8,9,10,11,12,13,13,14,15,16,18,19,20,21,22,
+     24,25,26,28,29,31,32,34,36,37,39,41,43,45,46,48,50,52,54,56,59,61,63,65,
+     67,70,72,74,77,79,82,84,86,89,91,94,96,99,102,104,107,109,112,115,117,120,123,125,
+    },
+    {// FOLD 3
+     128,132,136,140,144,148,152,156,160,163,167,171,175,178,182,185,189,192,196,199,202,205,208,211,
+     214,217,220,222,225,227,230,232,234,236,238,240,241,243,245,246,247,248,250,251,251,252,253,254,
+     254,254,255,255,255,255,255,255,254,254,254,253,253,252,251,250,250,249,248,247,245,244,243,242,
+     240,239,238,236,235,233,232,230,228,227,225,223,222,220,218,217,215,213,211,209,208,206,204,202,
+     201,199,197,195,194,192,190,189,187,185,184,182,181,179,178,176,175,173,172,170,169,168,167,165,
+     164,163,162,161,160,159,158,157,156,155,154,153,153,152,151,151,150,149,149,148,148,148,147,147,
+     147,146,146,146,146,146,146,146,146,146,146,146,147,147,147,148,148,148,149,149,150,151,151,152,
+     153,153,154,155,156,157,158,159,160,161,162,163,164,165,167,168,169,170,172,173,175,176,178,179,
+     181,182,184,185,187,189,190,192,194,195,197,199,201,202,204,206,208,209,211,213,215,217,218,220,
+     222,223,225,227,228,230,232,233,235,236,238,239,240,242,243,244,245,247,248,249,250,250,251,252,
+     253,253,254,254,254,255,255,255,255,255,255,254,254,254,253,252,251,251,250,248,247,246,245,243,
+     241,240,238,236,234,232,230,227,225,222,220,217,214,211,208,205,202,199,196,192,189,185,182,178,
+     175,171,167,163,160,156,152,148,144,140,136,132,128,124,120,116,112,108,104,100,96,93,89,85,
+     81,78,74,71,67,64,60,57,54,51,48,45,42,39,36,34,31,29,26,24,22,20,18,16,
+     15,13,11,10,9,8,6,5,5,4,3,2,2,2,1,1,1,1,1,1,2,2,2,3,
+     3,4,5,6,6,7,8,9,11,12,13,14,16,17,18,20,21,23,24,26,28,29,31,33,
+     34,36,38,39,41,43,45,47,48,50,52,54,55,57,59,61,62,64,66,67,69,71,72,74,
+     75,77,78,80,81,83,84,86,87,88,89,91,92,93,94,95,96,97,98,99,100,101,102,103,
+     103,104,105,105,106,107,107,108,108,108,109,109,109,110,110,110,110,110,110,110,110,110,110,110,
+     109,109,109,108,108,108,107,107,106,105,105,104,103,103,102,101,100,99,98,97,96,95,94,93,
+     92,91,89,88,87,86,84,83,81,80,78,77,75,74,72,71,69,67,66,64,62,61,59,57,
+     55,54,52,50,48,47,45,43,41,39,38,36,34,33,31,29,28,26,24,23,21,20,18,17,
+     16,14,13,12,11,9,8,7,6,6,5,4,3,3,2,2,2,1,1,1,1,1,1,2,
+     2,2,3,4,5,5,6,8,9,10,11,13,15,16,18,20,22,24,26,29,31,34,36,39,
+     42,45,48,51,54,57,60,64,67,71,74,78,81,85,89,93,96,100,104,108,112,116,120,124,
+    },
+    {// FOLD 4
+     128,133,139,144,149,154,160,165,170,175,180,184,189,194,198,202,207,211,215,218,222,225,229,232,
+     235,237,240,242,244,246,248,250,251,252,253,254,254,255,255,255,255,254,254,253,252,251,250,249,
+     247,245,243,242,239,237,235,232,230,227,224,221,218,215,212,209,206,202,199,195,192,188,185,181,
+     178,174,171,167,164,160,156,153,149,146,142,139,136,132,129,126,122,119,116,113,110,107,104,101,
+     98,96,93,90,88,85,83,80,78,76,74,72,70,68,66,64,62,60,59,57,55,54,53,51,
+     50,49,47,46,45,44,43,42,41,40,39,39,38,37,37,36,36,35,35,34,34,33,33,33,
+     33,32,32,32,32,32,32,32,32,32,32,32,33,33,33,33,34,34,35,35,36,36,37,37,
+     38,39,39,40,41,42,43,44,45,46,47,49,50,51,53,54,55,57,59,60,62,64,66,68,
+     70,72,74,76,78,80,83,85,88,90,93,96,98,101,104,107,110,113,116,119,122,126,129,132,
+     136,139,142,146,149,153,156,160,164,167,171,174,178,181,185,188,192,195,199,202,206,209,212,215,
+     218,221,224,227,230,232,235,237,239,242,243,245,247,249,250,251,252,253,254,254,255,255,255,255,
+     254,254,253,252,251,250,248,246,244,242,240,237,235,232,229,225,222,218,215,211,207,202,198,194,
+     189,184,180,175,170,165,160,154,149,144,139,133,128,123,117,112,107,102,96,91,86,81,76,72,
+     67,62,58,54,49,45,41,38,34,31,27,24,21,19,16,14,12,10,8,6,5,4,3,2,
+     2,1,1,1,1,2,2,3,4,5,6,7,9,11,13,14,17,19,21,24,26,29,32,35,
+     38,41,44,47,50,54,57,61,64,68,71,75,78,82,85,89,92,96,100,103,107,110,114,117,
+     120,124,127,130,134,137,140,143,146,149,152,155,158,160,163,166,168,171,173,176,178,180,182,184,
+     186,188,190,192,194,196,197,199,201,202,203,205,206,207,209,210,211,212,213,214,215,216,217,217,
+     218,219,219,220,220,221,221,222,222,223,223,223,223,224,224,224,224,224,224,224,224,224,224,224,
+     223,223,223,223,222,222,221,221,220,220,219,219,218,217,217,216,215,214,213,212,211,210,209,207,
+     206,205,203,202,201,199,197,196,194,192,190,188,186,184,182,180,178,176,173,171,168,166,163,160,
+     158,155,152,149,146,143,140,137,134,130,127,124,120,117,114,110,107,103,100,96,92,89,85,82,
+     78,75,71,68,64,61,57,54,50,47,44,41,38,35,32,29,26,24,21,19,17,14,13,11,
+     9,7,6,5,4,3,2,2,1,1,1,1,2,2,3,4,5,6,8,10,12,14,16,19,
+     21,24,27,31,34,38,41,45,49,54,58,62,67,72,76,81,86,91,96,102,107,112,117,123,
+    },
+    {// FOLD 5
+     128,135,141,148,154,161,167,173,180,186,191,197,202,208,213,218,222,226,230,234,238,241,243,246,
+     248,250,252,253,254,255,255,255,255,254,253,252,250,249,247,244,242,239,236,232,229,225,221,217,
+     213,209,204,199,195,190,185,180,174,169,164,159,154,148,143,138,133,127,122,117,112,107,102,97,
+     93,88,84,79,75,71,67,63,59,55,52,48,45,42,39,36,33,31,28,26,24,22,20,18,
+     16,14,13,11,10,9,8,7,6,5,4,4,3,3,2,2,2,1,1,1,1,1,1,1,
+     1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,4,5,5,5,5,5,6,6,
+     6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,5,5,5,5,5,4,4,4,4,
+     4,3,3,3,3,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,2,2,3,
+     3,4,4,5,6,7,8,9,10,11,13,14,16,18,20,22,24,26,28,31,33,36,39,42,
+     45,48,52,55,59,63,67,71,75,79,84,88,93,97,102,107,112,117,122,127,133,138,143,148,
+     154,159,164,169,174,180,185,190,195,199,204,209,213,217,221,225,229,232,236,239,242,244,247,249,
+     250,252,253,254,255,255,255,255,254,253,252,250,248,246,243,241,238,234,230,226,222,218,213,208,
+     202,197,191,186,180,173,167,161,154,148,141,135,128,121,115,108,102,95,89,83,76,70,65,59,
+     54,48,43,38,34,30,26,22,18,15,13,10,8,6,4,3,2,1,1,1,1,2,3,4,
+     6,7,9,12,14,17,20,24,27,31,35,39,43,47,52,57,61,66,71,76,82,87,92,97,
+     102,108,113,118,123,129,134,139,144,149,154,159,163,168,172,177,181,185,189,193,197,201,204,208,
+     211,214,217,220,223,225,228,230,232,234,236,238,240,242,243,245,246,247,248,249,250,251,252,252,
+     253,253,254,254,254,255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,253,253,253,253,
+     252,252,252,252,252,251,251,251,251,251,250,250,250,250,250,250,250,250,250,250,250,250,250,250,
+     250,250,250,251,251,251,251,251,252,252,252,252,252,253,253,253,253,254,254,254,254,255,255,255,
+     255,255,255,255,255,255,255,255,254,254,254,253,253,252,252,251,250,249,248,247,246,245,243,242,
+     240,238,236,234,232,230,228,225,223,220,217,214,211,208,204,201,197,193,189,185,181,177,172,168,
+     163,159,154,149,144,139,134,129,123,118,113,108,102,97,92,87,82,76,71,66,61,57,52,47,
+     43,39,35,31,27,24,20,17,14,12,9,7,6,4,3,2,1,1,1,1,2,3,4,6,
+     8,10,13,15,18,22,26,30,34,38,43,48,54,59,65,70,76,83,89,95,102,108,115,121,
+    },
+    {// FOLD 6
+     128,136,144,152,160,167,175,182,189,196,203,209,215,220,226,230,235,239,243,246,248,251,252,254,
+     255,255,255,254,253,252,250,248,245,242,238,234,230,225,221,215,210,204,198,192,186,180,173,166,
+     160,153,146,139,132,125,119,112,105,99,93,86,80,74,69,63,58,53,48,43,39,35,31,27,
+     24,20,17,15,12,10,8,7,5,4,3,2,1,1,1,1,1,2,2,3,4,5,6,7,
+     9,10,12,14,16,17,19,21,24,26,28,30,32,34,37,39,41,43,46,48,50,52,55,57,
+     59,61,63,65,67,68,70,72,74,75,77,78,80,81,82,84,85,86,87,88,89,89,90,91,
+     91,92,92,92,92,92,93,92,92,92,92,92,91,91,90,89,89,88,87,86,85,84,82,81,
+     80,78,77,75,74,72,70,68,67,65,63,61,59,57,55,52,50,48,46,43,41,39,37,34,
+     32,30,28,26,24,21,19,17,16,14,12,10,9,7,6,5,4,3,2,2,1,1,1,1,
+     1,2,3,4,5,7,8,10,12,15,17,20,24,27,31,35,39,43,48,53,58,63,69,74,
+     80,86,93,99,105,112,119,125,132,139,146,153,160,166,173,180,186,192,198,204,210,215,221,225,
+     230,234,238,242,245,248,250,252,253,254,255,255,255,254,252,251,248,246,243,239,235,230,226,220,
+     215,209,203,196,189,182,175,167,160,152,144,136,128,120,112,104,96,89,81,74,67,60,53,47,
+     41,36,30,26,21,17,13,10,8,5,4,2,1,1,1,2,3,4,6,8,11,14,18,22,
+     26,31,35,41,46,52,58,64,70,76,83,90,96,103,110,117,124,131,137,144,151,157,163,170,
+     176,182,187,193,198,203,208,213,217,221,225,229,232,236,239,241,244,246,248,249,251,252,253,254,
+     255,255,255,255,255,254,254,253,252,251,250,249,247,246,244,242,240,239,237,235,232,230,228,226,
+     224,222,219,217,215,213,210,208,206,204,201,199,197,195,193,191,189,188,186,184,182,181,179,178,
+     176,175,174,172,171,170,169,168,167,167,166,165,165,164,164,164,164,164,163,164,164,164,164,164,
+     165,165,166,167,167,168,169,170,171,172,174,175,176,178,179,181,182,184,186,188,189,191,193,195,
+     197,199,201,204,206,208,210,213,215,217,219,222,224,226,228,230,232,235,237,239,240,242,244,246,
+     247,249,250,251,252,253,254,254,255,255,255,255,255,254,253,252,251,249,248,246,244,241,239,236,
+     232,229,225,221,217,213,208,203,198,193,187,182,176,170,163,157,151,144,137,131,124,117,110,103,
+     96,90,83,76,70,64,58,52,46,41,35,31,26,22,18,14,11,8,6,4,3,2,1,1,
+     1,2,4,5,8,10,13,17,21,26,30,36,41,47,53,60,67,74,81,89,96,104,112,120,
+    },
+    {// FOLD 8
+     128,139,149,160,170,180,189,198,207,215,222,229,235,240,245,249,251,253,255,255,254,253,251,248,
+     244,239,234,228,222,215,207,199,190,181,172,162,153,143,133,123,114,104,95,86,77,68,60,52,
+     45,38,32,26,21,16,12,9,6,4,2,1,1,1,2,3,5,8,10,14,17,22,26,31,
+     36,42,48,54,60,66,73,79,86,93,99,106,113,120,126,133,139,146,152,158,164,170,175,181,
+     186,191,195,200,204,209,212,216,220,223,226,229,232,234,237,239,241,243,244,246,247,248,249,250,
+     251,252,253,253,254,254,254,255,255,255,255,255,255,255,255,255,255,255,255,254,254,254,254,254,
+     254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,254,255,255,255,255,255,255,
+     255,255,255,255,255,255,254,254,254,253,253,252,251,250,249,248,247,246,244,243,241,239,237,234,
+     232,229,226,223,220,216,212,209,204,200,195,191,186,181,175,170,164,158,152,146,139,133,126,120,
+     113,106,99,93,86,79,73,66,60,54,48,42,36,31,26,22,17,14,10,8,5,3,2,1,
+     1,1,2,4,6,9,12,16,21,26,32,38,45,52,60,68,77,86,95,104,114,123,133,143,
+     153,162,172,181,190,199,207,215,222,228,234,239,244,248,251,253,254,255,255,253,251,249,245,240,
+     235,229,222,215,207,198,189,180,170,160,149,139,128,117,107,96,86,76,67,58,49,41,34,27,
+     21,16,11,7,5,3,1,1,2,3,5,8,12,17,22,28,34,41,49,57,66,75,84,94,
+     103,113,123,133,142,152,161,170,179,188,196,204,211,218,224,230,235,240,244,247,250,252,254,255,
+     255,255,254,253,251,248,246,242,239,234,230,225,220,214,208,202,196,190,183,177,170,163,157,150,
+     143,136,130,123,117,110,104,98,92,86,81,75,70,65,61,56,52,47,44,40,36,33,30,27,
+     24,22,19,17,15,13,12,10,9,8,7,6,5,4,3,3,2,2,2,1,1,1,1,1,
+     1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,3,3,4,
+     5,6,7,8,9,10,12,13,15,17,19,22,24,27,30,33,36,40,44,47,52,56,61,65,
+     70,75,81,86,92,98,104,110,117,123,130,136,143,150,157,163,170,177,183,190,196,202,208,214,
+     220,225,230,234,239,242,246,248,251,253,254,255,255,255,254,252,250,247,244,240,235,230,224,218,
+     211,204,196,188,179,170,161,152,142,133,123,113,103,94,84,75,66,57,49,41,34,28,22,17,
+     12,8,5,3,2,1,1,3,5,7,11,16,21,27,34,41,49,58,67,76,86,96,107,117,
+    },
+    {// FOLD 10
+     128,141,154,167,180,191,203,213,222,231,238,244,249,252,254,255,254,252,249,245,239,232,224,215,
+     205,195,184,172,160,147,135,122,109,97,85,74,63,52,43,34,27,20,14,9,5,3,1,1,
+     2,3,6,10,15,20,27,34,41,50,59,68,78,88,98,109,119,129,140,150,160,169,178,187,
+     196,204,211,218,224,230,235,240,244,247,250,252,254,255,255,255,254,253,251,249,247,244,241,237,
+     234,229,225,221,216,211,206,201,196,191,185,180,175,169,164,159,154,149,144,139,135,130,126,121,
+     117,113,109,105,102,98,95,92,89,86,84,81,79,77,74,73,71,69,68,66,65,64,63,62,
+     61,60,60,59,59,59,59,59,59,59,60,60,61,62,63,64,65,66,68,69,71,73,74,77,
+     79,81,84,86,89,92,95,98,102,105,109,113,117,121,126,130,135,139,144,149,154,159,164,169,
+     175,180,185,191,196,201,206,211,216,221,225,229,234,237,241,244,247,249,251,253,254,255,255,255,
+     254,252,250,247,244,240,235,230,224,218,211,204,196,187,178,169,160,150,140,129,119,109,98,88,
+     78,68,59,50,41,34,27,20,15,10,6,3,2,1,1,3,5,9,14,20,27,34,43,52,
+     63,74,85,97,109,122,135,147,160,172,184,195,205,215,224,232,239,245,249,252,254,255,254,252,
+     249,244,238,231,222,213,203,191,180,167,154,141,128,115,102,89,76,65,53,43,34,25,18,12,
+     7,4,2,1,2,4,7,11,17,24,32,41,51,61,72,84,96,109,121,134,147,159,171,182,
+     193,204,213,222,229,236,242,247,251,253,255,255,254,253,250,246,241,236,229,222,215,206,197,188,
+     178,168,158,147,137,127,116,106,96,87,78,69,60,52,45,38,32,26,21,16,12,9,6,4,
+     2,1,1,1,2,3,5,7,9,12,15,19,22,27,31,35,40,45,50,55,60,65,71,76,
+     81,87,92,97,102,107,112,117,121,126,130,135,139,143,147,151,154,158,161,164,167,170,172,175,
+     177,179,182,183,185,187,188,190,191,192,193,194,195,196,196,197,197,197,197,197,197,197,196,196,
+     195,194,193,192,191,190,188,187,185,183,182,179,177,175,172,170,167,164,161,158,154,151,147,143,
+     139,135,130,126,121,117,112,107,102,97,92,87,81,76,71,65,60,55,50,45,40,35,31,27,
+     22,19,15,12,9,7,5,3,2,1,1,1,2,4,6,9,12,16,21,26,32,38,45,52,
+     60,69,78,87,96,106,116,127,137,147,158,168,178,188,197,206,215,222,229,236,241,246,250,253,
+     254,255,255,253,251,247,242,236,229,222,213,204,193,182,171,159,147,134,121,109,96,84,72,61,
+     51,41,32,24,17,11,7,4,2,1,2,4,7,12,18,25,34,43,53,65,76,89,102,115,
+    },
+};
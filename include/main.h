@@ -5,6 +5,11 @@ int versionNumber = 141;
 #include <MIDI.h>
 #include <TB2_LCD.h>
 #include <SdFat.h>
+#include <TB2_Debounce.h>
+#include <TB2_Tuning.h>
+#include <TB2_Wave.h>
+#include <TB2_Patch.h>
+#include <TB2_Flash.h>
 
 // *** SD CARD ***
 // SD chip select pin
@@ -14,7 +19,6 @@ SdFat sd;
 SdFile file;
 char fileName[13];
 char folderName[13];
-int16_t waveShapeBuffer[600];
 uint16_t dirCount = 0; // count how many files are in a directory
 int dirChoice = 999;   // nothing is selected yet
 uint16_t tempCount = 0;
@@ -23,12 +27,109 @@ boolean folder = false;
 boolean inFolder = false; // are we in a folder?
 boolean justEnteredFolder = false;
 boolean dirChecked = false; // have we run through the directory to see how many files are inside?
+// *** DIRECTORY INDEX ***
+#define DIR_ENTRIES 100 // entries indexed per folder, the browsers walk the folder for any past this
+typedef struct
+{
+  char name[13];
+  boolean isDir;
+  uint16_t index; // position in the folder, so the entry can be opened without a search
+  uint32_t size;
+  uint32_t firstCluster;
+} dirEntry;
+dirEntry dirIndex[DIR_ENTRIES]; // the current folder, built on entry and invalidated by writes and folder changes
+boolean dirIndexValid = false;
+char currentFolder[13] = ""; // the folder the browsers are in, empty for the root
+
+// *** PATCH FORMAT ***
+// also used by the sequence banks - the layout and the record reader and writer are in TB2_Patch.h, these are where the bytes go
+#define PATCH_FILE_BLOCKS 12  // preallocated for multi-block saves - enough for the worst packed waves
+typedef struct
+{
+  SdFile *file;
+  int *param;                    // the patch cache entry being filled
+  uint16_t (*wave)[WAVE_SAMPLES];
+  boolean legacy;  // a file from before the header
+  uint32_t remaining; // unread bytes in the file
+  uint32_t crc;
+  uint32_t expectedCrc;
+  uint32_t position; // bytes parsed since the header
+  boolean failed;    // a short read
+  uint16_t offset; // legacy files - ints read so far
+  boolean direct;  // multi-block reads straight from the card
+  uint32_t firstBlock;
+  uint16_t blockUsed; // bytes of sdScratch already fetched
+  uint32_t base;   // where the header starts - a slot of a slot store
+  const byte *flash;  // reading a copy in the flash store instead of a file
+  uint32_t flashSize;
+  uint32_t flashUsed;
+  byte used;       // bytes of the chunk already parsed
+  byte filled;     // bytes in the chunk
+  byte chunk[PATCH_CHUNK];
+} patchReader;
+typedef struct
+{
+  SdFile *file;
+  uint32_t length;
+  uint32_t crc;
+  boolean ok;
+  flashWriter *flash; // NULL unless writing to the flash store
+  boolean direct;     // multi-block writes straight to the card
+  uint16_t blockUsed; // bytes of sdScratch filled
+  byte used;
+  byte chunk[PATCH_CHUNK];
+} patchWriter;
+
+// *** PATCH CACHE ***
+// parsed patches kept in RAM, so stepping through a folder of patches needs no SD reads
+#define PATCH_CACHE 2         // 3.8KB each - the neighbour ahead first, then the one behind over the current patch, which is already applied
+#define PATCH_CACHE_PARAMS PATCH_PARAMS // patch slots 0 - 56
+#define PATCH_DWELL 250       // ms on a patch before its neighbours are prefetched
+typedef struct
+{
+  char folder[13];
+  char name[13];    // empty = unused
+  boolean complete; // false while it is still being prefetched
+  unsigned long lastUsed;
+  int param[PATCH_CACHE_PARAMS];
+  uint16_t wave[3][600]; // the user waves are 12 bit, no need for 32
+} cachedPatch;
+cachedPatch patchCache[PATCH_CACHE];
+SdFile prefetchFile;
+int8_t prefetchSlot = -1; // the entry being prefetched, -1 if none
+patchReader prefetchReader;
+unsigned long patchChoiceTime = 0; // when the current patch was loaded
+int patchChoice = 0;              // the browser entry it was loaded from
+int8_t patchStepDirection = 1;    // the way the user is stepping through the folder, prefetched first
+uint32_t patchCacheHits = 0;
+uint32_t patchCacheMisses = 0;
 boolean waveshapeLoaded = false;
 boolean synthPatchLoaded = false;
 boolean seqBankLoaded = false;
-int patchBuffer[1900];
-int seqBankBuffer[1600];
-int settingsBuffer[100];
+// loads and saves stream through one SD block instead of whole-file buffers
+#define SD_SCRATCH 128 // ints, 512 bytes
+#define SD_BLOCK 512
+int sdScratch[SD_SCRATCH];
+static_assert(sizeof(sdScratch) >= WAVE_SCRATCH, "resampleWave() reads WAVs through sdScratch");
+// patches and banks can bypass the file system's block cache, on files preallocated in one run of blocks
+int sdBlockIO = 0;                  // 0 = through the file system, 1 = multi-block
+unsigned long sdLoadTime[2] = {0, 0}; // us, the last load and save with each
+unsigned long sdSaveTime[2] = {0, 0};
+// a folder can keep its patches or banks in one preallocated file, so a save overwrites a fixed run of blocks
+int sdSlotStore = 0;              // 0 = a file each, 1 = slots of PATCHES.TBK and BANKS.TBK
+#define SLOT_PATCHES 64
+#define SLOT_BANKS 32
+unsigned long slotSaveTime = 0;   // us, the last and the slowest slot save
+unsigned long slotSaveWorst = 0;
+#define SEQ_BANK_INTS 1600 // a legacy .SEQ file is 1600 4 byte ints
+// .SEQ files since format 1 use the tagged layout of the patches, with a TB2S magic
+#define SEQ_BANK_FORMAT 1
+#define SEQ_TAG_PATTERN 1  // pattern, stored steps, settings, controller numbers, then 6 bytes per step
+#define SEQ_TAG_CC 2       // pattern, step, lane and value, repeated
+#define SEQ_TAG_MODE 3     // bankMode
+#define SEQ_PATTERN_HEAD 15 // pattern record bytes before the steps
+#define SEQ_BANK_BLOCKS 56  // preallocated for multi-block saves - enough for 64 full patterns
+extern "C" char *sbrk(int incr);
 boolean saveConfirm = false;
 int numberName = 0;
 char saveName[13] = {" "};
@@ -36,12 +137,44 @@ boolean loadRampDown = false;
 boolean loadRampUp = false;
 uint32_t loadRampFactor = 1023;
 
+// *** PATCH HANDOVER ***
+// a loaded patch is parsed into the cache, the inactive set, and handed over from there - Mute is the old ramp down and up
+#define HANDOVER_MUTE 0 // ramp the output down, change, ramp it up again
+#define HANDOVER_NOTE 1 // change as the next note starts, while the envelope is at the bottom of its retrigger
+#define HANDOVER_FADE 2 // glide the continuous parameters over patchFadeTime, switch the rest halfway
+#define HANDOVER_TICK 10 // ms between fade steps, some setters rebuild a 4096 entry table
+int patchHandover = HANDOVER_MUTE;
+int patchFadeTime = 200;  // ms
+int8_t handoverSlot = -1; // the cache entry being handed over, -1 if none
+int handoverFrom[PATCH_CACHE_PARAMS]; // the active set when the handover started
+unsigned long handoverStart = 0;
+unsigned long handoverTick = 0;
+boolean handoverSwitched = false; // the waves and discrete parameters have changed over
+#define HANDOVER_WAIT 2000 // ms a Note handover waits for a note, then it fades instead
+boolean handoverDue = false;    // a note is waiting at the bottom of its retrigger for updateHandover() to put the patch in
+boolean handoverFading = false; // a Note handover that waited too long
+// the SD reads of the incoming patch are done when the handover begins, so putting it in only changes RAM
+int8_t handoverTuningRead = 0;    // 1 = handoverTuning holds its scale, -1 = the scale is broken, 0 = keep the current one
+scaleTuning handoverTuning;
+int8_t handoverWavetableRead = 0; // 1 = handoverWavetableFile is open on its bank, -1 = the bank can't be read, 0 = keep the current one
+SdFile handoverWavetableFile;
+waveFormat handoverWavetableFormat;
+
+// *** MORPH ***
+// two favourites held in the patch cache, and everything between them on one control
+#define MORPH_TICK 10 // ms between morph steps, like HANDOVER_TICK
+int morphFavourite[2] = {1, 2};  // A and B, favourites 1 - 8
+int8_t morphSlot[2] = {-1, -1};  // their cache entries, pinned while the morph is on - -1 = off
+int morphAmount = 0;             // 0 = all A, 1023 = all B
+int lastMorphAmount = -1;
+unsigned long morphTick = 0;
+byte morphWaves = 0;             // bit per user wave that differs between A and B
+
 // *** LCD ***
 // initialize the LCD library with the numbers of the interface pins
 LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
 
 // *** BUTTONS ***
-#define DEBOUNCE 10 // button debouncer, how many ms to debounce, 5+ ms is usually plenty
 // here is where we define the buttons that we'll use. button "1" is the first, button "6" is the 6th, etc
 byte buttons[] = {22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36}; // the analog 0-5 pins are also known as 14-19
 // This handy macro lets us determine how big the array up above is, by checking the size
@@ -49,6 +182,28 @@ byte buttons[] = {22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36}; /
 // we will track if a button is just pressed, just released, or 'currently pressed'
 byte pressed[NUMBUTTONS], justpressed[NUMBUTTONS], justreleased[NUMBUTTONS];
 
+// the buttons are spread over PIOA - PIOD, so we read the four data status registers and map them to a bitmask
+Pio *const buttonPorts[4] = {PIOA, PIOB, PIOC, PIOD};
+byte buttonPort[NUMBUTTONS];             // which of the ports above each button lives on
+uint32_t buttonPin[NUMBUTTONS];          // the button's bit in that port
+uint16_t buttonState = 0;                // debounced state - bit n set means button n is held
+unsigned long buttonEdgeTime[NUMBUTTONS]; // millis() of the last accepted edge, for the lockout
+
+// the scanner turns edges into timestamped events, so nothing gets lost between loop passes
+#define BUTTON_EVENTS 16 // size of the event queue, the event types and timings are in TB2_Debounce.h
+typedef struct
+{
+  byte type;
+  byte key;
+  byte held;          // which shift key (13 or 14) was held at the time, 255 = none
+  unsigned long time; // millis()
+} buttonEvent;
+buttonEvent buttonEventQueue[BUTTON_EVENTS];
+byte buttonEventHead = 0;
+byte buttonEventTail = 0;
+uint16_t buttonEventsDropped = 0;
+buttonTimers buttonTimer = {0, 0, NO_SHIFT, {0}};
+
 byte lastPressed = 0;
 
 boolean shiftL = false;
@@ -67,7 +222,18 @@ boolean LEDon; // a boolean to keep track of whether the LED should be turned on
 int pot[5];                  // to store the values of out 5 pots
 int potLock[5];              // to lock the pots when they're not being adjusted
 unsigned long lockTimer = 0; // keep track oof millis() to see if it's time to lock the pots
-int lastPotValue[5];         // keep track of the last value so hte pot doesn't lock while you're adjusting it
+int potFilter[5];            // one-pole filtered pot values, 12 bits with 4 fractional bits
+unsigned long potMoveTime[5]; // when each pot last moved - resting pots get a wider hysteresis
+byte potChanged = 0;         // bit n is set for one loop pass when pot n has really moved
+
+// the ADC runs free over the five pot channels and the PDC drops the conversions into a ring of buffers
+#define POT_OVERSAMPLE 16                  // conversions per pot in each buffer, averaged in getPots()
+#define POT_DMA_BUFFERS 3                  // the PDC fills one while the next is queued, so the third is always safe to read
+uint16_t potDmaBuffer[POT_DMA_BUFFERS][POT_OVERSAMPLE * 5];
+volatile byte potDmaHead = 0;              // the buffer the PDC is currently filling
+volatile byte potDmaReady = POT_DMA_BUFFERS; // the last completed buffer, POT_DMA_BUFFERS until the first one is done
+byte potChannel[16];                       // maps ADC channel numbers back to pots 0 - 4 (255 = not a pot)
+int potHiRes[5];                           // 12 bit averaged pot values - pot[] holds the same thing scaled to 10 bits
 
 // *** SYNTH ***
 // the phase accumulator points to the current sample in our wavetable
@@ -77,43 +243,66 @@ uint32_t ulPhaseAccumulator[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 // higher values = higher frequencies
 volatile uint32_t ulPhaseIncrement[8] = {0, 0, 0, 0, 0, 0, 0, 0}; // 32 bit phase increment, see below
 
-// full waveform = 0 to SAMPLES_PER_CYCLE
-// Phase Increment for 1 Hz =(SAMPLES_PER_CYCLE_FIXEDPOINT/SAMPLE_RATE) = 1Hz
-// Phase Increment for frequency F = (SAMPLES_PER_CYCLE/SAMPLE_RATE)*F
-#define SAMPLE_RATE 44100.0
-#define SAMPLES_PER_CYCLE 600
-#define SAMPLES_PER_CYCLE_FIXEDPOINT (SAMPLES_PER_CYCLE << 20)
-#define TICKS_PER_CYCLE (float)((float)SAMPLES_PER_CYCLE_FIXEDPOINT / (float)SAMPLE_RATE)
+// full waveform = 0 to SAMPLES_PER_CYCLE, see TB2_Tuning.h for the rate and the pitch tables
 
 // to represent 600 we need 10 bits
 // Our fixed point format will be 10P22 = 32 bits
 
 // We have 521K flash and 96K ram to play with
+// this file's static RAM is about 70K (2.4K data, 68K bss), 6.3K more than before the patch cache and snapshots: those two
+// are 7.7K and 7.3K, then the slot index 2.4K, wavetable frames 2.4K and the sequencer pools 2K. The parameter registry
+// and its pages are constexpr, so they stay in flash. The rest, less the core's and SdFat's own, is the stack and the
+// heap - the info page shows what's left between them
+
+// *** CONSTANT TABLES ***
+// the tables that never change are worked out by the compiler and stay in flash - nothing to compute at boot, and no SRAM
+// C++11 constexpr functions are a single return, so the maths is recursive - constPow2() and the index packs are in TB2_Tuning.h, constSin() in TB2_Wave.h
 
 // Create a table to hold the phase increments we need to generate midi note frequencies at our 44.1Khz sample rate
-#define MIDI_NOTES 128
-uint32_t nMidiPhaseIncrement[MIDI_NOTES];
+uint32_t nMidiPhaseIncrement[MIDI_NOTES]; // retuned by loading a scale, so it's a copy of equalTemperament in RAM
+#define PATCH_VERSION 1     // stored in patch slot 45 - 0 is the format from before osc2Detune was in pitch units
+
+// Create a table to hold pre computed sinewave, the table has a resolution of WAVE_SAMPLES (600, from TB2_Wave.h) samples
 
-// Create a table to hold pre computed sinewave, the table has a resolution of 600 samples
-#define WAVE_SAMPLES 600
+template <typename indices>
+struct constTables;
+template <int... I>
+struct constTables<tableIndices<I...>>
+{
+  static constexpr uint16_t sine[sizeof...(I)] = {(uint16_t)(((1 + constSin(((2.0 * PI) / WAVE_SAMPLES) * I)) * 4095.0) / 2)...};
+  static constexpr uint16_t saw[sizeof...(I)] = {(uint16_t)((4095 / WAVE_SAMPLES) * I)...};
+  static constexpr uint16_t triangle[sizeof...(I)] = {(uint16_t)((I < WAVE_SAMPLES / 2) ? (4095 / (WAVE_SAMPLES / 2)) * I : (4095 / (WAVE_SAMPLES / 2)) * (WAVE_SAMPLES - I))...};
+};
+template <int... I>
+constexpr uint16_t constTables<tableIndices<I...>>::sine[sizeof...(I)];
+template <int... I>
+constexpr uint16_t constTables<tableIndices<I...>>::saw[sizeof...(I)];
+template <int... I>
+constexpr uint16_t constTables<tableIndices<I...>>::triangle[sizeof...(I)];
+
+typedef constTables<makeTableIndices<WAVE_SAMPLES>::type> waveTables;
 // default int is 32 bit, in most cases its best to use uint32_t but for large arrays its better to use smaller
 // data types if possible, here we are storing 12 bit samples in 16 bit ints
-uint16_t nSineTable[WAVE_SAMPLES];
-uint16_t nSquareTable[WAVE_SAMPLES];
-uint16_t nSawTable[WAVE_SAMPLES];
-uint16_t nTriangleTable[WAVE_SAMPLES];
+const uint16_t (&nSineTable)[WAVE_SAMPLES] = waveTables::sine;
+const uint16_t (&nSawTable)[WAVE_SAMPLES] = waveTables::saw;
+const uint16_t (&nTriangleTable)[WAVE_SAMPLES] = waveTables::triangle;
+uint16_t nSquareTable[WAVE_SAMPLES]; // the pulse width changes it
 uint16_t nUserTable1[WAVE_SAMPLES];
 uint16_t nUserTable2[WAVE_SAMPLES];
 uint16_t nUserTable3[WAVE_SAMPLES];
+#include <factoryWaves.h> // 8 bit waves read straight from flash - by the audio ISR too, so flash_store.ld keeps them in bank 0. Made by tools/wav2tb2.py
 
 int pulseWidth = 0;
 int uiPulseWidth = 0; // the value set by the user
 
-uint16_t *wavePointer[8];
+const uint16_t *wavePointer[8];
+const uint8_t *waveBytes[8]; // a factory wave, NULL when the voice plays wavePointer
 int osc1WaveType = 1;
 int osc2WaveType = 1;
+int osc1Factory = 0; // which factory wave when the wave type is Fac
+int osc2Factory = 0;
 
-byte waveshapes = 8; // how many waveshapes are there? sine, triangle, saw, square, user1, user2, user3, noise
+byte waveshapes = 10; // how many waveshapes are there? sine, triangle, saw, square, user1, user2, user3, noise, factory, wavetable
 
 uint32_t ulInput[8];
 
@@ -123,9 +312,7 @@ uint32_t lfoAccumulator = 0;
 volatile uint32_t lfoIncrement = 1; // 32 bit phase increment, see below
 
 int osc1Detune = 0;     // -24 - +24 semitones
-int osc2Detune = 0;     // range +- 32767
-int lastOsc1Detune = 0; //
-int lastOsc2Detune = 0;
+int osc2Detune = 0;     // -256 - +256, in pitch units (1/256 semitone)
 
 int osc1Volume = 1023;
 int osc2Volume = 1023;
@@ -155,6 +342,56 @@ int lastFilterCutoff = 0; // needed so we can switch back to the front-panel key
 int filterResonance = 0;
 int filterType = 0; // 0 = LP, 1 = BP, 2 = HP
 
+// *** SNAPSHOTS ***
+// whole parameter sets held in RAM, recalled from the keys or a MIDI program change without touching the card
+// unless the snapshot names a tuning or wavetable bank other than the current one - that is read at recall, as a patch load does
+#define SNAPSHOTS 16 // two groups of 8 on the white keys
+#define SNAPSHOT_WAVES 3 // user waves shared between the snapshots - most keep the waves they were taken with
+#define SNAPSHOT_EMPTY 0
+#define SNAPSHOT_STORED 1
+#define SNAPSHOT_NO_WAVES 2 // the pool had no room for its waves - recalling it keeps the current ones, shown as * on the page
+#define SNAPSHOT_SYNC_DELAY 2000 // ms after the last store before the copy in flash is brought up to date
+typedef struct
+{
+  byte used;                     // SNAPSHOT_EMPTY, SNAPSHOT_STORED or SNAPSHOT_NO_WAVES
+  int8_t wave[3];                // the pool entry for each user wave, -1 keeps the current one
+  int param[PATCH_CACHE_PARAMS]; // patch slots, as savePatch() packs them
+} snapshot;
+typedef struct
+{
+  snapshot slot[SNAPSHOTS];
+  uint16_t wave[SNAPSHOT_WAVES][WAVE_SAMPLES];
+} snapshotBank;
+snapshotBank snapshots;
+int snapshotGroup = 0;       // which 8 snapshots the white keys recall
+int snapshotSync = 0;        // 0 = RAM only, 1 = kept in flash too
+boolean snapshotDirty = false;
+unsigned long snapshotStoreTime = 0;
+int32_t snapshotSyncOffset = -1; // bytes of the bank written so far, -1 if no sync is under way
+flashWriter snapshotFlash;       // the copy being synced
+
+// *** FLASH ***
+// a store at the top of flash bank 1, well clear of the sketch in bank 0 - works without a card, and recalls without SD reads
+// the copies and records are in TB2_Flash.h, flash_store.ld stops the link if the sketch reaches FLASH_STORE_START
+#define FLASH_STORE_START 0xE0000 // the top 128K of bank 1
+#define FLASH_STORE_END 0x100000  // the end of bank 1
+#define FLASH_SNAPSHOTS 0 // first, so adding it left the other areas where they were
+#define FLASH_SETTINGS 1
+#define FLASH_PATCHES 2
+#define FLASH_BANK 3
+#define FLASH_AREAS 4
+#define FLASH_FAVOURITES 8
+#define SNAPSHOT_PAGES ((sizeof(snapshotBank) + FLASH_PAGE - 1) / FLASH_PAGE)
+// favourites are saved by hand and seldom, so they keep a single copy - 50K rather than 100K
+constexpr flashArea flashAreas[FLASH_AREAS] = {{1, 2, SNAPSHOT_PAGES}, {1, 4, 2}, {FLASH_FAVOURITES, 1, PATCH_FILE_BLOCKS * 2}, {1, 2, SEQ_BANK_BLOCKS * 2}};
+static_assert(flashStoreBytes(flashAreas, FLASH_AREAS, 0) <= FLASH_STORE_END - FLASH_STORE_START, "the flash store has outgrown FLASH_STORE_START");
+uint32_t flashPage[FLASH_PAGE / 4]; // staged here, the controller writes a page at a time
+bool writeFlashPage(uint8_t *address, const uint32_t *page); // in FLASH
+const flashStore flashMemory = {(uint8_t *)FLASH_STORE_START, FLASH_STORE_END - FLASH_STORE_START, flashAreas, FLASH_AREAS, flashPage, writeFlashPage};
+boolean sdAvailable = false;
+int flashChoice = 0; // the favourite on the favourites page
+int flashAction = 0; // 0 = load, 1 = save
+
 // *** UI ***
 boolean splash = true; // show the splash on bootup
 boolean uiRefresh = false;
@@ -166,16 +403,16 @@ int mainMenu = 0; // which main mode are we in?
 3 = SETTINGS
 */
 int lastMainMenu = 0;
+unsigned long bootTime = 0; // ms, shown with the diagnostics
 
 int menu = 0;
 boolean valueChange = false;
-int synthMenu[9] = {0, 10, 20, 30, 40, 50, 60, 65, 68};
+int synthMenu[12] = {0, 10, 20, 30, 40, 50, 60, 65, 68, 69, 75, 76};
 int arpMenu[3] = {0, 100, 110};
-int seqMenu[5] = {0, 200, 210, 220, 230};
+int seqMenu[6] = {0, 200, 210, 220, 230, 240};
 int menuChoice = 0;
 int menuPages = 0;
 int lastMenu = 0;
-unsigned long longPress = 0; // to keep track of millis() for long presses
 /*
 0 = SPLASH/MAIN
 SYNTH
@@ -267,8 +504,6 @@ byte osc1OctaveOut; // after modulation
 byte osc2OctaveOut;
 int osc1OctaveMod = 0;
 int osc2OctaveMod = 0;
-byte lastOsc1Octave = 4;
-byte lastOsc2Octave = 5;
 boolean keyAssigned[13] = {
     false, false, false, false,
     false, false, false, false,
@@ -300,9 +535,11 @@ int envFilterCutoffFactor = 0; // value between -1023 and 1023
 int envLfoRate = 0;
 
 // *** LFO ***
-uint16_t *lfoShapePointer = &nSineTable[0]; // pointer to the array for the waveshape we're using for the LFO
+const uint16_t *lfoShapePointer = &nSineTable[0]; // pointer to the array for the waveshape we're using for the LFO
+const uint8_t *lfoShapeBytes = NULL;               // a factory wave instead
 int16_t tmpLFO = 0;
 int lfoShape = 0;
+int lfoFactory = 0;
 int tmpLfoRate = 0; // directly set by user
 int lfoRate = 50;
 int userLfoRate = 50;
@@ -311,7 +548,7 @@ int lfoAmount = 0; // value between 0 and 1023
 int16_t tmpCutoff = 0;
 uint16_t lfoIndex = 0;
 int lfoLowRange = 1;
-boolean retrigger = true;
+int retrigger = true;
 int lfoOsc1Detune = 0;
 int lfoOsc2Detune = 0;
 int lfoOsc1DetuneFactor = 0;
@@ -319,7 +556,6 @@ int lfoOsc2DetuneFactor = 0;
 int lfoAmp = 0;
 int lfoAmpFactor = 0; // 0 to 1023
 int lfoPwFactor = 0;
-byte dest = 0;          // how many destinatiosn for a given source?
 boolean lfoLED = false; // do we want to send the current LFO value to the LED?
 boolean lfoSync = false;
 int lfoSyncCounter = 0;
@@ -331,8 +567,8 @@ int lfo8thSync = 1;
 int lfo8thSyncCounter = 0;
 
 // *** MODULATION ***
-int source = 0; // 0 = LFO, 1 = ENVELOPE, 2 = VELOCITY, 3 = USER CC ()
-int destination = 0;
+int source = 0; // 0 = LFO, 1 = ENVELOPE, 2 = VELOCITY
+int destination = 0; // numbered through all three sources, see below
 /*
 LFO
 0 = Osc1 pitch
@@ -400,37 +636,71 @@ int arpDivision[7] = {96, 64, 48, 32, 24, 16, 12}; // in clock pulses
 
 int currentDivision = 0;
 // *** SEQUENCER ***
+// a pattern holds only its settings - each bar of steps it uses takes a bar record from a shared pool, and the bar
+// takes a 16 byte block for each lane that isn't all rests: a voice's notes, the velocities, the flags or a CC lane
+// so a one bar melody costs 18 + 10 + 16 bytes, and 64 of them fit in the 3.1KB the 8 fixed patterns used to take
+// the pools are one budget for every pattern, well short of 64 full patterns of 64 steps: a bar using all 4 voices
+// with velocities and flags takes 6 blocks, so 14 such bars fill SEQ_BLOCKS - one 64 step pattern and a 48 step one
+// 64 x 64 steps of 4 voices would be 256 bars and 1536 blocks, about 27KB, more than the RAM left over
+// what does fit: 64 bars of 1 voice, or 42 bars of 1 voice with velocities, or 21 bars of 4 voices alone
+// a step that won't fit is dropped and seqPoolWarning() says so
+#define SEQ_PATTERNS 64       // 8 groups of the 8 the white keys select
+#define SEQ_MAX_STEPS 64
+#define SEQ_BAR_STEPS 16
+#define SEQ_BARS 64           // bar records shared by all the patterns, 10 bytes each
+#define SEQ_BLOCKS 84         // blocks shared by all the bars, 16 bytes each
+#define NO_BAR 255
+#define NO_BLOCK 255
+#define NO_PATTERN 255
+#define SEQ_LANE_VELOCITY 4   // a bar's lanes - 0 - 3 are the voices' notes
+#define SEQ_LANE_FLAGS 5
+#define SEQ_LANE_CC 6         // to 9, the 4 CC lanes
+#define SEQ_LANES 10
+#define NOTE_OFF_PACKED -128  // notes are stored as int8, relative to middle C
+#define SEQ_TIE 0             // step flags
+#define SEQ_MUTE 1
+#define SEQ_ACCENT 2
+typedef union
+{
+  int8_t note[SEQ_BAR_STEPS]; // a voice, NOTE_OFF_PACKED for a rest
+  byte value[SEQ_BAR_STEPS];  // the velocities or a CC lane, 255 for none
+  uint16_t flag[3];           // tie, mute and accent - a bit per step
+} seqBlock;
+
+typedef struct
+{
+  byte block[SEQ_LANES]; // NO_BLOCK for a lane that's all rests
+} seqBar;
+
 typedef struct Sequences
 {
-  int voice[4][16] = // voice number, step number - note number 0 - 127, 200 for tie, 255 for off
-      {
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255}};
-  boolean tie[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};  // is this step tied?
-  boolean mute[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}; // is this step muted?
-  byte velocity[16] =                                                  // velocity at this step
-      {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+  byte bar[SEQ_MAX_STEPS / SEQ_BAR_STEPS] = // the bar record for each 16 steps, NO_BAR for all rests
+      {NO_BAR, NO_BAR, NO_BAR, NO_BAR};
   byte controlNum[4] = // controller number
       {255, 255, 255, 255};
-  byte controlValue[4][16] = // the controller value
-      {
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
-          {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255}};
-  int noteDur = 1023;     // range 0 - 1023 (will be mapped from 4 pulses to the division)
-  int divSelection = 1;   // 16th is default (24 pulses) - selects from seqDivision[3] = {12, 24, 28}
-  int patternLength = 16; // how many steps in the sequence?
-  int transpose = 0;      // number of semitones to transpose by (up or down ie. pos or neg)
-  int swing = 0;
-  int bpm = 120; // set it to the default bpm
+  uint16_t noteDur = 1023;  // range 0 - 1023 (will be mapped from 4 pulses to the division)
+  uint16_t swing = 0;
+  uint16_t bpm = 120;       // set it to the default bpm
+  int8_t transpose = 0;     // number of semitones to transpose by (up or down ie. pos or neg)
+  byte divSelection = 1;    // 16th is default (24 pulses) - selects from seqDivision[3] = {12, 24, 28}
+  byte patternLength = 16;  // how many steps in the sequence?
 } sequence;
 
 int bankMode = 0; // 0 = loop 1, 1 = loop 2, 2 = loop 4, 3 = loop 8, 4 = random,
 
-sequence seq[8];    // create 8 sequence structs
+sequence seq[SEQ_PATTERNS];
+seqBar seqBars[SEQ_BARS];
+seqBlock seqBlocks[SEQ_BLOCKS];
+uint32_t seqBarUsed[(SEQ_BARS + 31) / 32];     // one bit per bar record
+uint32_t seqBlockUsed[(SEQ_BLOCKS + 31) / 32]; // one bit per block
+boolean seqPoolFull = false;                   // set when a step couldn't be stored, until seqPoolWarning() shows it
+#define SEQ_TRANSPOSE 0 // the pattern settings the increment buttons edit a copy of, as they're packed
+#define SEQ_LENGTH 1
+#define SEQ_DURATION 2
+#define SEQ_SWING 3
+int seqEditSetting[4];
+int seqGroup = 0;            // which 8 patterns the white keys select
+int seqEditNote[4];          // the edited step's notes, for the increment buttons
 int currentSeq = 0; // the currently selected sequence
 
 int seqDivision[3] = {12, 24, 28}; // in clock pulses
@@ -452,7 +722,6 @@ int loadBpm = true;  // do we want to allow sequences to change the tempo?
 int seqPlayMode = 0;
 byte sourceSeq = 0;      // used to copy sequences
 byte destinationSeq = 0; // used to copy sequences
-boolean copied = false;  // used to copy sequences
 boolean longStep = true; // is this the longer or shorter step of a swing pair
 int swingFactor = 0;     // a positive or negative value (in pulses) depending on if it's the longer or shorter step of a swing pair
 /*
@@ -463,6 +732,21 @@ int swingFactor = 0;     // a positive or negative value (in pulses) depending o
 4 = drunk
 5 = random step
 */
+
+// *** CC LANES ***
+#define SEQ_CC_INTERVAL 8 // minimum ms between glide CCs on a lane, so 4 lanes stay well inside 31250 baud
+int seqCCLane = 0;        // the lane shown on the CC lanes page
+int seqCCNum = 128;       // the CC number of that lane, 128 = off
+int seqCCGlide = 0;       // interpolate the lanes between steps at control rate?
+int seqCCRoute = 0;       // 0 = MIDI out only, 1 = also set the parameter the CC is mapped to
+volatile byte seqCCFrom[4] = {255, 255, 255, 255}; // this step's value per lane, 255 = hold
+volatile byte seqCCTo[4] = {255, 255, 255, 255};   // the next step's value per lane
+volatile unsigned long seqCCStepStart = 0;         // millis() at the start of the step
+volatile unsigned long seqCCStepLength = 1;        // in ms
+volatile byte seqCCLatch = 0;                      // bumped by the clock ISR once the four above are all written, see seqControlLanes()
+byte seqCCSent[4] = {255, 255, 255, 255};          // the last value output per lane, so unchanged values aren't resent
+unsigned long seqCCSentTime[4];
+byte seqCCTick = 0;
 boolean seqUpdateDisplay = false; // updating the display causes issues with audio playback - save it for non critical pulses
 
 // *** VELOCITY ***
@@ -492,10 +776,45 @@ int midiChannel = 1;   // which channel are we sending data on? 0 is off
 int keyVelocity = 127; // the fixed velocity of the front-panel keyboard
 
 boolean settingsConfirm = false;
-int settingsMenu[5] = {0, 300, 310, 320, 330};
+int settingsMenu[10] = {0, 300, 310, 320, 330, 340, 350, 360, 370, 380};
 
 int volume = 1023; // the output volume
 
+// *** SLEW ***
+// audio-critical parameters follow their pot/user value at a limited rate, so they don't zipper
+#define CONTROL_DIVIDER 22 // lfoHandler ticks per control tick - 22kHz / 22 = 1kHz
+typedef struct
+{
+  int *target; // the value as set by the user
+  int current; // the value the audio actually uses
+  int maxStep; // the most it can move per control tick
+} slewLimiter;
+slewLimiter cutoffSlew = {&filterCutoff, 0, 2}; // a full sweep takes 128ms
+slewLimiter volumeSlew = {&volume, 1023, 8};    // 0 - 1023 in 128ms
+
+// *** PERFORMANCE CONTROLLERS ***
+// the MIDI handlers only store the latest value, the control tick smooths them - so a dense bend stream costs nothing extra
+int bendIn = 0;                  // the latest pitch bend, -8192 - 8191
+int modWheelIn = 0;              // the latest mod wheel (CC1), 0 - 1016
+int pressureIn = 0;              // the latest channel pressure, 0 - 1016
+int bendRange = 2;               // in semitones
+int modVibrato = 0;              // mod wheel vibrato, in pitch units like lfoOsc1Detune
+int pressureCutoff = 0;          // added to the cutoff like the LFO
+slewLimiter bendSlew = {&bendIn, 0, 256};        // a full bend takes 64ms
+slewLimiter modWheelSlew = {&modWheelIn, 0, 16};
+slewLimiter pressureSlew = {&pressureIn, 0, 16};
+
+// *** TUNING ***
+// Scala .scl scales and .kbm keyboard maps from /TUNINGS on the SD
+#define TUNING_NOTES_PER_PASS 8    // increments rebuilt per loop pass, so a new tuning never stalls the loop
+SdFile tuningFile;                 // separate from file, so a tuning can load while a browser is open
+char tuningName[9] = "";           // the active scale without its extension, empty = 12-TET
+scaleTuning tuning;                // the scale and keyboard map, parsed and applied by TB2_Tuning.h
+byte tuningBuildNote = MIDI_NOTES; // the next increment to rebuild, MIDI_NOTES when the table is up to date
+int tuningChoice = 0;              // on the tuning page, 0 = 12-TET
+int tuningCount = -1;              // .SCL files in /TUNINGS, -1 until counted
+char tuningChoiceName[13] = "12-TET";
+
 // *** WAVESHAPER ***
 uint16_t waveShaper[4096]; // a lookup table to store waveshaped values
 float waveShapeAmount = 0.2;
@@ -504,6 +823,31 @@ int shaperType = 2; // 0 = off, 1 = type 1, 2 = type 2
 
 int bitMuncher = 0; // an effect where we lose accuracy by bitshifting right and left again - this variable is how many bits to shift by
 
+// *** WAVETABLE ***
+// a bank of up to 64 single cycle frames in one .WAV in /WTABLES, frames are paged into RAM as the position reaches them
+// the oscillators play nWavetable, the blend of the two frames either side of the position - rebuilt in the loop like the square table
+#define WAVETABLE_FRAMES 64      // the most frames in a bank
+#define WAVETABLE_CACHE 2        // frames held in RAM, 1200 bytes each - the two either side of the position
+SdFile wavetableFile;            // kept open while a bank is loaded, separate from file so frames can page in while a browser is open
+waveFormat wavetableFormat;      // the whole bank's sample data
+uint32_t wavetableFrameLength;   // .WAV frames in each wavetable frame
+byte wavetableFrames = 0;        // 0 = no bank loaded
+char wavetableName[9] = "";      // the loaded bank without its extension
+uint16_t wavetableCache[WAVETABLE_CACHE][WAVE_SAMPLES];
+int8_t wavetableCached[WAVETABLE_CACHE]; // the frame in each cache slot, -1 = empty
+uint32_t wavetableUsed[WAVETABLE_CACHE]; // when each slot was last blended, in wavetableTicks
+uint32_t wavetableTicks = 0;
+uint16_t nWavetable[WAVE_SAMPLES];
+int wavetablePosition = 0;       // 0 - 1023 from the first frame to the last
+int wavetableLfoFactor = 0;      // 0 - 1023 modulation depths
+int wavetableEnvFactor = 0;
+int wavetableVelFactor = 0;
+int velWavetable = 0;            // from the velocity of the last note
+int lastWavetablePosition = -1;
+int wavetableChoice = 0;         // on the bank page, 0 = none
+int wavetableCount = -1;         // .WAV files in /WTABLES, -1 until counted
+char wavetableChoiceName[13] = "None";
+
 // *** PORTAMENTO ***
 uint32_t portaStartTime = 0;
 uint32_t portaEndTime = 0;
@@ -520,9 +864,19 @@ void arpNextStep();
 void sortArp();
 
 // BUTTONS.ino
+void initButtons();
+uint16_t readButtons();
+uint16_t debounceButtons(uint16_t raw, unsigned long now);
 void checkSwitches();
+byte heldShift(byte index);
+boolean pushButtonEvent(byte type, byte key, byte held, unsigned long time);
+boolean popButtonEvent(buttonEvent *event);
 void clearJust();
 void handlePresses();
+void enterKey();
+void backKey();
+void keyPress(byte key);
+void chordPress(byte key, byte held);
 void checkKeyboard();
 void assignIncrementButtons(int *adjVar, int low, int up, int inc);
 void incDecSpecials();
@@ -699,9 +1053,18 @@ void setFeedbackq(long q);
 inline long fx(int i);
 inline long fxmul(long a, int b);
 
+// FLASH.ino
+boolean writeFlashTagged(byte area, byte slot, const char *magic, uint16_t format, void (*records)(patchWriter *));
+void openFlashReader(patchReader *reader, const flashRecord *record);
+int8_t readFlashPatch(byte favourite);
+boolean loadFlashBank();
+void flashFavourite();
+
 // LFO.ino
 static uint16_t lfoCounter = 0;
 void lfoHandler();
+void controlTick();
+boolean slewStep(slewLimiter *slew);
 void updateLFO();
 void setLfoShape(byte shape);
 void updateLfoSyncTarget();
@@ -722,8 +1085,215 @@ void checkForClock();
 void checkThru();
 void setSyncType();
 void clearCurrentNotes();
+void HandleCC(byte channel, byte number, byte value);
+void HandlePitchBend(byte channel, int bend);
+void HandleAfterTouchChannel(byte channel, byte pressure);
+void HandleProgramChange(byte channel, byte number);
+void queueCC(byte id, byte value);
+void applyPendingCC();
+void clearCCMapping(byte id);
+byte ccParam(byte channel, byte number);
+byte ccLearned(byte id, byte *channel);
+void loadCCMap(int *buffer);
+void saveCCMap(int *buffer);
+
+// MORPH.ino
+boolean loadMorph();
+void stopMorph();
+void updateMorph();
+boolean cachePinned(byte slot);
+void showMorphExtra();
+
+// PARAMS.ino
+
+// *** PARAMETER REGISTRY ***
+// every user-adjustable value has a stable ID (its index in params[]) that the pots, the display, the patch and
+// settings files, MIDI and snapshots can all use to address it
+#define NO_SLOT 255  // the parameter isn't stored in that file
+#define NO_PARAM 255 // no parameter on that pot
+#define NA_PARAM 254 // nothing on that pot with the current settings, shown as n/a
+
+// how a pot maps onto the parameter's range
+#define CURVE_LINEAR 0 // straight line from low to high
+#define CURVE_STEPS 1  // equal zones per value - for lists and toggles
+#define CURVE_CENTER 2 // linear, but snaps to the middle of the range around the pot's center
+#define CURVE_CUTOFF 3 // the exponential filter cutoff curve
+
+// how updateValues() prints it
+#define FORMAT_NUMBER 0
+#define FORMAT_QUARTER 1 // 0 - 1023 values shown as 0 - 255
+#define FORMAT_LIST 2    // 4 characters per value, taken from names
+#define FORMAT_CENTS 3   // pitch units shown in cents
+#define FORMAT_SIXTEENTH 4 // -1023 - 1023 values shown as -63 - 63
+#define FORMAT_SCALED 5    // the range shown as 0 - 255
+
+typedef struct
+{
+  const char *name;  // short label, used by the MIDI learn page
+  int *value;        // the variable itself
+  int low;           // the value at the pot's left end - can be higher than high to reverse the pot
+  int high;          // the value at the pot's right end
+  int increment;     // step size for the inc/dec buttons
+  byte curve;        // CURVE_ ...
+  byte format;       // FORMAT_ ...
+  const char *names; // value labels for FORMAT_LIST, 4 characters each, packed back to back
+  byte patchSlot;    // index in the patch file, NO_SLOT if it isn't saved with the patch
+  byte settingsSlot; // index in TB2PREFS.set, NO_SLOT if it isn't a setting
+  void (*apply)();   // called after the value changes, NULL if nothing else needs to happen
+} paramDescriptor;
+
+typedef struct
+{
+  int menu;           // the menu number of the page
+  const char *header; // the top line of the display
+  byte param[4];      // which parameter each of the 4 pots adjusts
+  void (*extra)();    // draws whatever the generic display can't, NULL if nothing
+  byte (*select)(byte pot, byte listed); // the parameter on a pot when that depends on other settings, NULL = always the listed one
+} paramPage;
+
+// the IDs are fixed - the first 41 match the slots of the patch file
+enum
+{
+  P_OSC1_WAVE,
+  P_OSC1_OCTAVE,
+  P_OSC1_VOLUME,
+  P_OSC1_DETUNE,
+  P_PULSE_WIDTH,
+  P_OSC2_WAVE,
+  P_OSC2_OCTAVE,
+  P_OSC2_VOLUME,
+  P_OSC2_DETUNE,
+  P_CUTOFF,
+  P_RESONANCE,
+  P_FILTER_TYPE,
+  P_FILTER_BYPASS,
+  P_ATTACK,
+  P_DECAY,
+  P_SUSTAIN,
+  P_RELEASE,
+  P_LFO_SHAPE,
+  P_LFO_RATE,
+  P_LFO_LOW_RANGE,
+  P_LFO_RETRIGGER,
+  P_LFO_OSC1,
+  P_LFO_OSC2,
+  P_LFO_OCT1,
+  P_LFO_OCT2,
+  P_LFO_CUTOFF,
+  P_LFO_AMP,
+  P_LFO_PW,
+  P_ENV_OSC1,
+  P_ENV_OSC2,
+  P_ENV_CUTOFF,
+  P_ENV_LFO_RATE,
+  P_SHAPER_TYPE,
+  P_SHAPER_AMOUNT,
+  P_SHAPER_AMOUNT2,
+  P_GAIN,
+  P_BIT_MUNCHER,
+  P_PORTAMENTO,
+  P_MONO_MODE,
+  P_UNISON,
+  P_UNI_SPREAD,
+  P_VEL_OSC1,
+  P_VEL_OSC2,
+  P_VEL_CUTOFF,
+  P_VEL_AMP,
+  P_VEL_PW,
+  P_VEL_LFO_RATE,
+  P_ARP,
+  P_ARP_DIV,
+  P_ARP_DUR,
+  P_BPM,
+  P_ARP_DIR,
+  P_ARP_TYPE,
+  P_ARP_OCTAVES,
+  P_MIDI_OUT,
+  P_MIDI_CHANNEL,
+  P_MIDI_THRU,
+  P_MIDI_SYNC,
+  P_KEYS_OUT,
+  P_KEY_VELOCITY,
+  P_TRIGGER_OUT,
+  P_TRIGGER_CHANNEL,
+  P_VOLUME,
+  P_SEQ_CC_GLIDE,
+  P_SEQ_CC_ROUTE,
+  P_BEND_RANGE,
+  P_SD_BLOCKS,
+  P_SLOT_STORE,
+  P_OSC1_FACTORY,
+  P_OSC2_FACTORY,
+  P_LFO_FACTORY,
+  P_WAVETABLE_POSITION,
+  P_WAVETABLE_LFO,
+  P_WAVETABLE_ENV,
+  P_WAVETABLE_VEL,
+  P_HANDOVER,
+  P_FADE_TIME,
+  P_MORPH_A,
+  P_MORPH_B,
+  P_MORPH,
+  P_SNAPSHOT_GROUP,
+  P_SNAPSHOT_SYNC,
+  P_MOD_SOURCE,
+  P_MOD_DEST_LFO,
+  P_MOD_DEST_ENV,
+  P_MOD_DEST_VEL,
+  PARAMS // how many there are
+};
+
+void applyOsc1Wave();
+void applyOsc2Wave();
+void applyPulseWidth();
+void applyResonance();
+void applyFilterType();
+void applyLfoShape();
+void applyLfoRate();
+void applyModSource();
+byte selectModParam(byte pot, byte listed);
+byte selectShaperParam(byte pot, byte listed);
+byte selectMonoParam(byte pot, byte listed);
+void showMonoExtra();
+void applyShaperAmount();
+void applyGain();
+void applyArp();
+void showOsc1Extra();
+void showOsc2Extra();
+void showFactoryName();
+const paramPage *currentParamPage = NULL; // the page for the current menu, looked up once when the menu changes
+int currentParamMenu = -1;
+
+// *** CC MAP ***
+#define CC_SLOT 30     // the CC mappings live in TB2PREFS.set from this slot on
+#define SETTING_ZERO -1 // a real 0 in a slot that older TB2PREFS.set files leave at 0, like volume's 1025
+#define CC_MAPPINGS 70 // slots 30 - 99, one packed int per mapping
+#define NO_CC 0xFFFF
+uint16_t ccMap[PARAMS]; // the CC each parameter is mapped to, channel << 8 | number, NO_CC if none - one CC per parameter
+byte ccPendingValue[PARAMS];     // the latest CC value received for each parameter
+uint32_t ccPending[(PARAMS + 31) / 32]; // one bit per parameter with a CC value waiting to be applied
+volatile byte controlTicks = 0;  // counts control ticks, so the loop knows when a new one has passed
+byte ccAppliedTick = 0;
+int ccLearnParam = 0; // the parameter selected on the learn page
+int ccLearn = 0;      // 0 = off, 1 = the next CC received gets mapped to ccLearnParam, 2 = clear its mapping
+
+const paramPage *findParamPage();
+byte pageParam(const paramPage *page, byte pot);
+int paramFromPot(byte id, int potValue);
+void applyParam(byte id);
+boolean setParam(byte id, int value);
+boolean paramGlides(byte id);
+void blendParams(const int *from, const int *to, int32_t amount);
+byte paramByValue(int *value);
+boolean adjustParamPage();
+void showParam(byte col, byte id);
+boolean showParamPage();
+void loadParams(int *buffer, boolean settings, boolean force);
+void saveParams(int *buffer, boolean settings);
 
 // POTS.ino
+void initPots();
+void ADC_Handler();
 void getPots();
 void lockPot(byte Pot);
 boolean unlockedPot(byte Pot);
@@ -732,34 +1302,65 @@ void getMenu();
 void getSyncSelector();
 
 // SD.ino
-
-// *** WAVE FILE HEADER ***
-typedef struct
-{
-  char RIFF[4];
-  int32_t chunk_size;
-  char WAVE[4];
-  char fmt_[4];
-  int32_t subchunk1_size;
-  int16_t audio_format;
-  int16_t num_channels;
-  int32_t sample_rate;
-  int32_t byte_rate;
-  int16_t block_align;
-  int16_t bits_per_sample;
-  char DATA[4];
-  int32_t subchunk2_size;
-} wave_header;
-
-wave_header header;
-
 void getWaveform();
 void getDirCount();
+void indexDir();
+boolean selectDirChoice();
+boolean openDirChoice();
+boolean openDirEntry(SdFile *target, int choice);
+const char *slotStoreName();
+byte slotCount();
+uint16_t slotBlocks();
+void indexSlots();
+int firstFreeSlot();
+boolean emptySlot();
+void applySlotStore();
 void loadWaveshape();
 boolean checkExtension(char ext[]);
+int countFolderFiles(const char *folder, const char *extension);
+boolean getFolderFileName(const char *folder, const char *extension, int choice, char *name);
+void packName(int *buffer, byte slot, const char *name);
+void unpackName(int *buffer, byte slot, char *name);
 void savePatch();
 void loadPatch();
 void loadProceed();
+void beginHandover(int8_t slot);
+void stageHandover(int8_t slot);
+void dropHandover();
+void updateHandover();
+void fadeHandover();
+void finishHandover();
+void applyCachedWaves(int8_t slot);
+int8_t findCachedPatch(const char *name);
+int8_t claimCachedPatch(const char *name);
+void finishCachedPatch(int8_t slot);
+void applyCachedPatch(int8_t slot, boolean files);
+void applyPatchParams(int *param, boolean files);
+int8_t readPatch();
+int8_t flashFavouriteName(const char *name);
+boolean openPatchReader(patchReader *reader, SdFile *source, int8_t slot, boolean blocks);
+boolean readTaggedHeader(patchReader *reader, SdFile *source, const char *magic);
+boolean verifyTaggedFile(patchReader *reader);
+boolean restartTaggedFile(patchReader *reader, uint32_t length);
+boolean rewindPatchReader(patchReader *reader, uint32_t position);
+boolean beginBlockRead(patchReader *reader, SdFile *source);
+void endBlockRead(patchReader *reader);
+int fetchPatchBytes(patchReader *reader, byte *data, uint16_t count);
+boolean putPatchBytes(patchWriter *writer, const byte *data, uint16_t count);
+void beginTaggedFile(patchWriter *writer, SdFile *target);
+boolean endTaggedFile(patchWriter *writer, const char *magic, uint16_t format);
+boolean saveTaggedFile(const char *name, const char *magic, uint16_t format, uint16_t blocks, void (*records)(patchWriter *));
+boolean saveTaggedBlocks(const char *name, const char *magic, uint16_t format, uint16_t blocks, void (*records)(patchWriter *));
+boolean openContiguous(const char *name, uint16_t blocks, uint32_t *firstBlock);
+boolean writeTaggedRun(uint32_t firstBlock, uint16_t blocks, const char *magic, uint16_t format, void (*records)(patchWriter *));
+boolean saveSlot(byte slot, const char *magic, uint16_t format, void (*records)(patchWriter *));
+boolean openSlotStore(uint32_t *firstBlock);
+void appendBlockBytes(patchWriter *writer, const void *data, uint16_t count);
+void writePatchRecords(patchWriter *writer);
+void writeBankRecords(patchWriter *writer);
+uint16_t writeSeqCCEvents(patchWriter *writer);
+void forgetCachedPatch(const char *name);
+void prefetchPatches();
 void setFolder();
 void getSynthPatch();
 void saveSynthPatch();
@@ -769,9 +1370,15 @@ void saveSeqBank();
 void saveBank();
 void loadBank();
 void getSeqBank();
-void unpackSeqBankBuffer();
+void setSeqBankValue(int index, int value);
+boolean unpackSeqBank();
+boolean seqBankFits(patchReader *reader);
+boolean readBankRecords(patchReader *reader);
+int freeMemory();
 void loadSettings();
 void saveSettings();
+void unpackSettings();
+int savedSetting(int stored, int current);
 void gotoRootDir();
 
 // SEQUENCER.ino
@@ -783,15 +1390,40 @@ void seqPlayStop();
 void cueNextSeq();
 boolean updateSeqNotes();
 void clearStep();
+void seqControlLanes();
+void resetSeqPattern(byte pattern);
+void clearSeqPool();
+int claimSeqPool(uint32_t *used, byte size);
+byte seqLaneFill(byte lane);
+seqBlock *seqLane(byte pattern, int step, byte lane, boolean create);
+void tidySeqLane(byte pattern, int step, byte lane);
+int seqNote(byte pattern, byte v, int step);
+void setSeqNote(byte pattern, byte v, int step, int note);
+byte seqVelocity(byte pattern, int step);
+void setSeqVelocity(byte pattern, int step, byte velocity);
+boolean seqFlag(byte pattern, int step, byte flag);
+void setSeqFlag(byte pattern, int step, byte flag, boolean on);
+byte seqControlValue(byte pattern, byte lane, int step);
+void setSeqControlValue(byte pattern, byte lane, int step, byte value);
+void freeSeqPattern(byte pattern);
+boolean seqPatternEmpty(byte pattern);
+void setSeqSetting(byte setting, int value);
+void seqPoolWarning();
+void editSeqNotes();
+
+// SNAPSHOT.ino
+void storeSnapshot(byte n);
+boolean recallSnapshot(byte n);
+void syncSnapshots();
+void loadSnapshots();
+void showSnapshotExtra();
 
 // SYNTH.ino
-void createNoteTable(float fSampleRate);
-void createSineTable();
+void createNoteTable();
 void createSquareTable(int16_t pw);
-void createSawTable();
-void createTriangleTable();
 void clearUserTables();
 void audioHandler();
+uint32_t pitchToIncrement(int32_t pitch);
 void assignVoices();
 void setOsc1WaveType(int shape);
 void setOsc2WaveType(int shape);
@@ -799,6 +1431,14 @@ void createOsc1Volume();
 void createOsc2Volume();
 void createGainTable();
 
+// TUNING.ino
+void resetTuning();
+int8_t readTuning(const char *name, scaleTuning *t);
+boolean loadTuning(const char *name);
+void rebuildTuning();
+void countTunings();
+void getTuningName(int choice);
+
 // UI.ino
 void updateLED();
 void showValue(byte h, byte v, int number);
@@ -808,6 +1448,7 @@ void arrow(byte x, byte y);
 void arrowAnim();
 void showTB2(byte x);
 void showSequence();
+byte seqEditPage();
 void seqBlinker();
 void showStep(byte Step);
 void clearLCD();
@@ -817,3 +1458,12 @@ void setVeloModulation(byte velocity);
 
 // WAVESHAPER.ino
 void createWaveShaper();
+
+// WAVETABLE.ino
+boolean openWavetable(const char *name, SdFile *bank, waveFormat *format);
+boolean loadWavetable(const char *name);
+void useWavetable(const char *name);
+void unloadWavetable();
+const uint16_t *wavetableFrame(byte frame);
+void updateWavetable();
+void getWavetableName(int choice);
@@ -0,0 +1,99 @@
+#ifndef TB2_Debounce_h
+#define TB2_Debounce_h
+
+#include <inttypes.h>
+
+// the front-panel debounce and button events, kept clear of the hardware so the host tests can replay traces through them
+#define DEBOUNCE 10 // lockout in ms after an edge - the edge itself is reported right away, bounces inside the lockout are ignored
+
+inline uint16_t debounceKeys(uint16_t raw, unsigned long now, uint16_t *state, unsigned long *edgeTime, uint8_t keys)
+{
+  // per-key state machine - the first edge is taken immediately, then the key ignores any change for DEBOUNCE ms
+  // state holds the debounced keys, edgeTime the last accepted edge of each - returns the keys whose debounced state changed
+  uint16_t changed = 0;
+  uint16_t differs = raw ^ *state;
+  for (uint8_t i = 0; i < keys; i++)
+  {
+    if ((differs & (1 << i)) && (now - edgeTime[i]) >= DEBOUNCE)
+    {
+      *state ^= (1 << i);
+      edgeTime[i] = now;
+      changed |= (1 << i);
+    }
+  }
+  return changed;
+}
+
+// the scanner turns the debounced keys into timed events - the enter and back keys double as shift keys
+#define LONGPRESS_TIME 500 // ms before a held button sends a long press
+#define REPEAT_TIME 100    // ms between repeats once a button is long pressed
+#define BUTTON_PRESS 0
+#define BUTTON_RELEASE 1
+#define BUTTON_LONGPRESS 2
+#define BUTTON_REPEAT 3
+#define BUTTON_CHORD 4 // pressed while the enter or back key is held
+#define SHIFT_BACK 13
+#define SHIFT_ENTER 14
+#define NO_SHIFT 255
+
+typedef struct
+{
+  uint16_t longPressed;         // bit n set once key n has sent its long press
+  uint16_t shifting;            // keys held as the shift of a chord - they send no long press or repeat until let go
+  uint8_t chordKey;             // the key pressed second to make the chord, NO_SHIFT once it's up - only its repeats step a value
+  unsigned long repeatTime[16]; // when the next long press/repeat is due
+} buttonTimers;
+
+typedef bool (*buttonSink)(uint8_t type, uint8_t key, uint8_t held, unsigned long time);
+
+inline uint8_t heldShiftKey(uint8_t index, uint16_t state) // the shift key held down with this one, or NO_SHIFT
+{
+  if (index != SHIFT_BACK && (state & (1 << SHIFT_BACK)))
+    return SHIFT_BACK;
+  if (index != SHIFT_ENTER && (state & (1 << SHIFT_ENTER)))
+    return SHIFT_ENTER;
+  return NO_SHIFT;
+}
+
+inline void buttonEvents(uint16_t state, uint16_t changed, unsigned long now, const unsigned long *edgeTime, buttonTimers *t, uint8_t keys, buttonSink push)
+{
+  for (uint8_t i = 0; i < keys; i++)
+  {
+    uint16_t bit = 1 << i;
+    uint8_t held = heldShiftKey(i, state);
+    if (changed & bit)
+    {
+      if (state & bit)
+      {
+        push((held == NO_SHIFT) ? BUTTON_PRESS : BUTTON_CHORD, i, held, edgeTime[i]);
+        t->repeatTime[i] = edgeTime[i] + LONGPRESS_TIME;
+        t->longPressed &= ~bit;
+        if (held != NO_SHIFT)
+        {
+          t->chordKey = i;
+          t->shifting |= 1 << held; // both shift keys held would otherwise both repeat, one stepping up and one down
+        }
+      }
+      else
+      {
+        push(BUTTON_RELEASE, i, held, edgeTime[i]);
+        t->shifting &= ~bit;
+        if (t->chordKey == i)
+          t->chordKey = NO_SHIFT;
+      }
+    }
+    else if ((state & bit) && !(t->shifting & bit) && (long)(now - t->repeatTime[i]) >= 0) // held long enough for a long press or the next repeat
+    {
+      if (!(t->longPressed & bit))
+      {
+        t->longPressed |= bit;
+        push(BUTTON_LONGPRESS, i, held, now);
+      }
+      else
+        push(BUTTON_REPEAT, i, held, now);
+      t->repeatTime[i] += REPEAT_TIME;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef TB2_Flash_h
+#define TB2_Flash_h
+
+#include <inttypes.h>
+#include <string.h>
+#include <TB2_Patch.h> // crc32Update
+
+// the flash store's layout and records, kept clear of the flash controller so the host tests can run them over a page array
+// each slot keeps a few copies written in turn, so its pages wear evenly. A copy's header page is erased first and written
+// last, so a save cut short never leaves a header over data it doesn't describe, and the last whole copy stays the newest
+#define FLASH_PAGE 256
+#define FLASH_ERASED 0xFFFFFFFF // erased flash reads all ones - never used as a sequence number
+typedef struct
+{
+  uint8_t slots;
+  uint8_t copies;
+  uint16_t pages; // of data in each copy, a header page is added
+} flashArea;
+typedef struct
+{
+  uint32_t sequence; // the newest copy of a slot wins, it counts on past FLASH_ERASED
+  uint32_t length;
+  uint32_t crc;      // CRC-32 of the data pages
+  uint32_t reserved;
+} flashRecord;
+typedef struct
+{
+  uint8_t *start;    // where the store is mapped - FLASH_STORE_START on the Due, a page array in the tests
+  uint32_t size;     // the areas are packed down from start + size
+  const flashArea *areas;
+  uint8_t areaCount;
+  uint32_t *page;    // FLASH_PAGE bytes, staged for writePage
+  bool (*writePage)(uint8_t *address, const uint32_t *page); // erase and write one page, false if the controller refused
+} flashStore;
+typedef struct
+{
+  const flashStore *store;
+  uint8_t *record; // the copy's header page, written last
+  uint8_t *next;   // the next data page
+  uint8_t *end;
+  uint32_t sequence;
+  uint32_t length;
+  uint32_t crc;
+  uint16_t used;   // bytes of the store's page filled
+  bool ok;
+} flashWriter;
+
+constexpr uint32_t flashStoreBytes(const flashArea *areas, uint8_t count, uint8_t area) // this area and the ones after it
+{
+  return (area == count) ? 0 : (uint32_t)areas[area].slots * areas[area].copies * (areas[area].pages + 1) * FLASH_PAGE + flashStoreBytes(areas, count, area + 1);
+}
+
+inline uint8_t *flashCopy(const flashStore *store, uint8_t area, uint8_t slot, uint8_t copy) // a copy's header page
+{
+  uint8_t *address = store->start + store->size - flashStoreBytes(store->areas, store->areaCount, area);
+  return address + ((uint32_t)slot * store->areas[area].copies + copy) * (store->areas[area].pages + 1) * FLASH_PAGE;
+}
+
+inline bool flashNewer(uint32_t sequence, uint32_t than) // the sequence numbers wrap, copies are only ever a few apart
+{
+  return (int32_t)(sequence - than) > 0;
+}
+
+inline const flashRecord *findFlashRecord(const flashStore *store, uint8_t area, uint8_t slot) // the newest copy that checks out, NULL if there's none
+{
+  const flashRecord *newest = NULL;
+  for (uint8_t copy = 0; copy < store->areas[area].copies; copy++)
+  {
+    const flashRecord *record = (const flashRecord *)flashCopy(store, area, slot, copy);
+    if (record->sequence == FLASH_ERASED || record->length > (uint32_t)store->areas[area].pages * FLASH_PAGE)
+      continue;
+    if (newest != NULL && !flashNewer(record->sequence, newest->sequence))
+      continue;
+    if ((crc32Update(0xFFFFFFFF, (const uint8_t *)record + FLASH_PAGE, record->length) ^ 0xFFFFFFFF) == record->crc)
+      newest = record;
+  }
+  return newest;
+}
+
+inline bool beginFlashRecord(const flashStore *store, flashWriter *flash, uint8_t area, uint8_t slot) // over the copy after the newest
+{
+  const flashRecord *newest = findFlashRecord(store, area, slot);
+  uint32_t copyBytes = (uint32_t)(store->areas[area].pages + 1) * FLASH_PAGE;
+  uint8_t copy = 0;
+  flash->sequence = 1;
+  if (newest != NULL)
+  {
+    copy = (((const uint8_t *)newest - flashCopy(store, area, slot, 0)) / copyBytes + 1) % store->areas[area].copies;
+    flash->sequence = newest->sequence + 1;
+    if (flash->sequence == FLASH_ERASED)
+      flash->sequence = 0;
+  }
+  flash->store = store;
+  flash->record = flashCopy(store, area, slot, copy);
+  flash->next = flash->record + FLASH_PAGE;
+  flash->end = flash->record + copyBytes;
+  flash->length = 0;
+  flash->crc = 0xFFFFFFFF;
+  flash->used = 0;
+  // the old header goes before its data does, so nothing reads it over pages that are half the new copy
+  memset(store->page, 0xFF, FLASH_PAGE);
+  flash->ok = store->writePage(flash->record, store->page);
+  return flash->ok;
+}
+
+inline void appendFlashBytes(flashWriter *flash, const void *data, uint16_t count)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  flash->crc = crc32Update(flash->crc, bytes, count);
+  flash->length += count;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    ((uint8_t *)flash->store->page)[flash->used++] = bytes[i];
+    if (flash->used == FLASH_PAGE)
+    {
+      flash->ok = flash->ok && flash->next < flash->end && flash->store->writePage(flash->next, flash->store->page);
+      flash->next += FLASH_PAGE;
+      flash->used = 0;
+    }
+  }
+}
+
+inline bool endFlashRecord(flashWriter *flash) // the header page goes last
+{
+  uint32_t *page = flash->store->page;
+  if (flash->used > 0)
+  {
+    memset((uint8_t *)page + flash->used, 0xFF, FLASH_PAGE - flash->used);
+    flash->ok = flash->ok && flash->next < flash->end && flash->store->writePage(flash->next, page);
+  }
+  if (!flash->ok)
+    return false;
+  memset(page, 0xFF, FLASH_PAGE);
+  flashRecord *record = (flashRecord *)page;
+  record->sequence = flash->sequence;
+  record->length = flash->length;
+  record->crc = flash->crc ^ 0xFFFFFFFF;
+  record->reserved = 0;
+  return flash->store->writePage(flash->record, page);
+}
+
+inline bool writeFlashRecord(const flashStore *store, uint8_t area, uint8_t slot, const void *data, uint16_t count)
+{
+  flashWriter flash;
+  if (count > (uint32_t)store->areas[area].pages * FLASH_PAGE || !beginFlashRecord(store, &flash, area, slot))
+    return false;
+  appendFlashBytes(&flash, data, count);
+  return endFlashRecord(&flash);
+}
+
+inline bool readFlashRecord(const flashStore *store, uint8_t area, uint8_t slot, void *data, uint16_t count) // false if there's no good copy
+{
+  const flashRecord *record = findFlashRecord(store, area, slot);
+  if (record == NULL || record->length < count)
+    return false;
+  memcpy(data, (const uint8_t *)record + FLASH_PAGE, count);
+  return true;
+}
+
+#endif
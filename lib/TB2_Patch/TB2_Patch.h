@@ -0,0 +1,242 @@
+#ifndef TB2_Patch_h
+#define TB2_Patch_h
+
+#include <inttypes.h>
+#include <string.h>
+#include <TB2_Wave.h> // WAVE_SAMPLES
+
+// the tagged record format of patches and sequence banks, kept clear of the card and flash so the host tests can feed it fixtures
+// *** PATCH FORMAT ***
+// .TB2 files since format 2: a header, then tagged records - unknown tags are skipped, so later formats stay readable
+// files from before the header are 1900 4 byte ints (7600 bytes) and are still read
+#define PATCH_FORMAT 2        // the file layout, not to be confused with PATCH_VERSION in slot 45
+#define PATCH_LEGACY_SIZE 7600
+#define PATCH_LEGACY_WAVES 100 // the int a legacy file's first user wave starts at
+#define PATCH_PARAMS 57       // patch slots 0 - 56, the rest up to 100 is padding
+#define PATCH_TAG_PARAMS 1    // slot byte + 4 byte value, repeated
+#define PATCH_TAG_WAVE 2      // wave byte, encoding byte, 600 samples
+#define PATCH_WAVE_RAW 0      // 16 bit samples
+#define PATCH_WAVE_DELTA 1    // the first sample as 16 bits, then 8 bit deltas - an escape of -128 is followed by a 16 bit sample
+#define PATCH_CHUNK 64        // bytes read or written at a time
+typedef struct
+{
+  char magic[4]; // "TB2P"
+  uint16_t format;
+  uint16_t reserved;
+  uint32_t length; // of everything after the header
+  uint32_t crc;    // CRC-32 of everything after the header
+} patchHeader;
+
+inline uint32_t crc32Update(uint32_t crc, const uint8_t *data, uint32_t count) // start from 0xFFFFFFFF and invert the result
+{
+  // a nibble at a time, a 1K table isn't worth it for a few K of patch
+  static const uint32_t nibbleCrc[16] = {
+      0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+      0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C};
+  for (uint32_t i = 0; i < count; i++)
+  {
+    crc = nibbleCrc[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+    crc = nibbleCrc[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return crc;
+}
+
+// the readers take any struct with the fields they use, and a fetchPatchBytes(reader, data, count) that returns the bytes
+// read or -1 - the firmware's reads the card or flash, the tests' reads memory. The writers likewise call putPatchBytes()
+template <class reader>
+uint8_t readPatchByte(reader *r) // sets failed at the end of the records
+{
+  if (r->used == r->filled)
+  {
+    int count = (r->remaining > 0) ? fetchPatchBytes(r, r->chunk, (r->remaining < PATCH_CHUNK) ? r->remaining : PATCH_CHUNK) : 0;
+    if (count <= 0)
+    {
+      r->failed = true;
+      return 0;
+    }
+    r->crc = crc32Update(r->crc, r->chunk, count);
+    r->remaining -= count;
+    r->used = 0;
+    r->filled = count;
+  }
+  r->position++;
+  return r->chunk[r->used++];
+}
+
+template <class reader>
+bool readPatchHeader(reader *r, const char *magic, uint32_t available) // false for a legacy file or the wrong magic - available counts the header
+{
+  patchHeader header;
+  r->crc = 0xFFFFFFFF;
+  r->position = 0;
+  r->failed = false;
+  r->used = 0;
+  r->filled = 0;
+  r->legacy = false;
+  if (fetchPatchBytes(r, (uint8_t *)&header, sizeof(header)) != sizeof(header) || memcmp(header.magic, magic, 4) != 0)
+    return false;
+  // later formats only add records, which are skipped
+  r->remaining = header.length;
+  r->expectedCrc = header.crc;
+  return (header.length <= available - sizeof(header));
+}
+
+template <class reader>
+bool verifyPatchRecords(reader *r) // read to the end for the CRC, the caller rewinds
+{
+  while (r->remaining > 0 && !r->failed)
+  {
+    r->used = r->filled; // a chunk at a time, the CRC is taken as it's read
+    readPatchByte(r);
+  }
+  return (!r->failed && (r->crc ^ 0xFFFFFFFF) == r->expectedCrc);
+}
+
+template <class reader>
+void patchValue(reader *r, int index, int value) // index is the int's position in a legacy patch file
+{
+  if (index < PATCH_PARAMS)
+    r->param[index] = value;
+  else if (index >= PATCH_LEGACY_WAVES && index < PATCH_LEGACY_WAVES + 3 * WAVE_SAMPLES)
+    r->wave[(index - PATCH_LEGACY_WAVES) / WAVE_SAMPLES][(index - PATCH_LEGACY_WAVES) % WAVE_SAMPLES] = value;
+}
+
+template <class reader>
+int readPatchStep(reader *r) // a record, or 512 bytes of a legacy file - 1 while there is more, 0 when done, -1 on an error
+{
+  if (r->legacy)
+  {
+    for (uint8_t n = 0; n < 512 / PATCH_CHUNK; n++)
+    {
+      int count = fetchPatchBytes(r, r->chunk, PATCH_CHUNK) / 4;
+      if (count <= 0)
+        return -1;
+      for (int i = 0; i < count; i++)
+      {
+        int32_t value;
+        memcpy(&value, r->chunk + (i * 4), 4);
+        patchValue(r, r->offset + i, value);
+      }
+      r->offset += count;
+      if (r->offset >= PATCH_LEGACY_SIZE / 4)
+        return 0;
+    }
+    return 1;
+  }
+
+  if (r->remaining == 0 && r->used == r->filled)
+    return ((r->crc ^ 0xFFFFFFFF) == r->expectedCrc) ? 0 : -1;
+  uint8_t tag = readPatchByte(r);
+  uint16_t length = readPatchByte(r);
+  length |= readPatchByte(r) << 8;
+  uint32_t end = r->position + length;
+  switch (tag)
+  {
+  case PATCH_TAG_PARAMS:
+    while (r->position + 5 <= end && !r->failed)
+    {
+      uint8_t index = readPatchByte(r);
+      uint32_t value = 0;
+      for (uint8_t b = 0; b < 4; b++)
+        value |= (uint32_t)readPatchByte(r) << (b * 8);
+      if (index < PATCH_PARAMS)
+        patchValue(r, index, value);
+    }
+    break;
+
+  case PATCH_TAG_WAVE:
+  {
+    uint8_t wave = readPatchByte(r);
+    uint8_t encoding = readPatchByte(r);
+    if (wave >= 3 || encoding > PATCH_WAVE_DELTA)
+      break;
+    uint16_t sample = 0;
+    for (uint16_t i = 0; i < WAVE_SAMPLES && r->position < end && !r->failed; i++)
+    {
+      int8_t delta = -128;
+      if (encoding == PATCH_WAVE_DELTA && i > 0)
+        delta = readPatchByte(r);
+      if (delta != -128)
+        sample += delta;
+      else
+      {
+        sample = readPatchByte(r);
+        sample |= readPatchByte(r) << 8;
+      }
+      r->wave[wave][i] = sample;
+    }
+    break;
+  }
+  }
+  while (r->position < end && !r->failed) // the rest of the record, or all of an unknown one
+    readPatchByte(r);
+  return r->failed ? -1 : 1;
+}
+
+template <class writer>
+void flushPatchWriter(writer *w)
+{
+  if (w->used == 0)
+    return;
+  w->crc = crc32Update(w->crc, w->chunk, w->used);
+  w->length += w->used;
+  if (!putPatchBytes(w, w->chunk, w->used))
+    w->ok = false;
+  w->used = 0;
+}
+
+template <class writer>
+void writePatchBytes(writer *w, const void *data, uint16_t count)
+{
+  const uint8_t *bytes = (const uint8_t *)data;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    w->chunk[w->used++] = bytes[i];
+    if (w->used == PATCH_CHUNK)
+      flushPatchWriter(w);
+  }
+}
+
+template <class writer>
+void fillPatchHeader(writer *w, patchHeader *header, const char *magic, uint16_t format) // once the records are written
+{
+  flushPatchWriter(w);
+  memcpy(header->magic, magic, 4);
+  header->format = format;
+  header->reserved = 0;
+  header->length = w->length;
+  header->crc = w->crc ^ 0xFFFFFFFF;
+}
+
+template <class writer>
+uint16_t packWave(writer *w, const uint16_t *wave) // returns the packed length, a NULL writer only measures
+{
+  uint16_t length = 0;
+  int8_t escape = -128;
+  for (uint16_t i = 0; i < WAVE_SAMPLES; i++)
+  {
+    int delta = (i > 0) ? wave[i] - wave[i - 1] : 0;
+    if (i > 0 && delta > -128 && delta < 128)
+    {
+      int8_t small = delta;
+      if (w != NULL)
+        writePatchBytes(w, &small, 1);
+      length += 1;
+    }
+    else
+    {
+      if (i > 0)
+      {
+        if (w != NULL)
+          writePatchBytes(w, &escape, 1);
+        length += 1;
+      }
+      if (w != NULL)
+        writePatchBytes(w, &wave[i], 2);
+      length += 2;
+    }
+  }
+  return length;
+}
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef TB2_Tuning_h
+#define TB2_Tuning_h
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// the pitch tables and Scala tunings, kept clear of the hardware so the host tests can check them
+
+// Phase Increment for 1 Hz =(SAMPLES_PER_CYCLE_FIXEDPOINT/SAMPLE_RATE) = 1Hz
+// Phase Increment for frequency F = (SAMPLES_PER_CYCLE/SAMPLE_RATE)*F
+#define SAMPLE_RATE 44100.0
+#define SAMPLES_PER_CYCLE 600
+#define SAMPLES_PER_CYCLE_FIXEDPOINT (SAMPLES_PER_CYCLE << 20)
+#define TICKS_PER_CYCLE (float)((float)SAMPLES_PER_CYCLE_FIXEDPOINT / (float)SAMPLE_RATE)
+#define INCREMENT_CEILING 178954880 // about note 127 in 12-TET, the oscillators take nothing higher
+
+// C++11 constexpr functions are a single return, so the maths is recursive
+constexpr double constExpTerms(double x, double term, int n, double sum) // Taylor series, to x^20
+{
+  return (n > 20) ? sum : constExpTerms(x, term * x / n, n + 1, sum + term);
+}
+
+constexpr double constPow2(double x) // whole octaves by doubling, the fraction by the series
+{
+  return (x < 0) ? 1 / constPow2(-x) : (x >= 1) ? 2 * constPow2(x - 1) : constExpTerms(x * 0.69314718055994531, 1, 1, 0);
+}
+
+template <int... I>
+struct tableIndices
+{
+};
+template <int N, int... I>
+struct makeTableIndices : makeTableIndices<N - 1, N - 1, I...>
+{
+};
+template <int... I>
+struct makeTableIndices<0, I...>
+{
+  typedef tableIndices<I...> type;
+};
+
+#define MIDI_NOTES 128
+
+// pitch is fixed point with 256 units per semitone - all pitch modulation sums in these units and
+// pitchIncrement() converts the result once per oscillator
+#define PITCH_SEMITONE 256
+#define PITCH_FINE 16
+
+template <typename indices>
+struct constPitchTables;
+template <int... I>
+struct constPitchTables<tableIndices<I...>>
+{
+  static constexpr uint32_t equalTemperament[sizeof...(I)] = {(uint32_t)(constPow2((I - 69.0) / 12.0) * 440.0 * SAMPLES_PER_CYCLE_FIXEDPOINT / SAMPLE_RATE)...}; // 12-TET, A4 = 440Hz
+};
+template <int... I>
+constexpr uint32_t constPitchTables<tableIndices<I...>>::equalTemperament[sizeof...(I)];
+
+template <typename indices>
+struct constFineTables;
+template <int... I>
+struct constFineTables<tableIndices<I...>>
+{
+  static constexpr uint32_t high[sizeof...(I)] = {(uint32_t)(65536.0 * constPow2(I / 192.0))...}; // Q16 2^(i / 12 / 16), the top 4 bits of the fraction
+  static constexpr uint32_t low[sizeof...(I)] = {(uint32_t)(65536.0 * constPow2(I / 3072.0))...}; // Q16 2^(i / 12 / 256), the bottom 4 bits
+};
+template <int... I>
+constexpr uint32_t constFineTables<tableIndices<I...>>::high[sizeof...(I)];
+template <int... I>
+constexpr uint32_t constFineTables<tableIndices<I...>>::low[sizeof...(I)];
+
+const uint32_t (&equalTemperament)[MIDI_NOTES] = constPitchTables<makeTableIndices<MIDI_NOTES>::type>::equalTemperament;
+const uint32_t (&pitchFineHigh)[PITCH_FINE] = constFineTables<makeTableIndices<PITCH_FINE>::type>::high;
+const uint32_t (&pitchFineLow)[PITCH_FINE] = constFineTables<makeTableIndices<PITCH_FINE>::type>::low;
+
+inline uint32_t pitchIncrement(const uint32_t *noteIncrements, int32_t pitch) // the semitone comes from the (possibly microtuned) note table, the fraction from the fine tables
+{
+  if (pitch < 0)
+    pitch = 0;
+  else if (pitch > (MIDI_NOTES << 8) - 1)
+    pitch = (MIDI_NOTES << 8) - 1;
+  uint64_t increment = noteIncrements[pitch >> 8];
+  increment = (increment * pitchFineHigh[(pitch >> 4) & 15]) >> 16;
+  increment = (increment * pitchFineLow[pitch & 15]) >> 16;
+  return (increment < INCREMENT_CEILING) ? increment : INCREMENT_CEILING;
+}
+
+// *** SCALA ***
+// a .scl scale and its optional .kbm keyboard map
+#define TUNING_DEGREES 64 // the most scale degrees we hold
+
+typedef struct
+{
+  float cents[TUNING_DEGREES + 1]; // degree 0 is 0 cents, the last degree is the period
+  uint8_t degrees;
+  int8_t map[128];      // keyboard map from the .kbm, -1 = unmapped key
+  uint8_t mapSize;      // 0 = linear mapping
+  uint8_t firstNote;    // keys outside first - last are unmapped
+  uint8_t lastNote;
+  uint8_t middleNote;   // the key that plays degree 0
+  uint8_t refNote;      // the key tuned to refFreq
+  float refFreq;
+  uint8_t octaveDegree; // the degree the keyboard map repeats at
+  float refCents;       // the cents of the reference key relative to the middle note, see tuneReference()
+} scaleTuning;
+
+inline void resetKeyboardMap(scaleTuning *t) // without a map degree 0 is on middle C and A4 is 440Hz
+{
+  t->mapSize = 0;
+  t->firstNote = 0;
+  t->lastNote = 127;
+  t->middleNote = 60;
+  t->refNote = 69;
+  t->refFreq = 440.0;
+  t->octaveDegree = t->degrees;
+}
+
+inline void resetScale(scaleTuning *t) // 12-TET, A4 = 440Hz
+{
+  t->degrees = 12;
+  for (uint8_t i = 0; i <= 12; i++)
+    t->cents[i] = i * 100.0;
+  resetKeyboardMap(t);
+}
+
+// the parsers read through anything with SdFat's fgets(), so the tests can feed them from memory
+template <class source>
+bool readTuningLine(source &file, char *line, uint8_t size) // the next line that isn't a comment, false at the end of the file
+{
+  while (file.fgets(line, size) > 0)
+  {
+    if (line[0] != '!')
+    {
+      uint8_t length = strlen(line);
+      while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r'))
+        line[--length] = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+template <class source>
+bool parseScale(source &file, scaleTuning *t) // .scl: a description, the number of degrees, then one pitch per line in cents or as a ratio
+{
+  char line[64];
+  if (!readTuningLine(file, line, sizeof(line))) // description
+    return false;
+  if (!readTuningLine(file, line, sizeof(line)))
+    return false;
+  int degrees = atoi(line);
+  if (degrees < 1 || degrees > TUNING_DEGREES)
+    return false;
+
+  t->cents[0] = 0;
+  for (uint8_t i = 1; i <= degrees; i++)
+  {
+    if (!readTuningLine(file, line, sizeof(line)))
+      return false;
+    char *pitch = line;
+    while (*pitch == ' ' || *pitch == '\t')
+      pitch++;
+    if (strchr(pitch, '.') != NULL) // cents
+      t->cents[i] = atof(pitch);
+    else // a ratio, or a whole number
+    {
+      long numerator = atol(pitch);
+      char *slash = strchr(pitch, '/');
+      long denominator = (slash != NULL) ? atol(slash + 1) : 1;
+      if (numerator <= 0 || denominator <= 0)
+        return false;
+      t->cents[i] = 1200.0 * log((float)numerator / denominator) / log(2.0);
+    }
+  }
+  t->degrees = degrees;
+  return true;
+}
+
+inline int tuningConstrain(int value, int low, int high)
+{
+  return (value < low) ? low : (value > high) ? high : value;
+}
+
+template <class source>
+bool parseKeyboardMap(source &file, scaleTuning *t) // .kbm: size, first, last, middle, reference note, reference frequency, octave degree, then the map
+{
+  char line[64];
+  int values[7];
+  for (uint8_t i = 0; i < 7; i++)
+  {
+    if (!readTuningLine(file, line, sizeof(line)))
+      return false;
+    values[i] = atoi(line);
+    if (i == 5)
+      t->refFreq = atof(line);
+  }
+  if (values[0] < 0 || values[0] > 128)
+    return false;
+  t->mapSize = values[0];
+  t->firstNote = tuningConstrain(values[1], 0, 127);
+  t->lastNote = tuningConstrain(values[2], 0, 127);
+  t->middleNote = tuningConstrain(values[3], 0, 127);
+  t->refNote = tuningConstrain(values[4], 0, 127);
+  // an octave degree of 0 would repeat the map at the same pitch, take the scale's own period instead
+  t->octaveDegree = (values[6] >= 1 && values[6] <= TUNING_DEGREES) ? values[6] : t->degrees;
+  if (t->refFreq <= 0)
+    t->refFreq = 440.0;
+
+  for (uint8_t i = 0; i < t->mapSize; i++)
+  {
+    if (!readTuningLine(file, line, sizeof(line)))
+      t->map[i] = -1; // a short map leaves the rest unmapped
+    else
+      t->map[i] = (line[0] == 'x' || line[0] == 'X') ? -1 : tuningConstrain(atoi(line), 0, 127);
+  }
+  return true;
+}
+
+inline float degreeCents(const scaleTuning *t, int degree) // degrees past the period wrap into the next period
+{
+  return (degree / t->degrees) * t->cents[t->degrees] + t->cents[degree % t->degrees];
+}
+
+inline bool noteCents(const scaleTuning *t, int note, float *cents) // cents of a key relative to the middle note, false if the key is unmapped
+{
+  if (note < t->firstNote || note > t->lastNote)
+    return false;
+  int steps = note - t->middleNote;
+  if (t->mapSize == 0) // linear - every key is the next degree
+  {
+    int period = (steps >= 0) ? steps / t->degrees : -((t->degrees - 1 - steps) / t->degrees);
+    *cents = period * t->cents[t->degrees] + t->cents[steps - period * t->degrees];
+  }
+  else
+  {
+    int period = (steps >= 0) ? steps / t->mapSize : -((t->mapSize - 1 - steps) / t->mapSize);
+    int degree = t->map[steps - period * t->mapSize];
+    if (degree < 0)
+      return false;
+    *cents = period * degreeCents(t, t->octaveDegree) + degreeCents(t, degree);
+  }
+  return true;
+}
+
+inline void tuneReference(scaleTuning *t) // once per new tuning, before any tuningIncrement()
+{
+  if (!noteCents(t, t->refNote, &t->refCents))
+    t->refCents = 0; // an unmapped reference key - tune the middle note to the reference frequency instead
+}
+
+inline uint32_t tuningIncrement(const scaleTuning *t, int note) // the phase increment of a key, 0 for unmapped keys so they are silent
+{
+  float cents;
+  if (!noteCents(t, note, &cents))
+    return 0;
+  float increment = t->refFreq * pow(2.0, (cents - t->refCents) / 1200.0) * TICKS_PER_CYCLE;
+  return (increment < INCREMENT_CEILING) ? (uint32_t)increment : INCREMENT_CEILING;
+}
+
+#endif
@@ -0,0 +1,258 @@
+#ifndef TB2_Wave_h
+#define TB2_Wave_h
+
+#include <inttypes.h>
+#include <string.h>
+#include <TB2_Tuning.h> // the index packs
+
+// WAV files read into the oscillators' tables, kept clear of the hardware so the host tests can feed them fixtures
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#define WAVE_SAMPLES 600 // every oscillator table, and the length of an AKWF cycle
+
+// C++11 constexpr functions are a single return, so the maths is recursive
+constexpr double constSinTerms(double x, double term, int n, double sum) // Taylor series, to x^31
+{
+  return (n > 31) ? sum : constSinTerms(x, -term * x * x / ((n + 1) * (n + 2)), n + 2, sum + term);
+}
+
+constexpr double constSin(double x) // 0 <= x < 2 PI
+{
+  return (x > PI) ? constSinTerms(x - 2 * PI, x - 2 * PI, 1, 0) : constSinTerms(x, x, 1, 0);
+}
+
+// *** WAVE FILES ***
+// any RIFF WAVE - 8 to 32 bit PCM or 32/64 bit float, plain or EXTENSIBLE, up to 8 channels, holding one cycle of any length
+#define WAVE_PCM 1
+#define WAVE_FLOAT 3
+#define WAVE_EXTENSIBLE 0xFFFE // the real encoding is the start of the sub-format GUID
+#define WAVE_CHANNELS 8
+
+typedef struct
+{
+  uint16_t encoding; // WAVE_PCM or WAVE_FLOAT
+  uint16_t channels;
+  uint16_t bytesPerSample;
+  uint32_t dataStart; // file position of the first frame
+  uint32_t frames;
+} waveFormat;
+
+inline uint32_t waveLittleEndian(const uint8_t *bytes, uint8_t count)
+{
+  uint32_t value = 0;
+  while (count-- > 0)
+    value = (value << 8) | bytes[count];
+  return value;
+}
+
+// the readers go through anything with SdFat's read(), seekSet(), curPosition() and fileSize()
+template <class source>
+bool readWaveFormat(source *file, waveFormat *format) // walk the RIFF chunks to "fmt " and "data", in either order, skipping any others
+{
+  uint8_t chunk[26];
+  if (!file->seekSet(0) || file->read(chunk, 12) != 12 || memcmp(chunk, "RIFF", 4) != 0 || memcmp(chunk + 8, "WAVE", 4) != 0)
+    return false;
+  format->channels = 0;
+  uint32_t dataSize = 0;
+  format->dataStart = 0;
+  while (file->read(chunk, 8) == 8)
+  {
+    uint32_t size = waveLittleEndian(chunk + 4, 4);
+    uint32_t next = file->curPosition() + size + (size & 1); // chunks are padded to an even length
+    if (memcmp(chunk, "fmt ", 4) == 0)
+    {
+      if (size < 16 || file->read(chunk, (size < 26) ? 16 : 26) != ((size < 26) ? 16 : 26))
+        return false;
+      format->encoding = waveLittleEndian(chunk, 2);
+      if (format->encoding == WAVE_EXTENSIBLE)
+        format->encoding = (size < 26) ? 0 : waveLittleEndian(chunk + 24, 2);
+      format->channels = waveLittleEndian(chunk + 2, 2);
+      if (format->channels < 1 || format->channels > WAVE_CHANNELS)
+        return false;
+      format->bytesPerSample = waveLittleEndian(chunk + 12, 2) / format->channels; // block align, so 20 bit in 3 bytes works too
+      if (format->encoding == WAVE_PCM ? (format->bytesPerSample < 1 || format->bytesPerSample > 4)
+                                       : (format->encoding != WAVE_FLOAT || (format->bytesPerSample != 4 && format->bytesPerSample != 8)))
+        return false;
+    }
+    else if (memcmp(chunk, "data", 4) == 0)
+    {
+      format->dataStart = file->curPosition();
+      dataSize = size;
+    }
+    if (format->channels != 0 && format->dataStart != 0)
+    {
+      uint32_t available = file->fileSize() - format->dataStart; // a file cut short keeps the frames it has
+      format->frames = ((dataSize < available) ? dataSize : available) / (format->channels * format->bytesPerSample);
+      return (format->frames > 0);
+    }
+    if (!file->seekSet(next))
+      return false;
+  }
+  return false;
+}
+
+inline int16_t waveFloatSample(double value)
+{
+  if (value >= 1)
+    return 32767;
+  if (value <= -1)
+    return -32767;
+  return (value == value) ? (int16_t)(value * 32767) : 0; // NaN is silence
+}
+
+inline int16_t waveFrameSample(const uint8_t *frame, const waveFormat *format) // mixed down to mono, 16 bit
+{
+  int32_t sum = 0;
+  for (uint8_t c = 0; c < format->channels; c++)
+  {
+    const uint8_t *sample = frame + c * format->bytesPerSample;
+    if (format->encoding == WAVE_FLOAT && format->bytesPerSample == 4)
+    {
+      float value;
+      memcpy(&value, sample, 4);
+      sum += waveFloatSample(value);
+    }
+    else if (format->encoding == WAVE_FLOAT)
+    {
+      double value;
+      memcpy(&value, sample, 8);
+      sum += waveFloatSample(value);
+    }
+    else if (format->bytesPerSample == 1)
+      sum += (sample[0] - 128) << 8; // 8 bit is unsigned
+    else
+      sum += (int16_t)waveLittleEndian(sample + format->bytesPerSample - 2, 2); // the top 16 bits
+  }
+  return sum / format->channels;
+}
+
+// the cycle is resampled to WAVE_SAMPLES with a windowed sinc, stretched over the input when there are more frames than samples
+#define RESAMPLE_TAPS 8    // the kernel spans 8 samples at the lower of the two rates
+#define RESAMPLE_PHASES 64 // kernel values per sample, interpolated between
+#define RESAMPLE_RATIO 8   // longer cycles are box averaged down to at most 8 frames a table sample first
+#define RESAMPLE_WINDOW 128 // int16 frames, a power of 2 - holds the kernel's reach either side at RESAMPLE_RATIO
+#define RESAMPLE_READ 256  // bytes of the file read at a time
+#define WAVE_SCRATCH (RESAMPLE_WINDOW * 2 + RESAMPLE_READ) // what resampleWave() needs, the firmware lends it sdScratch
+
+constexpr double constWrapSin(double x) // any x >= 0
+{
+  return (x >= 2 * PI) ? constWrapSin(x - 2 * PI) : constSin(x);
+}
+
+constexpr double constKernel(double x) // Hann windowed sinc, 0 <= x <= RESAMPLE_TAPS / 2
+{
+  return (x == 0) ? 1 : constWrapSin(PI * x) / (PI * x) * (0.5 + 0.5 * constSin(PI * x / (RESAMPLE_TAPS / 2) + PI / 2));
+}
+
+template <typename indices>
+struct constResampleTables;
+template <int... I>
+struct constResampleTables<tableIndices<I...>>
+{
+  static constexpr int16_t kernel[sizeof...(I)] = {(int16_t)(32767.0 * constKernel((double)I / RESAMPLE_PHASES))...}; // Q15, one side - it's symmetric
+};
+template <int... I>
+constexpr int16_t constResampleTables<tableIndices<I...>>::kernel[sizeof...(I)];
+
+#define RESAMPLE_KERNEL (RESAMPLE_TAPS / 2 * RESAMPLE_PHASES + 1)
+const int16_t (&resampleKernel)[RESAMPLE_KERNEL] = constResampleTables<makeTableIndices<RESAMPLE_KERNEL>::type>::kernel;
+
+template <class source>
+struct waveFrames // the data chunk one frame at a time, through a small buffer
+{
+  source *file;
+  const waveFormat *format;
+  uint8_t *buffer;
+  uint16_t used;
+  uint16_t filled;
+  uint32_t frame; // the next one
+
+  bool seek(uint32_t to)
+  {
+    frame = to;
+    used = filled = 0;
+    return file->seekSet(format->dataStart + to * format->channels * format->bytesPerSample);
+  }
+
+  bool next(int16_t *sample)
+  {
+    uint16_t frameBytes = format->channels * format->bytesPerSample;
+    if (used == filled)
+    {
+      uint32_t left = (format->frames - frame) * frameBytes;
+      filled = (left < (uint32_t)(RESAMPLE_READ - RESAMPLE_READ % frameBytes)) ? left : RESAMPLE_READ - RESAMPLE_READ % frameBytes;
+      used = 0;
+      if (filled == 0 || file->read(buffer, filled) != (int)filled)
+        return false;
+    }
+    *sample = waveFrameSample(buffer + used, format);
+    used += frameBytes;
+    frame++;
+    return true;
+  }
+};
+
+template <class source>
+bool resampleWave(source *file, const waveFormat *format, uint16_t *table, void *scratch) // scratch is WAVE_SCRATCH bytes
+{
+  // each table sample gathers the frames the kernel reaches from it, out of a ring of the last RESAMPLE_WINDOW frames
+  // the cycle wraps, so the ring starts with the frames before the end and finishes with the ones after the start
+  int16_t *window = (int16_t *)scratch;
+  waveFrames<source> reader = {file, format, (uint8_t *)scratch + RESAMPLE_WINDOW * 2, 0, 0, 0};
+  uint32_t stride = (format->frames + WAVE_SAMPLES * RESAMPLE_RATIO - 1) / (WAVE_SAMPLES * RESAMPLE_RATIO); // frames averaged into one
+  if (stride == 0)
+    return false;
+  int32_t frames = (format->frames + stride - 1) / stride; // after averaging
+  bool decimate = (frames > WAVE_SAMPLES);
+  int32_t kernelScale = decimate ? ((uint32_t)WAVE_SAMPLES << 16) / frames : 65536; // frames to kernel samples
+  int32_t reach = decimate ? (RESAMPLE_TAPS / 2 * frames + WAVE_SAMPLES - 1) / WAVE_SAMPLES : RESAMPLE_TAPS / 2; // frames each side of a table sample
+  int32_t wanted = -reach; // the next frame into the ring, it wraps into the cycle
+  int32_t position = -1;   // where the reader is, after averaging
+
+  for (uint16_t i = 0; i < WAVE_SAMPLES; i++)
+  {
+    int32_t centre = ((int64_t)i * frames << 16) / WAVE_SAMPLES; // Q16 frames
+    int32_t first = (centre >> 16) - reach;
+    int32_t last = (centre >> 16) + reach + 1;
+    for (; wanted <= last; wanted++)
+    {
+      int32_t frame = ((wanted % frames) + frames) % frames;
+      if (frame != position && !reader.seek(frame * stride))
+        return false;
+      int32_t sum = 0;
+      uint32_t count = 0;
+      int16_t sample;
+      while (count < stride && reader.frame < format->frames)
+      {
+        if (!reader.next(&sample))
+          return false;
+        sum += sample;
+        count++;
+      }
+      window[wanted & (RESAMPLE_WINDOW - 1)] = sum / (int32_t)count;
+      position = frame + 1;
+    }
+
+    int64_t sum = 0;
+    int32_t weight = 0;
+    for (int32_t j = first; j <= last; j++)
+    {
+      int32_t distance = ((int64_t)((centre > (j << 16)) ? centre - (j << 16) : (j << 16) - centre) * kernelScale) >> 16; // Q16 kernel samples
+      uint32_t index = (uint32_t)distance * RESAMPLE_PHASES;
+      if ((index >> 16) >= RESAMPLE_KERNEL - 1)
+        continue;
+      int32_t h = resampleKernel[index >> 16];
+      h += ((resampleKernel[(index >> 16) + 1] - h) * (int32_t)(index & 0xFFFF)) >> 16;
+      sum += (int64_t)window[j & (RESAMPLE_WINDOW - 1)] * h;
+      weight += h;
+    }
+    int32_t sample = (weight > 0) ? sum / weight : 0;
+    sample = (sample >> 4) + 2048;
+    table[i] = (sample < 0) ? 0 : (sample > 4095) ? 4095 : sample;
+  }
+  return true;
+}
+
+#endif
@@ -48,13 +48,12 @@ void setup()
   showTB2(0);
 
   // *** BUTTONS ***
-  // Make input & enable pull-up resistors on switch pins
-  for (byte i = 0; i < NUMBUTTONS; i++)
-    pinMode(buttons[i], INPUT_PULLUP);
+  initButtons();
 
   assignIncrementButtons(&menuChoice, 0, 6, 1);
 
   // *** POTS ***
+  initPots();
   getPots();
   lockPot(5);
 
@@ -65,12 +64,11 @@ void setup()
   // *** SYNTH ***
   ulInput[0] = 512;
 
-  createNoteTable(SAMPLE_RATE);
-  createSineTable();
+  createNoteTable(); // the sine, saw, triangle and fine pitch tables are built by the compiler
   createSquareTable(pulseWidth);
-  createSawTable();
-  createTriangleTable();
   clearUserTables();
+  memcpy(nWavetable, nSineTable, sizeof(nWavetable)); // until a bank is loaded
+  unloadWavetable();
 
   for (byte i = 0; i < 4; i++)
     wavePointer[i] = &nTriangleTable[0];
@@ -94,7 +92,12 @@ void setup()
   // *** MIDI ***
   midiA.setHandleNoteOn(HandleNoteOn); // these callback functions are defined in MIDI
   midiA.setHandleNoteOff(HandleNoteOff);
-  //midiA.setHandleControlChange(HandleCC);
+  midiA.setHandleControlChange(HandleCC);
+  midiA.setHandlePitchBend(HandlePitchBend);
+  midiA.setHandleAfterTouchChannel(HandleAfterTouchChannel);
+  midiA.setHandleProgramChange(HandleProgramChange);
+  memset(ccMap, 0xFF, sizeof(ccMap)); // nothing is mapped (NO_CC) until the settings are loaded
+  clearSeqPool();
   midiA.setHandleClock(HandleClock);
   midiA.setHandleStart(HandleStart);
   midiA.setHandleStop(HandleStop);
@@ -112,30 +115,29 @@ void setup()
   createGainTable();
 
   // *** SD CARD ***
-  if (!sd.begin(chipSelect, SPI_FULL_SPEED))
+  sdAvailable = sd.begin(chipSelect, SPI_FULL_SPEED);
+  if (!sdAvailable)
   {
     lcd.setCursor(0, 1);
     lcd.print("*SD Unavailable*");
   }
-  else
-  {
-    loadSettings();
+  loadSettings(); // the flash store first, so a missing card still has them
+  loadFlashBank();
+  loadSnapshots();
+  if (sdAvailable)
     getFirstFile();
-  }
-
-  // clear the patch buffer
-  for (uint16_t i = 0; i < 1900; i++)
-    patchBuffer[i] = 0;
-
-  // clear the sequencer bank buffer
-  for (uint16_t i = 0; i < 1600; i++)
-    seqBankBuffer[i] = 0;
+  bootTime = millis();
 }
 
 // LOOP.ino
 void loop()
 {
   midiA.read();
+  seqControlLanes(); // send the sequencer's CC lanes - defined in SEQUENCER
+  applyPendingCC();  // apply the CC values that came in - defined in MIDI
+  rebuildTuning();   // finish building a new tuning, a few notes per pass - defined in TUNING
+  updateHandover();  // put a loaded patch in, before the envelope starts the note waiting for it - defined in SD
+  prefetchPatches(); // read the neighbours of the browsed patch while the user dwells on it - defined in SD
   checkForClock();                                                                                             // are we receiving MIDI clock?
   sendMidi();                                                                                                  // we have to take the serial messages out of the interrupt callbacks - will definitely impact MIDI timing though ;^/
   checkSwitches();                                                                                             // gets the current state of the buttons - defined in BUTTONS
@@ -147,8 +149,12 @@ void loop()
   adjustValues();                                                                                              // defined in POTS
   updateValues();                                                                                              // defined in UI - only executes if the variable valueChange is set to true
   createSquareTable(constrain((pulseWidth + velPw), ((WAVE_SAMPLES / 2) - 10) * -1, (WAVE_SAMPLES / 2) - 10)); // have to call this in the loop for modulation - can't call it at lfo frequency
+  updateWavetable();                                                                                           // blend the wavetable frames at the modulated position - defined in WAVETABLE
+  updateMorph();                                                                                               // follow the morph control - defined in MORPH
+  syncSnapshots();                                                                                             // bring the snapshots in flash up to date, a page per pass - defined in SNAPSHOT
   arrowAnim();                                                                                                 // animate the arrow
   seqBlinker();                                                                                                // blink the selected step in the sequencer
+  seqPoolWarning();                                                                                            // a step that didn't fit in the pool - defined in SEQUENCER
   updateLED();                                                                                                 // turn the LED on or off
 }
 
@@ -292,51 +298,89 @@ void sortArp()
 }
 
 // BUTTONS.ino
-void checkSwitches()
+void initButtons()
 {
-  static byte previousstate[NUMBUTTONS];
-  static byte currentstate[NUMBUTTONS];
-  static long lasttime;
-  byte index;
-
-  if (millis() < lasttime)
+  // Make input & enable pull-up resistors on switch pins
+  for (byte i = 0; i < NUMBUTTONS; i++)
   {
-    // we wrapped around, lets just try again
-    lasttime = millis();
+    pinMode(buttons[i], INPUT_PULLUP);
+    // look up which port and bit each button is on, so we don't have to go through digitalRead() every time
+    for (byte j = 0; j < 4; j++)
+    {
+      if (g_APinDescription[buttons[i]].pPort == buttonPorts[j])
+        buttonPort[i] = j;
+    }
+    buttonPin[i] = g_APinDescription[buttons[i]].ulPin;
+    buttonEdgeTime[i] = 0;
   }
+  buttonState = 0;
+}
 
-  if ((lasttime + DEBOUNCE) > millis())
+uint16_t readButtons()
+{
+  // one load per port instead of one digitalRead() per button
+  uint32_t portState[4];
+  for (byte j = 0; j < 4; j++)
+    portState[j] = buttonPorts[j]->PIO_PDSR;
+
+  uint16_t raw = 0;
+  for (byte i = 0; i < NUMBUTTONS; i++)
   {
-    // not enough time has passed to debounce
-    return;
+    if (!(portState[buttonPort[i]] & buttonPin[i])) // remember, digital HIGH means NOT pressed
+      raw |= (1 << i);
   }
-  // ok we have waited DEBOUNCE milliseconds, lets reset the timer
-  lasttime = millis();
+  return raw;
+}
 
-  for (index = 0; index < NUMBUTTONS; index++) // when we start, we clear out the "just" indicators
-  {
-    justreleased[index] = 0;
-    justpressed[index] = 0;
+uint16_t debounceButtons(uint16_t raw, unsigned long now) // returns the buttons whose debounced state changed - see TB2_Debounce
+{
+  return debounceKeys(raw, now, &buttonState, buttonEdgeTime, NUMBUTTONS);
+}
 
-    currentstate[index] = digitalRead(buttons[index]); // read the button
+void checkSwitches()
+{
+  unsigned long now = millis();
+  uint16_t changed = debounceButtons(readButtons(), now);
 
-    if (currentstate[index] == previousstate[index])
-    {
-      if ((pressed[index] == LOW) && (currentstate[index] == LOW))
-      {
-        // just pressed
-        justpressed[index] = 1;
-      }
-      else if ((pressed[index] == HIGH) && (currentstate[index] == HIGH))
-      {
-        // just released
-        justreleased[index] = 1;
-      }
-      pressed[index] = !currentstate[index]; // remember, digital HIGH means NOT pressed
-    }
+  for (byte index = 0; index < NUMBUTTONS; index++) // when we start, we clear out the "just" indicators
+  {
+    uint16_t bit = 1 << index;
+    pressed[index] = (buttonState & bit) ? 1 : 0;
+    justpressed[index] = ((changed & bit) && pressed[index]) ? 1 : 0;
+    justreleased[index] = ((changed & bit) && !pressed[index]) ? 1 : 0;
+  }
+  buttonEvents(buttonState, changed, now, buttonEdgeTime, &buttonTimer, NUMBUTTONS, pushButtonEvent); // see TB2_Debounce
+}
+
+byte heldShift(byte index)
+{
+  // the enter and back keys double as shift keys - returns the one that's held down, or 255
+  return heldShiftKey(index, buttonState);
+}
 
-    previousstate[index] = currentstate[index]; // keep a running tally of the buttons
+boolean pushButtonEvent(byte type, byte key, byte held, unsigned long time)
+{
+  byte next = (buttonEventHead + 1) % BUTTON_EVENTS;
+  if (next == buttonEventTail) // full - drop the new event rather than scramble the order of the old ones
+  {
+    buttonEventsDropped++;
+    return false;
   }
+  buttonEventQueue[buttonEventHead].type = type;
+  buttonEventQueue[buttonEventHead].key = key;
+  buttonEventQueue[buttonEventHead].held = held;
+  buttonEventQueue[buttonEventHead].time = time;
+  buttonEventHead = next;
+  return true;
+}
+
+boolean popButtonEvent(buttonEvent *event)
+{
+  if (buttonEventTail == buttonEventHead)
+    return false;
+  *event = buttonEventQueue[buttonEventTail];
+  buttonEventTail = (buttonEventTail + 1) % BUTTON_EVENTS;
+  return true;
 }
 
 void clearJust()
@@ -350,601 +394,798 @@ void clearJust()
 
 void handlePresses()
 {
-  unSplash(); // check if we're on the splash page and deal with it
-
-  if (pressed[13] && justpressed[14]) // fine adjust increment
-  {
-    if ((*adjustValue + increment) <= upperLimit)
-      *adjustValue += increment;
-    else
-      *adjustValue = lowerLimit;
-
-    incDecSpecials();
-    shiftL = true;
-    clearJust();
-  }
+  buttonEvent event;
 
-  if (pressed[14] && justpressed[13]) // fine adjust decrement
-  {
-    if ((*adjustValue - increment) >= lowerLimit)
-      *adjustValue -= increment;
-    else
-      *adjustValue = upperLimit;
-
-    incDecSpecials();
-    shiftR = true;
-    clearJust();
-  }
+  unSplash(); // check if we're on the splash page and deal with it
 
-  if (justreleased[14]) // enter key
+  while (popButtonEvent(&event))
   {
-    if (!shiftL && !shiftR)
+    switch (event.type)
     {
-      switch (menu)
+    case BUTTON_CHORD:
+    case BUTTON_REPEAT:
+      if (event.key != buttonTimer.chordKey && event.type == BUTTON_REPEAT)
+        break; // only the key that made the chord steps the value
+      if (event.key == 14 && event.held == 13) // fine adjust increment - keeps repeating while both are held
       {
-      case 0: // SPLASH/MAIN
-        switch (mainMenu)
-        {
-        case 0:                      // SYNTH
-          if (synPatchLoadSave == 0) // LOAD
-          {
-            menu = 70;
-            gotoRootDir();
-            getDirCount();
-            assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          }
-          else // SAVE
-          {
-            gotoRootDir();
-            menu = 80;
-            getDirCount();
-            assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          }
-          valueChange = true;
-          break;
-
-        case 2:                     // SEQUENCER
-          if (seqBankLoadSave == 0) // LOAD
-          {
-            gotoRootDir();
-            menu = 250;
-            getDirCount();
-            assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          }
-          else // SAVE
-          {
-            gotoRootDir();
-            menu = 260;
-            getDirCount();
-            assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          }
-          valueChange = true;
-          break;
-
-        case 3: // SETTINGS
-          if (settingsConfirm)
-          {
-            saveSettings();
-            settingsConfirm = false;
-          }
-          else
-          {
-            settingsConfirm = true;
-            updateMenu();
-            lcd.setCursor(0, 1);
-            lcd.print("    Overwrite?  ");
-          }
-          break;
-        }
-        break;
-
-      case 10: // OSC1
-        if (osc1WaveType == 4)
-        {
-          menu = 11;
-          gotoRootDir();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          valueChange = true;
-        }
-        else if (osc1WaveType == 3)
-        {
-          menu = 12;
-          lockPot(5);
-          assignIncrementButtons(&uiPulseWidth, -285, 285, 2);
-          valueChange = true;
-          clearLCD();
-        }
-        break;
-
-      case 11: // OSC1 - choose user waveshape
-        if (!inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          justEnteredFolder = true;
-        }
-        break;
-
-      case 20: // OSC2
-        if (osc2WaveType == 5)
-        {
-          menu = 21;
-          gotoRootDir();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          valueChange = true;
-        }
-        else if (osc2WaveType == 3)
-        {
-          menu = 22;
-          lockPot(5);
-          assignIncrementButtons(&uiPulseWidth, -285, 285, 2);
-          valueChange = true;
-          clearLCD();
-        }
-        break;
-
-      case 21: // OSC2 - choose user waveshape
-        if (!inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          justEnteredFolder = true;
-        }
-        break;
-
-      case 50:
-        if (lfoShape == 6)
-        {
-          menu = 51;
-          gotoRootDir();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          valueChange = true;
-        }
-        break;
-
-      case 51: // LFO - choose user waveshape
-        if (!inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          justEnteredFolder = true;
-        }
-        break;
-
-      case 70: // LOAD PATCH
-        if (!inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          justEnteredFolder = true;
-        }
-        lockPot(5);
-        break;
+        if ((*adjustValue + increment) <= upperLimit)
+          *adjustValue += increment;
+        else
+          *adjustValue = lowerLimit;
 
-      case 80: // SAVE PATCH
-        if (!inFolder)
-        {
-          setFolder();
-          justEnteredFolder = true;
-        }
-        else if (saveConfirm)
-        {
-          saveConfirm = false;
-          savePatch();
-        }
+        incDecSpecials();
+        shiftL = true;
+        clearJust();
+      }
+      else if (event.key == 13 && event.held == 14) // fine adjust decrement
+      {
+        if ((*adjustValue - increment) >= lowerLimit)
+          *adjustValue -= increment;
         else
-        {
-          if (strcmp(fileName, saveName) == 0)
-            savePatch();
-          else
-          {
-            saveConfirm = true;
-            lcd.setCursor(4, 1);
-            lcd.print("Overwrite?  ");
-          }
-        }
-        lockPot(5);
-        break;
+          *adjustValue = upperLimit;
 
-      case 200: // SEQUENCE TRIGGER
-        menu = 210;
-        valueChange = true;
-        break;
+        incDecSpecials();
+        shiftR = true;
+        clearJust();
+      }
+      else if (event.type == BUTTON_CHORD)
+        chordPress(event.key, event.held);
+      break;
 
-      case 210: // SEQUENCE EDIT
+    case BUTTON_RELEASE:
+      if (event.key == 13 || event.key == 14)
       {
-        if (!midiMode)
+        if (!shiftL && !shiftR)
         {
-          boolean keyNotes = false;
-          for (byte i = 0; i < 13; i++)
-          {
-            if (pressed[i])
-              keyNotes = true;
-          }
-          if (keyNotes)
-          {
-            updateSeqNotes();
-            seqEditStep = (seqEditStep + 1) % 16; // increment the edit step
-          }
-          else // no front pane keyboard keys are held
-          {
-            menu = 211;
-            assignIncrementButtons(&seq[currentSeq].voice[0][seqEditStep], -39, 48, 1);
-            clearLCD();
-            valueChange = true;
-          }
+          if (event.key == 14)
+            enterKey();
+          else
+            backKey();
         }
-        else // MIDI mode
+        else if (!(buttonState & ((1 << 13) | (1 << 14)))) // only let go of the shift once both keys are up
         {
-          if (updateSeqNotes())                   // will return true if there were notes held and added to sequencer
-            seqEditStep = (seqEditStep + 1) % 16; // increment the edit step
-          else
-          {
-            menu = 211;
-            assignIncrementButtons(&seq[currentSeq].voice[0][seqEditStep], -39, 48, 1);
-            clearLCD();
-            valueChange = true;
-          }
+          shiftL = false;
+          shiftR = false;
         }
+        clearJust();
       }
       break;
 
-      case 250: // LOAD SEQ BANK
-        if (!inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-          justEnteredFolder = true;
-        }
-        else if (seqBankLoaded)
-        {
-          unpackSeqBankBuffer();
-          lcd.setCursor(4, 1);
-          lcd.print("Loaded!     ");
-        }
-        lockPot(5);
-        break;
+    case BUTTON_PRESS:
+      keyPress(event.key);
+      break;
 
-      case 260: // SAVE SEQ BANK
-        if (!inFolder)
-        {
-          setFolder();
-          justEnteredFolder = true;
-        }
-        else if (saveConfirm)
-        {
-          saveConfirm = false;
-          saveBank();
-        }
-        else
+    case BUTTON_LONGPRESS:
+      if (menu == 200) // SEQ TRIGGER - hold a white key to copy the current sequence there
+      {
+        for (byte i = 0; i < 8; i++)
         {
-          if (strcmp(fileName, saveName) == 0)
-            saveBank();
-          else
-          {
-            saveConfirm = true;
-            lcd.setCursor(4, 1);
-            lcd.print("Overwrite?  ");
-          }
+          if (event.key == whiteButtons[i])
+            copySeq();
         }
-        lockPot(5);
-        break;
       }
+      break;
     }
-    else if (shiftR)
-      shiftR = false;
-    clearJust();
   }
+}
 
-  if (justreleased[13]) // back key
+void enterKey()
+{
+  switch (menu)
   {
-    if (!shiftL && !shiftR)
+  case 0: // SPLASH/MAIN
+    switch (mainMenu)
     {
-      switch (menu)
+    case 0:                      // SYNTH
+      if (!sdAvailable)          // the favourites in flash instead
       {
-      case 11: // OSC1 - choose user waveshape
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-        }
-        else
-        {
-          menu = 10;
-          assignIncrementButtons(&osc1WaveType, 0, 7, 1);
-          valueChange = true;
-          clearLCD();
-        }
-        break;
-
-      case 12: // Squ Pulse Width
-        menu = 10;
-        assignIncrementButtons(&osc1WaveType, 0, 7, 1);
-        valueChange = true;
-        lockPot(5);
-        clearLCD();
-        break;
+        menu = 69;
+        flashAction = synPatchLoadSave;
+      }
+      else if (synPatchLoadSave == 0) // LOAD
+      {
+        menu = 70;
+        gotoRootDir();
+        getDirCount();
+        assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      }
+      else // SAVE
+      {
+        gotoRootDir();
+        menu = 80;
+        getDirCount();
+        assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      }
+      valueChange = true;
+      break;
 
-      case 21: // OSC2 - choose user waveshape
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-        }
+    case 2:                     // SEQUENCER
+      if (!sdAvailable)         // the bank in flash instead
+      {
+        lcd.setCursor(0, 1);
+        if (seqBankLoadSave == 0)
+          lcd.print(loadFlashBank() ? "Flash Loaded!   " : seqPoolFull ? "Pool full!      " : "Flash Empty!    ");
         else
-        {
-          menu = 20;
-          assignIncrementButtons(&osc2WaveType, 0, 7, 1);
-          valueChange = true;
-          clearLCD();
-        }
-        break;
+          lcd.print(writeFlashTagged(FLASH_BANK, 0, "TB2S", SEQ_BANK_FORMAT, writeBankRecords) ? "Flash Saved!    " : "Not Saved!      ");
+      }
+      else if (seqBankLoadSave == 0) // LOAD
+      {
+        gotoRootDir();
+        menu = 250;
+        getDirCount();
+        assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      }
+      else // SAVE
+      {
+        gotoRootDir();
+        menu = 260;
+        getDirCount();
+        assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      }
+      valueChange = true;
+      break;
 
-      case 22: // Squ Pulse Width
-        menu = 20;
-        assignIncrementButtons(&osc2WaveType, 0, 7, 1);
-        valueChange = true;
-        lockPot(5);
-        clearLCD();
-        break;
+    case 3: // SETTINGS
+      if (settingsConfirm)
+      {
+        saveSettings();
+        settingsConfirm = false;
+      }
+      else
+      {
+        settingsConfirm = true;
+        updateMenu();
+        lcd.setCursor(0, 1);
+        lcd.print("    Overwrite?  ");
+      }
+      break;
+    }
+    break;
 
-      case 51: // LFO - choose user waveshape
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-        }
-        else
-        {
-          menu = 50;
-          assignIncrementButtons(&lfoShape, 0, 6, 1);
-          valueChange = true;
-          clearLCD();
-        }
-        break;
+  case 10: // OSC1
+    if (osc1WaveType == 4)
+    {
+      menu = 11;
+      gotoRootDir();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      valueChange = true;
+    }
+    else if (osc1WaveType == 3)
+    {
+      menu = 12;
+      lockPot(5);
+      assignIncrementButtons(&uiPulseWidth, -285, 285, 2);
+      valueChange = true;
+      clearLCD();
+    }
+    else if (osc1WaveType == 8)
+    {
+      menu = 13;
+      lockPot(5);
+      assignIncrementButtons(&osc1Factory, 0, FACTORY_WAVES - 1, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    else if (osc1WaveType == 9)
+    {
+      menu = 14;
+      lockPot(5);
+      assignIncrementButtons(&wavetablePosition, 0, 1023, 4);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
 
-      case 70: // LOAD PATCH
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-        }
-        else
-        {
-          menu = 0;
-          valueChange = true;
-          clearLCD();
-          updateMenu();
-        }
-        lockPot(5);
-        break;
+  case 14: // OSC1 - wavetable
+  case 15: // OSC1 - wavetable bank
+    if (menu == 14)
+    {
+      menu = 15;
+      if (wavetableCount < 0)
+        wavetableCount = countFolderFiles("/WTABLES", ".WAV");
+      lockPot(5);
+      assignIncrementButtons(&wavetableChoice, 0, wavetableCount, 1);
+    }
+    else if (wavetableChoice == 0)
+      unloadWavetable();
+    else
+      loadWavetable(wavetableChoiceName);
+    valueChange = true;
+    clearLCD();
+    break;
 
-      case 80: // SAVE PATCH
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-        }
-        else
-        {
-          menu = 0;
-          valueChange = true;
-          clearLCD();
-          updateMenu();
-        }
-        lockPot(5);
-        break;
+  case 11: // OSC1 - choose user waveshape
+    if (!inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      justEnteredFolder = true;
+    }
+    break;
 
-      case 200: // SEQUENCE TRIGGER
-        seqPlayStop();
-        valueChange = true;
-        break;
+  case 20: // OSC2
+    if (osc2WaveType == 5)
+    {
+      menu = 21;
+      gotoRootDir();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      valueChange = true;
+    }
+    else if (osc2WaveType == 3)
+    {
+      menu = 22;
+      lockPot(5);
+      assignIncrementButtons(&uiPulseWidth, -285, 285, 2);
+      valueChange = true;
+      clearLCD();
+    }
+    else if (osc2WaveType == 8)
+    {
+      menu = 23;
+      lockPot(5);
+      assignIncrementButtons(&osc2Factory, 0, FACTORY_WAVES - 1, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    else if (osc2WaveType == 9)
+    {
+      menu = 24;
+      lockPot(5);
+      assignIncrementButtons(&wavetablePosition, 0, 1023, 4);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
 
-      case 210: // SEQUENCE EDIT
-        seqPlayStop();
-        valueChange = true;
-        break;
+  case 24: // OSC2 - wavetable
+  case 25: // OSC2 - wavetable bank
+    if (menu == 24)
+    {
+      menu = 25;
+      if (wavetableCount < 0)
+        wavetableCount = countFolderFiles("/WTABLES", ".WAV");
+      lockPot(5);
+      assignIncrementButtons(&wavetableChoice, 0, wavetableCount, 1);
+    }
+    else if (wavetableChoice == 0)
+      unloadWavetable();
+    else
+      loadWavetable(wavetableChoiceName);
+    valueChange = true;
+    clearLCD();
+    break;
 
-      case 211: // SEQUENCE EDIT NOTES
-        menu = 210;
-        assignIncrementButtons(&seqEditStep, 0, 15, 1);
-        noteRelease();
-        clearLCD();
-        valueChange = true;
-        break;
+  case 21: // OSC2 - choose user waveshape
+    if (!inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      justEnteredFolder = true;
+    }
+    break;
 
-      case 250: // LOAD SEQ BANK
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-        }
-        else
-        {
-          menu = 0;
-          valueChange = true;
-          clearLCD();
-          updateMenu();
-        }
-        lockPot(5);
-        break;
+  case 50:
+    if (lfoShape == 6)
+    {
+      menu = 51;
+      gotoRootDir();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      valueChange = true;
+    }
+    else if (lfoShape == 7)
+    {
+      menu = 52;
+      lockPot(5);
+      assignIncrementButtons(&lfoFactory, 0, FACTORY_WAVES - 1, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
 
-      case 260: // SAVE SEQ BANK
-        if (inFolder)
-        {
-          setFolder();
-          getDirCount();
-          assignIncrementButtons(&dirChoice, 1, dirCount, 1);
-        }
-        else
-        {
-          menu = 0;
-          valueChange = true;
-          clearLCD();
-          updateMenu();
-        }
-        lockPot(5);
-        break;
+  case 51: // LFO - choose user waveshape
+    if (!inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      justEnteredFolder = true;
+    }
+    break;
+
+  case 69: // FAVOURITES
+    flashFavourite();
+    break;
+
+  case 75: // MORPH
+    if (morphSlot[0] >= 0)
+      stopMorph();
+    else
+      loadMorph();
+    valueChange = true;
+    break;
+
+  case 70: // LOAD PATCH
+    if (!inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      justEnteredFolder = true;
+    }
+    lockPot(5);
+    break;
+
+  case 80: // SAVE PATCH
+    if (!inFolder)
+    {
+      setFolder();
+      justEnteredFolder = true;
+    }
+    else if (saveConfirm)
+    {
+      saveConfirm = false;
+      savePatch();
+    }
+    else
+    {
+      if (strcmp(fileName, saveName) == 0 || emptySlot())
+        savePatch();
+      else
+      {
+        saveConfirm = true;
+        lcd.setCursor(4, 1);
+        lcd.print("Overwrite?  ");
       }
     }
-    else if (shiftL)
-      shiftL = false;
-    clearJust();
-  }
+    lockPot(5);
+    break;
 
-  switch (menu)
+  case 200: // SEQUENCE TRIGGER
+    menu = 210;
+    valueChange = true;
+    break;
+
+  case 210: // SEQUENCE EDIT
   {
-  case 200: // SEQ TRIGGER
-    for (byte i = 0; i < 8; i++)
+    if (!midiMode)
     {
-      if (justpressed[whiteButtons[i]])
+      boolean keyNotes = false;
+      for (byte i = 0; i < 13; i++)
       {
-        if (!seqRunning)
-        {
-          sourceSeq = currentSeq;
-          currentSeq = i;
-          selectedSeq = i;
-          destinationSeq = selectedSeq;
-          seqUpdateDisplay = true;
-          valueChange = true;
-        }
-        else
-        {
-          selectedSeq = i;
-          sourceSeq = currentSeq;
-          destinationSeq = selectedSeq;
-          valueChange = true;
-        }
-        if (midiTriggerOut)
-          midiA.sendNoteOn(midiTrigger[i], 127, midiTriggerChannel);
-        clearJust();
-        longPress = millis();
-        copied = false;
+        if (pressed[i])
+          keyNotes = true;
       }
-      if (pressed[whiteButtons[i]])
+      if (keyNotes)
       {
-        if ((millis() - longPress) > 500 && !copied)
-          copySeq();
+        updateSeqNotes();
+        seqEditStep = (seqEditStep + 1) % seq[currentSeq].patternLength; // increment the edit step
       }
-    }
-    for (byte i = 0; i < 5; i++)
-    {
-      if (pressed[14])
+      else // no front pane keyboard keys are held
       {
-        if (justpressed[1])
-        {
-          clearSeq();
-          clearJust();
-          valueChange = true;
-          shiftR = true;
-        }
+        menu = 211;
+        editSeqNotes();
+        assignIncrementButtons(&seqEditNote[0], -39, 48, 1);
+        clearLCD();
+        valueChange = true;
       }
-      else if (justpressed[blackButtons[i]])
+    }
+    else // MIDI mode
+    {
+      if (updateSeqNotes())                   // will return true if there were notes held and added to sequencer
+        seqEditStep = (seqEditStep + 1) % seq[currentSeq].patternLength; // increment the edit step
+      else
       {
-        switch (i)
-        {
-        case 0:
-          seq[currentSeq].transpose--;
-          if (seqRunning)
-            seqUpdateDisplay = true;
-          else
-            valueChange = true;
-          break;
-        case 1:
-          seq[currentSeq].transpose++;
-          if (seqRunning)
-            seqUpdateDisplay = true;
-          else
-            valueChange = true;
-          break;
-          clearJust();
-        }
+        menu = 211;
+        editSeqNotes();
+        assignIncrementButtons(&seqEditNote[0], -39, 48, 1);
+        clearLCD();
+        valueChange = true;
       }
     }
+  }
+  break;
+
+  case 250: // LOAD SEQ BANK
+    if (!inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+      justEnteredFolder = true;
+    }
+    else if (seqBankLoaded)
+    {
+      lcd.setCursor(4, 1);
+      if (unpackSeqBank())
+        lcd.print("Loaded!     ");
+      else
+        lcd.print(seqPoolFull ? "Pool full!  " : "Bad file!   ");
+      seqPoolFull = false; // shown here, not by seqPoolWarning()
+    }
+    lockPot(5);
     break;
 
-  case 210: // SEQ EDIT
+  case 260: // SAVE SEQ BANK
+    if (!inFolder)
+    {
+      setFolder();
+      justEnteredFolder = true;
+    }
+    else if (saveConfirm)
+    {
+      saveConfirm = false;
+      saveBank();
+    }
+    else
+    {
+      if (strcmp(fileName, saveName) == 0 || emptySlot())
+        saveBank();
+      else
+      {
+        saveConfirm = true;
+        lcd.setCursor(4, 1);
+        lcd.print("Overwrite?  ");
+      }
+    }
+    lockPot(5);
     break;
 
-  case 211: // SEQ NOTE ENTRY
+  case 350: // SETTINGS TUNING
+    if (tuningChoice == 0)
+      resetTuning();
+    else
+      loadTuning(tuningChoiceName);
+    valueChange = true;
     break;
   }
 }
 
-void checkKeyboard()
+void backKey()
 {
-  for (byte i = 0; i < 13; i++)
+  switch (menu)
   {
-    if (justpressed[i])
+  case 15: // Wtb - wavetable bank
+    menu = 14;
+    assignIncrementButtons(&wavetablePosition, 0, 1023, 4);
+    valueChange = true;
+    lockPot(5);
+    clearLCD();
+    break;
+
+  case 11: // OSC1 - choose user waveshape
+    if (inFolder)
     {
-      if (midiMode) // switch to listening to notes from front-panel keyboard
-      {
-        midiMode = false;
-        if (lastFilterCutoff != 0)
-          filterCutoff = lastFilterCutoff;
-        clearHeld();
-      }
-      //clearJust();
+      setFolder();
+      getDirCount();
     }
-  }
-  if (!midiMode)
-  {
-    if (soundKeys && menu != 200)
+    else
     {
-      if (!monoMode) // ie. monoMode = 0
-      {
-        voiceCounter = 4;            // how mnany voices are used?
-        for (byte i = 0; i < 4; i++) // check if a previously held note has been released
-        {
-          if (voice[i] != 255)
-          {
-            if (!pressed[voice[i]])
-            {
-              keyAssigned[voice[i]] = false;
-              voice[i] = 255;
-              voiceCounter--;
-              if (midiOut && keysOut)
-                midiA.sendNoteOff(keyboardOut[i], outVelocity, midiChannel);
-            }
-          }
-          else //
-            voiceCounter--;
-        }
+      menu = 10;
+      assignIncrementButtons(&osc1WaveType, 0, 9, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
 
-        if (voiceCounter == 0 && lastVoiceCount != 0)
-          noteRelease();
+  case 12: // Squ Pulse Width
+  case 13: // Fac - factory wave
+  case 14: // Wtb - wavetable
+    menu = 10;
+    assignIncrementButtons(&osc1WaveType, 0, 9, 1);
+    valueChange = true;
+    lockPot(5);
+    clearLCD();
+    break;
 
-        for (byte i = 0; i < 13; i++) // assign note to empty voice
-        {
-          if (!keyAssigned[i]) // if this key isn't already assigned, look for an empty voice for it
-          {
-            if (pressed[i])
-            {
-              byte j = 0;
-              while (voice[j] != 255 && j < 4) // go to the next voice if this voice isn't free
-                j++;
-              if (j < 4)
-              {
-                if (midiOut && keysOut)
-                {
-                  keyboardOut[j] = i + 60;
-                  midiA.sendNoteOn(keyboardOut[j], keyVelocity, midiChannel);
-                }
-                voice[j] = i;
-                keyAssigned[i] = true;
-                noteTrigger();
-                setVeloModulation(keyVelocity);
+  case 25: // Wtb - wavetable bank
+    menu = 24;
+    assignIncrementButtons(&wavetablePosition, 0, 1023, 4);
+    valueChange = true;
+    lockPot(5);
+    clearLCD();
+    break;
+
+  case 21: // OSC2 - choose user waveshape
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+    }
+    else
+    {
+      menu = 20;
+      assignIncrementButtons(&osc2WaveType, 0, 9, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
+
+  case 22: // Squ Pulse Width
+  case 23: // Fac - factory wave
+  case 24: // Wtb - wavetable
+    menu = 20;
+    assignIncrementButtons(&osc2WaveType, 0, 9, 1);
+    valueChange = true;
+    lockPot(5);
+    clearLCD();
+    break;
+
+  case 51: // LFO - choose user waveshape
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+    }
+    else
+    {
+      menu = 50;
+      assignIncrementButtons(&lfoShape, 0, 7, 1);
+      valueChange = true;
+      clearLCD();
+    }
+    break;
+
+  case 52: // LFO - factory wave
+    menu = 50;
+    assignIncrementButtons(&lfoShape, 0, 7, 1);
+    valueChange = true;
+    lockPot(5);
+    clearLCD();
+    break;
+
+  case 70: // LOAD PATCH
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+    }
+    else
+    {
+      menu = 0;
+      valueChange = true;
+      clearLCD();
+      updateMenu();
+    }
+    lockPot(5);
+    break;
+
+  case 80: // SAVE PATCH
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+    }
+    else
+    {
+      menu = 0;
+      valueChange = true;
+      clearLCD();
+      updateMenu();
+    }
+    lockPot(5);
+    break;
+
+  case 200: // SEQUENCE TRIGGER
+    seqPlayStop();
+    valueChange = true;
+    break;
+
+  case 210: // SEQUENCE EDIT
+    seqPlayStop();
+    valueChange = true;
+    break;
+
+  case 211: // SEQUENCE EDIT NOTES
+    menu = 210;
+    assignIncrementButtons(&seqEditStep, 0, seq[currentSeq].patternLength - 1, 1);
+    noteRelease();
+    clearLCD();
+    valueChange = true;
+    break;
+
+  case 250: // LOAD SEQ BANK
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+    }
+    else
+    {
+      menu = 0;
+      valueChange = true;
+      clearLCD();
+      updateMenu();
+    }
+    lockPot(5);
+    break;
+
+  case 260: // SAVE SEQ BANK
+    if (inFolder)
+    {
+      setFolder();
+      getDirCount();
+      assignIncrementButtons(&dirChoice, 1, dirCount, 1);
+    }
+    else
+    {
+      menu = 0;
+      valueChange = true;
+      clearLCD();
+      updateMenu();
+    }
+    lockPot(5);
+    break;
+  }
+}
+
+void keyPress(byte key)
+{
+  switch (menu)
+  {
+  case 76: // SNAPSHOTS - the white keys recall
+    for (byte i = 0; i < 8; i++)
+    {
+      if (key == whiteButtons[i] && recallSnapshot((snapshotGroup * 8) + i))
+      {
+        valueChange = true;
+        clearJust();
+      }
+    }
+    break;
+
+  case 200: // SEQ TRIGGER
+    for (byte i = 0; i < 8; i++)
+    {
+      if (key == whiteButtons[i])
+      {
+        if (!seqRunning)
+        {
+          sourceSeq = currentSeq;
+          currentSeq = (seqGroup * 8) + i;
+          selectedSeq = currentSeq;
+          destinationSeq = selectedSeq;
+          seqUpdateDisplay = true;
+          valueChange = true;
+        }
+        else
+        {
+          selectedSeq = (seqGroup * 8) + i;
+          sourceSeq = currentSeq;
+          destinationSeq = selectedSeq;
+          valueChange = true;
+        }
+        if (midiTriggerOut)
+          midiA.sendNoteOn(midiTrigger[i], 127, midiTriggerChannel);
+        clearJust();
+      }
+    }
+    if (key == blackButtons[0] || key == blackButtons[1])
+    {
+      if (key == blackButtons[0])
+        seq[currentSeq].transpose--;
+      else
+        seq[currentSeq].transpose++;
+      if (seqRunning)
+        seqUpdateDisplay = true;
+      else
+        valueChange = true;
+    }
+    break;
+  }
+}
+
+void chordPress(byte key, byte held)
+{
+  switch (menu)
+  {
+  case 76: // SNAPSHOTS - hold enter and press a white key to store there
+    for (byte i = 0; i < 8; i++)
+    {
+      if (key == whiteButtons[i] && held == 14)
+      {
+        clearJust();
+        shiftR = true;
+        storeSnapshot((snapshotGroup * 8) + i);
+        valueChange = true;
+      }
+      else if (key == whiteButtons[i])
+        keyPress(key);
+    }
+    break;
+
+  case 200: // SEQ TRIGGER
+    if (held == 14 && key == blackButtons[0]) // hold enter and press C# to clear the sequence
+    {
+      clearSeq();
+      clearJust();
+      valueChange = true;
+      shiftR = true;
+    }
+    else if (held == 13) // the back key doesn't change anything here
+      keyPress(key);
+    else // with enter held the white keys still select, the transpose keys don't
+    {
+      for (byte i = 0; i < 8; i++)
+      {
+        if (key == whiteButtons[i])
+          keyPress(key);
+      }
+    }
+    break;
+  }
+}
+
+void checkKeyboard()
+{
+  for (byte i = 0; i < 13; i++)
+  {
+    if (justpressed[i])
+    {
+      if (midiMode) // switch to listening to notes from front-panel keyboard
+      {
+        midiMode = false;
+        if (lastFilterCutoff != 0)
+          filterCutoff = lastFilterCutoff;
+        clearHeld();
+      }
+      //clearJust();
+    }
+  }
+  if (!midiMode)
+  {
+    if (soundKeys && menu != 200 && menu != 76) // the keys pick sequences or snapshots there
+    {
+      if (!monoMode) // ie. monoMode = 0
+      {
+        voiceCounter = 4;            // how mnany voices are used?
+        for (byte i = 0; i < 4; i++) // check if a previously held note has been released
+        {
+          if (voice[i] != 255)
+          {
+            if (!pressed[voice[i]])
+            {
+              keyAssigned[voice[i]] = false;
+              voice[i] = 255;
+              voiceCounter--;
+              if (midiOut && keysOut)
+                midiA.sendNoteOff(keyboardOut[i], outVelocity, midiChannel);
+            }
+          }
+          else //
+            voiceCounter--;
+        }
+
+        if (voiceCounter == 0 && lastVoiceCount != 0)
+          noteRelease();
+
+        for (byte i = 0; i < 13; i++) // assign note to empty voice
+        {
+          if (!keyAssigned[i]) // if this key isn't already assigned, look for an empty voice for it
+          {
+            if (pressed[i])
+            {
+              byte j = 0;
+              while (voice[j] != 255 && j < 4) // go to the next voice if this voice isn't free
+                j++;
+              if (j < 4)
+              {
+                if (midiOut && keysOut)
+                {
+                  keyboardOut[j] = i + 60;
+                  midiA.sendNoteOn(keyboardOut[j], keyVelocity, midiChannel);
+                }
+                voice[j] = i;
+                keyAssigned[i] = true;
+                noteTrigger();
+                setVeloModulation(keyVelocity);
                 if (voiceCounter == 0)
                 {
                   voiceCounter++;
@@ -1158,21 +1399,6 @@ void incDecSpecials()
   if (adjustValue == &dirChoice && dirCount != 0)
     prepNextChoice();
 
-  else if (adjustValue == &osc1WaveType)
-    setOsc1WaveType(*adjustValue);
-
-  else if (adjustValue == &osc2WaveType)
-    setOsc2WaveType(*adjustValue);
-
-  else if (adjustValue == &filterResonance)
-    setFilterResonance(filterResonance);
-
-  else if (adjustValue == &filterType)
-    setFilterType(filterType);
-
-  else if (adjustValue == &lfoShape)
-    setLfoShape(lfoShape);
-
   else if (adjustValue == &tmpLfoRate)
   {
     if (lfoLowRange)
@@ -1190,58 +1416,43 @@ void incDecSpecials()
     velLfoRate = lfoRate;
   }
 
-  else if (adjustValue == &mainMenu)
-    updateMenu();
-
-  else if (adjustValue == &synPatchLoadSave)
-    updateMenu();
+  else if (adjustValue >= &seqEditNote[0] && adjustValue <= &seqEditNote[3]) // the notes are packed, the buttons edit a copy
+    setSeqNote(currentSeq, adjustValue - &seqEditNote[0], seqEditStep, *adjustValue);
 
-  else if (adjustValue == &seqBankLoadSave)
-    updateMenu();
+  else if (adjustValue >= &seqEditSetting[0] && adjustValue <= &seqEditSetting[3]) // the settings are packed too
+    setSeqSetting(adjustValue - &seqEditSetting[0], *adjustValue);
 
-  else if (adjustValue == &arp)
-    clearHeld();
+  else if (adjustValue == &seqCCLane)
+    seqCCNum = min(seq[currentSeq].controlNum[seqCCLane], 128);
 
-  else if (adjustValue == &bpm)
-  {
-    setBpm();
-    if (menu == 220)
-      seq[currentSeq].bpm = bpm;
-  }
+  else if (adjustValue == &seqCCNum)
+    seq[currentSeq].controlNum[seqCCLane] = (seqCCNum < 128) ? seqCCNum : 255;
 
-  else if (adjustValue == &arpForward)
-    sortArp();
+  else if (adjustValue == &tuningChoice)
+    getTuningName(tuningChoice);
 
-  else if (adjustValue == &osc1Volume)
-    createOsc1Volume();
+  else if (adjustValue == &wavetableChoice)
+    getWavetableName(wavetableChoice);
 
-  else if (adjustValue == &osc2Volume)
-    createOsc2Volume();
+  else if (adjustValue == &ccLearn && ccLearn == 2)
+    clearCCMapping(ccLearnParam);
 
-  else if (adjustValue == &shaperType)
-    createWaveShaper();
+  else if (adjustValue == &mainMenu)
+    updateMenu();
 
-  else if (adjustValue == &shaperType1PotVal)
-  {
-    float tmp = (float)shaperType1PotVal / 1024;
-    waveShapeAmount = tmp;
-    createWaveShaper();
-  }
+  else if (adjustValue == &synPatchLoadSave)
+    updateMenu();
 
-  else if (adjustValue == &waveShapeAmount2)
-    createWaveShaper();
+  else if (adjustValue == &seqBankLoadSave)
+    updateMenu();
 
-  else if (adjustValue == &gainAmountPotVal)
+  else if (paramByValue(adjustValue) != NO_PARAM) // everything in the parameter registry knows its own setter
   {
-    float tmp = (float)gainAmountPotVal / 1024;
-    tmp += 1.0;
-    gainAmount = tmp;
-    createGainTable();
+    applyParam(paramByValue(adjustValue));
+    if (adjustValue == &bpm && menu == 220)
+      seq[currentSeq].bpm = bpm;
   }
 
-  else if (adjustValue == &midiSync)
-    setSyncType();
-
   // evaluate seperately for the sake of the else
   if (adjustValue == &menuChoice)
   {
@@ -1428,6 +1639,8 @@ void currentEnvelope()
     envelopeProgress = 255;
     if (envelopeVolume > 10)
       envelopeVolume -= 9; // we need to do this to prevent clicking
+    else if (handoverSlot >= 0 && patchHandover == HANDOVER_NOTE && !handoverFading)
+      handoverDue = true; // the new patch starts with this note - it waits here for a pass while updateHandover() runs the setters
     else
     {
       attackStartTime = millis();
@@ -1459,8 +1672,8 @@ void currentEnvelope()
       envelopeVolume = map(millis(), attackStartTime, attackStartTime + attackTime, 0, 1023);
       lastVolume = envelopeVolume;
       releaseVolume = envelopeVolume;
-      envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) << 4;
-      envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) << 4;
+      envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) >> 9;
+      envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) >> 9;
       envFilterCutoff = (envelopeVolume * envFilterCutoffFactor) >> 12;
       if (envLfoRate > 10)
       {
@@ -1479,8 +1692,8 @@ void currentEnvelope()
       envelopeVolume = map(millis(), decayStartTime, decayStartTime + decayTime, 1023, sustainLevel);
       lastVolume = envelopeVolume;
       releaseVolume = envelopeVolume;
-      envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) << 4;
-      envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) << 4;
+      envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) >> 9;
+      envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) >> 9;
       envFilterCutoff = (envelopeVolume * envFilterCutoffFactor) >> 12;
       if (envLfoRate > 10)
       {
@@ -1493,8 +1706,8 @@ void currentEnvelope()
     envelopeVolume = sustainLevel;
     lastVolume = sustainLevel;
     releaseVolume = envelopeVolume;
-    envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) << 4;
-    envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) << 4;
+    envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) >> 9;
+    envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) >> 9;
     envFilterCutoff = (envelopeVolume * envFilterCutoffFactor) >> 12;
     if (envLfoRate > 10)
     {
@@ -1516,8 +1729,8 @@ void currentEnvelope()
       if (envelopeVolume > 0)
       {
         envelopeVolume = map(millis(), releaseStartTime, releaseStartTime + releaseTime, releaseVolume, 0);
-        envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) << 4;
-        envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) << 4;
+        envOsc1Pitch = (envelopeVolume * envOsc1PitchFactor) >> 9;
+        envOsc2Pitch = (envelopeVolume * envOsc2PitchFactor) >> 9;
         envFilterCutoff = (envelopeVolume * envFilterCutoffFactor) >> 12;
         if (envLfoRate > 10)
         {
@@ -1668,14 +1881,114 @@ inline long fxmul(long a, int b)
   return ((a * b) >> FX_SHIFT);
 }
 
-// LFO.ino
+// FLASH.ino - the records are in TB2_Flash, over flashMemory
+bool writeFlashPage(uint8_t *address, const uint32_t *page) // erase and write a page of bank 1 - the sketch runs on from bank 0 meanwhile
+{
+  volatile uint32_t *latch = (volatile uint32_t *)address;
+  for (byte i = 0; i < FLASH_PAGE / 4; i++)
+    latch[i] = page[i]; // writes to the page only fill the controller's latch buffer
+  EFC1->EEFC_FCR = EEFC_FCR_FKEY(0x5A) | EEFC_FCR_FARG(((uint32_t)address - IFLASH1_ADDR) / FLASH_PAGE) | EEFC_FCR_FCMD(0x03); // EWP
+  uint32_t status = 0;
+  uint32_t errors = 0;
+  while ((status & EEFC_FSR_FRDY) == 0)
+  {
+    status = EFC1->EEFC_FSR; // reading clears the error flags, so they're collected
+    errors |= status;
+  }
+  return (errors & (EEFC_FSR_FCMDE | EEFC_FSR_FLOCKE)) == 0;
+}
 
-void lfoHandler()
+boolean writeFlashTagged(byte area, byte slot, const char *magic, uint16_t format, void (*records)(patchWriter *)) // a patch or bank, laid out as its file
 {
-  // *** LFO ***
-  if (!lfoSync)
-  {
-    lfoCounter++;
+  // a dry run first for the header's length and CRC, as with multi-block saves
+  patchWriter writer;
+  patchHeader header;
+  flashWriter flash;
+  beginTaggedFile(&writer, NULL);
+  records(&writer);
+  fillPatchHeader(&writer, &header, magic, format);
+  if (sizeof(header) + header.length > (uint32_t)flashAreas[area].pages * FLASH_PAGE)
+    return false;
+  if (!beginFlashRecord(&flashMemory, &flash, area, slot))
+    return false;
+  appendFlashBytes(&flash, &header, sizeof(header));
+  beginTaggedFile(&writer, NULL);
+  writer.flash = &flash;
+  records(&writer);
+  flushPatchWriter(&writer);
+  return endFlashRecord(&flash);
+}
+
+void openFlashReader(patchReader *reader, const flashRecord *record) // the tagged readers take a NULL file for this
+{
+  reader->direct = false;
+  reader->flash = (const byte *)record + FLASH_PAGE;
+  reader->flashSize = record->length;
+  reader->flashUsed = 0;
+}
+
+int8_t readFlashPatch(byte favourite) // straight from flash into the cache, -1 if the slot is empty
+{
+  patchReader reader;
+  const flashRecord *record = findFlashRecord(&flashMemory, FLASH_PATCHES, favourite);
+  if (record == NULL)
+    return -1;
+  int8_t slot = claimCachedPatch(fileName);
+  if (slot < 0)
+    return -1;
+  openFlashReader(&reader, record);
+  int result = openPatchReader(&reader, NULL, slot, false) ? 1 : -1;
+  while (result == 1)
+    result = readPatchStep(&reader);
+  if (result == 0)
+    finishCachedPatch(slot);
+  else
+  {
+    patchCache[slot].name[0] = 0;
+    slot = -1;
+  }
+  return slot;
+}
+
+boolean loadFlashBank() // the bank last saved, false if there's none
+{
+  patchReader reader;
+  const flashRecord *record = findFlashRecord(&flashMemory, FLASH_BANK, 0);
+  if (record == NULL)
+    return false;
+  openFlashReader(&reader, record);
+  return (readTaggedHeader(&reader, NULL, "TB2S") && readBankRecords(&reader));
+}
+
+void flashFavourite() // load or save the chosen favourite
+{
+  sprintf(fileName, "*FAV%d", flashChoice + 1); // not a legal file name, so it can't collide in the cache
+  lcd.setCursor(4, 1);
+  if (flashAction == 0)
+  {
+    if (findFlashRecord(&flashMemory, FLASH_PATCHES, flashChoice) == NULL)
+      lcd.print("Empty!      ");
+    else
+      loadPatch(); // loadProceed() finds it in the cache, or in flash
+  }
+  else
+  {
+    forgetCachedPatch(fileName);
+    if (writeFlashTagged(FLASH_PATCHES, flashChoice, "TB2P", PATCH_FORMAT, writePatchRecords))
+      lcd.print("Saved!      ");
+    else
+      lcd.print("Not saved!  ");
+  }
+}
+
+// LFO.ino
+
+void lfoHandler()
+{
+  // *** LFO ***
+  if (!lfoSync)
+  {
+    lfoCounter++;
     if (lfoCounter >= velLfoRate)
       updateLFO();
   }
@@ -1703,6 +2016,15 @@ void lfoHandler()
     seqBlinkCounter = 0;
   }
 
+  // *** CONTROL RATE ***
+  static byte controlCounter = 0;
+  controlCounter++;
+  if (controlCounter >= CONTROL_DIVIDER)
+  {
+    controlTick();
+    controlCounter = 0;
+  }
+
   // *** DISPLAY REFRESH ***
   static uint16_t refreshCounter = 0;
   refreshCounter++;
@@ -1713,29 +2035,63 @@ void lfoHandler()
   }
 }
 
+void controlTick() // 1kHz - slew the audio-critical parameters towards their targets
+{
+  controlTicks++;
+  boolean cutoffMoved = slewStep(&cutoffSlew);
+  if (slewStep(&pressureSlew))
+  {
+    pressureCutoff = pressureSlew.current >> 3;
+    cutoffMoved = true;
+  }
+  if (cutoffMoved)
+    setFilterCutoff(constrain((cutoffSlew.current + tmpCutoff + envFilterCutoff + velCutoff + pressureCutoff), 0, 255));
+  slewStep(&volumeSlew);
+  slewStep(&bendSlew);
+  slewStep(&modWheelSlew);
+  if (envelopeProgress != 255) // the envelope is not idle
+    assignVoices();            // pitch modulation is converted to phase increments once per control tick
+}
+
+boolean slewStep(slewLimiter *slew) // returns true if the value moved
+{
+  int diff = *slew->target - slew->current;
+  if (diff == 0)
+    return false;
+  slew->current += constrain(diff, -slew->maxStep, slew->maxStep);
+  return true;
+}
+
 void updateLFO()
 {
-  tmpLFO = *(lfoShapePointer + lfoIndex);
+  if (lfoShapeBytes != NULL)
+    tmpLFO = lfoShapeBytes[lfoIndex] << 4;
+  else
+    tmpLFO = *(lfoShapePointer + lfoIndex);
   lfoIndex = (lfoIndex < 599) ? lfoIndex + 1 : 0;
 
   // *** OSC1 PITCH ***
-  if (lfoOsc1DetuneFactor < 200)                                  // so the pitch modulation is less dramatic at low levels
-    lfoOsc1Detune = ((tmpLFO - 2048) * lfoOsc1DetuneFactor) << 1; // needs to be a positive and negative value
+  if (lfoOsc1DetuneFactor < 200)                                   // so the pitch modulation is less dramatic at low levels
+    lfoOsc1Detune = ((tmpLFO - 2048) * lfoOsc1DetuneFactor) >> 11; // in pitch units, needs to be a positive and negative value
   else
-    lfoOsc1Detune = ((tmpLFO - 2048) * lfoOsc1DetuneFactor) << 2; // needs to be a positive and negative value
+    lfoOsc1Detune = ((tmpLFO - 2048) * lfoOsc1DetuneFactor) >> 10; // up to +- 8 semitones
 
   // *** OSC2 PITCH ***
   if (lfoOsc2DetuneFactor < 200)
-    lfoOsc2Detune = ((tmpLFO - 2048) * lfoOsc2DetuneFactor) << 1;
+    lfoOsc2Detune = ((tmpLFO - 2048) * lfoOsc2DetuneFactor) >> 11;
   else
-    lfoOsc2Detune = ((tmpLFO - 2048) * lfoOsc2DetuneFactor) << 2;
+    lfoOsc2Detune = ((tmpLFO - 2048) * lfoOsc2DetuneFactor) >> 10;
 
   // *** FILTER CUTOFF ***
-  tmpCutoff = ((tmpLFO - 2048) * lfoAmount) >> 14;                                              // value centered around 0 (positive and negative)
-  setFilterCutoff(constrain((filterCutoff + tmpCutoff + envFilterCutoff + velCutoff), 0, 255)); // center  the LFO amount around the current filter cutoff setting
+  tmpCutoff = ((tmpLFO - 2048) * lfoAmount) >> 14;                                                               // value centered around 0 (positive and negative)
+  setFilterCutoff(constrain((cutoffSlew.current + tmpCutoff + envFilterCutoff + velCutoff + pressureCutoff), 0, 255)); // center  the LFO amount around the current filter cutoff setting
+
+  // *** MOD WHEEL VIBRATO ***
+  modVibrato = ((tmpLFO - 2048) * modWheelSlew.current) >> 13; // up to +- 1 semitone
 
   // *** AMPLITUDE ***
-  lfoAmp = 1023 - (((tmpLFO >> 2) * lfoAmpFactor) >> 10);
+  int ampDepth = min(lfoAmpFactor + pressureSlew.current, 1023); // pressure adds tremolo
+  lfoAmp = 1023 - (((tmpLFO >> 2) * ampDepth) >> 10);
 
   // *** PULSE WIDTH ***
   if (lfoPwFactor > 10)
@@ -1747,7 +2103,6 @@ void updateLFO()
 
   if (envelopeProgress != 255) // the envelope is not idle
   {
-    assignVoices(); // have to call this in the LFO so pitch modulation is updated
     // *** OSC1 OCTAVE ***
     osc1OctaveOut = osc1Octave + map(tmpLFO, 0, 4095, osc1OctaveMod * -1, osc1OctaveMod);
     constrain(osc1OctaveOut, 1, 9);
@@ -1788,6 +2143,7 @@ void setLfoShape(byte shape)
     lfoShapePointer = &nUserTable3[0];
     break;
   }
+  lfoShapeBytes = (shape == 7) ? factoryWaves[lfoFactory] : NULL;
 }
 
 void updateLfoSyncTarget()
@@ -1990,12 +2346,12 @@ void HandleNoteOn(byte channel, byte note, byte velocity)
       {
         if (seqRunning)
         {
-          selectedSeq = i;
+          selectedSeq = (seqGroup * 8) + i;
         }
         else
         {
-          currentSeq = i;
-          selectedSeq = i;
+          currentSeq = (seqGroup * 8) + i;
+          selectedSeq = currentSeq;
         }
       }
     }
@@ -2182,170 +2538,894 @@ void HandleClock(void) // what to do for 24ppq clock pulses
     clockInMicros = micros();
     if (inPulseCounter != 0)
     {
-      pulseMicros = micros() - lastClockInMicros;
-      tmpBpm[inPulseCounter % 24] = 60000000 / (pulseMicros * 24);
+      pulseMicros = micros() - lastClockInMicros;
+      tmpBpm[inPulseCounter % 24] = 60000000 / (pulseMicros * 24);
+    }
+    if (inPulseCounter > 4)
+    {
+      int totalBpm = 0;
+      for (byte i = 0; i < 24; i++)
+        totalBpm += tmpBpm[i];
+
+      if (bpm != totalBpm / 24 + 1)
+      {
+        bpm = totalBpm / 24 + 1; // +1 here because for some reason the BPM reading is off by one
+        setBpm();
+        if (menu == 230)
+          showValue(5, 1, bpm);
+      }
+    }
+    inPulseCounter++;
+    lastClockInMicros = clockInMicros;
+  }
+}
+
+void HandleStart(void)
+{
+  if (syncIn)
+  {
+    seqRunning = true;
+    seqStep = 0; // rewind the sequence
+    inPulseCounter = 0;
+    pulseCounter = 0;
+    eighthCounter = 0;
+    longStep = true;
+    cueNextSeq();
+    seqJustStarted = true;
+  }
+}
+
+void HandleStop(void)
+{
+  if (syncIn)
+  {
+    seqRunning = false;
+    seqSendMidiNoteOffs = true;
+    seqStep = 0; // rewind the sequence
+    pulseCounter = 0;
+    eighthCounter = 0;
+    longStep = true;
+
+    noteRelease();
+  }
+}
+
+void sendMidi()
+{
+  if (midiOut)
+  {
+    // ARPEGGIATOR
+    if (arpSendMidiNoteOn)
+    {
+      if (arpMidiOut != 255)
+        midiA.sendNoteOff(arpMidiOut, 127, midiChannel);
+      arpMidiOut = sortedArpList[arpPosition] + (arpOctaveCounter * 12) + 60;
+      midiA.sendNoteOn(arpMidiOut, 127, midiChannel);
+      arpSendMidiNoteOn = false;
+    }
+
+    else if (arpSendMidiNoteOff)
+    {
+      midiA.sendNoteOff(arpMidiOut, 127, midiChannel);
+      arpMidiOut = 255;
+      arpSendMidiNoteOff = false;
+    }
+
+    // SEQUENCER
+    else if (seqSendMidiNoteOns)
+    {
+      for (byte i = 0; i < 4; i++)
+      {
+        if (seqMidiOff[i] == 255 && seqMidiOn[i] != 255)
+        {
+          midiA.sendNoteOn(seqMidiOn[i] + 60, outVelocity, midiChannel);
+          seqMidiOff[i] = seqMidiOn[i];
+        }
+        else if (seqMidiOn[i] != 255)
+        {
+          midiA.sendNoteOff(seqMidiOff[i] + 60, 127, midiChannel);
+          midiA.sendNoteOn(seqMidiOn[i] + 60, outVelocity, midiChannel);
+          seqMidiOff[i] = seqMidiOn[i];
+        }
+      }
+      seqSendMidiNoteOns = false;
+    }
+
+    else if (seqSendMidiNoteOffs)
+    {
+      for (byte i = 0; i < 4; i++)
+      {
+        if (seqMidiOff[i] != 255)
+        {
+          midiA.sendNoteOff(seqMidiOff[i] + 60, 127, midiChannel);
+          seqMidiOff[i] = 255;
+        }
+      }
+      seqSendMidiNoteOffs = false;
+    }
+  }
+}
+
+void checkForClock()
+{
+  if (receivingClock)
+  {
+    if ((millis() - lastClock) > 300)
+      receivingClock = false;
+  }
+}
+
+void checkThru()
+{
+  if (midiThruType == 0)
+    midiA.turnThruOff();
+  else if (midiThruType == 1)
+    midiA.turnThruOn(midi::Full);
+  else if (midiThruType == 2)
+    midiA.turnThruOn(midi::DifferentChannel); // in conjunction with MIDI_CHANNEL_OMNI, this only allows system messages though like clock, stop, start
+}
+
+void setSyncType()
+{
+  switch (midiSync)
+  {
+  case 0:
+    syncIn = false;
+    midiClockOut = 0;
+    break;
+  case 1:
+    syncIn = false;
+    midiClockOut = 1;
+    break;
+  case 2:
+    syncIn = true;
+    midiClockOut = 0;
+    break;
+  }
+}
+
+void clearCurrentNotes()
+{
+  for (byte i = 0; i < 10; i++)
+    currentNotes[i] = 255;
+
+  highestNote = 255;
+  lowestNote = 255;
+  lastNote = 255;
+  previousNote = 255;
+}
+
+void HandleCC(byte channel, byte number, byte value)
+{
+  midiCC[number] = value;
+  if (number == 1 && channel == midiChannel) // the mod wheel is always a modulation source
+    modWheelIn = value << 3;
+  channel = (channel - 1) & 15;
+  if (menu == 340 && ccLearn == 1) // learn mode - map this CC to the selected parameter
+  {
+    byte id = ccParam(channel, number);
+    if (id != NO_PARAM)
+      ccMap[id] = NO_CC; // and one parameter per CC
+    ccMap[ccLearnParam] = (channel << 8) | number;
+    ccLearn = 0;
+    valueChange = true;
+    return;
+  }
+  byte id = ccParam(channel, number);
+  if (id != NO_PARAM)
+    queueCC(id, value);
+}
+
+void HandlePitchBend(byte channel, int bend)
+{
+  if (channel == midiChannel)
+    bendIn = bend; // smoothed and applied by controlTick()
+}
+
+void HandleAfterTouchChannel(byte channel, byte pressure)
+{
+  if (channel == midiChannel)
+    pressureIn = pressure << 3;
+}
+
+void HandleProgramChange(byte channel, byte number) // program numbers 0 - 15 (shown as 1 - 16) recall the snapshots
+{
+  if (channel == midiChannel && number < SNAPSHOTS && recallSnapshot(number))
+    valueChange = true;
+}
+
+void queueCC(byte id, byte value) // only the latest value is kept, applyPendingCC() does the rest
+{
+  ccPendingValue[id] = value;
+  ccPending[id >> 5] |= 1UL << (id & 31);
+}
+
+void applyPendingCC() // at most once per control tick, however dense the CC stream is
+{
+  if (ccAppliedTick == controlTicks)
+    return;
+  ccAppliedTick = controlTicks;
+  for (byte i = 0; i < (PARAMS + 31) / 32; i++)
+  {
+    while (ccPending[i])
+    {
+      byte bit = __builtin_ctz(ccPending[i]);
+      ccPending[i] &= ~(1UL << bit);
+      byte id = (i << 5) + bit;
+      if (setParam(id, paramFromPot(id, (ccPendingValue[id] * 4095) / 127))) // the same curve as the pots
+        valueChange = true;
+    }
+  }
+}
+
+void clearCCMapping(byte id)
+{
+  ccMap[id] = NO_CC;
+}
+
+byte ccParam(byte channel, byte number) // the parameter a CC is mapped to, NO_PARAM if none - channel 0 - 15
+{
+  uint16_t cc = (channel << 8) | number;
+  for (byte id = 0; id < PARAMS; id++)
+  {
+    if (ccMap[id] == cc)
+      return id;
+  }
+  return NO_PARAM;
+}
+
+byte ccLearned(byte id, byte *channel) // returns the CC mapped to a parameter, NO_PARAM if none
+{
+  if (ccMap[id] == NO_CC)
+    return NO_PARAM;
+  *channel = ccMap[id] >> 8;
+  return ccMap[id] & 127;
+}
+
+void loadCCMap(int *buffer)
+{
+  memset(ccMap, 0xFF, sizeof(ccMap));
+  for (byte i = CC_SLOT; i < CC_SLOT + CC_MAPPINGS; i++)
+  {
+    int channel = (buffer[i] >> 16) - 1; // 0 is an empty slot
+    byte number = (buffer[i] >> 8) & 127;
+    byte id = buffer[i] & 255;
+    if (channel >= 0 && channel < 16 && id < PARAMS && ccParam(channel, number) == NO_PARAM)
+      ccMap[id] = (channel << 8) | number;
+  }
+}
+
+void saveCCMap(int *buffer)
+{
+  byte slot = CC_SLOT;
+  for (byte id = 0; id < PARAMS; id++)
+  {
+    if (ccMap[id] != NO_CC && slot < CC_SLOT + CC_MAPPINGS)
+      buffer[slot++] = ((ccMap[id] >> 8) + 1) << 16 | (ccMap[id] & 127) << 8 | id;
+  }
+}
+
+// MORPH.ino
+boolean loadMorph() // read favourites A and B into the cache and pin them there, false if either is empty
+{
+  stopMorph();
+  finishHandover();
+  for (byte side = 0; side < 2; side++)
+  {
+    sprintf(fileName, "*FAV%d", morphFavourite[side]);
+    int8_t slot = findCachedPatch(fileName);
+    if (slot < 0)
+      slot = readFlashPatch(morphFavourite[side] - 1);
+    if (slot < 0)
+    {
+      stopMorph();
+      return false;
+    }
+    morphSlot[side] = slot; // pinned, so reading B can't take A's entry
+  }
+
+  morphWaves = 0;
+  for (byte w = 0; w < 3; w++)
+  {
+    if (memcmp(patchCache[morphSlot[0]].wave[w], patchCache[morphSlot[1]].wave[w], sizeof(patchCache[0].wave[w])) != 0)
+      morphWaves |= 1 << w;
+  }
+  applyCachedPatch(morphSlot[0], true); // start from A with everything that doesn't morph - tuning, wavetable bank
+  lastMorphAmount = -1;
+  return true;
+}
+
+void stopMorph() // the sound stays where the morph left it
+{
+  morphSlot[0] = -1;
+  morphSlot[1] = -1;
+}
+
+void updateMorph() // the parameters that differ glide or switch halfway, the user waves that differ are cross-blended
+{
+  if (morphSlot[0] < 0 || morphAmount == lastMorphAmount || millis() - morphTick < MORPH_TICK)
+    return;
+  morphTick = millis();
+  lastMorphAmount = morphAmount;
+  const cachedPatch *a = &patchCache[morphSlot[0]];
+  const cachedPatch *b = &patchCache[morphSlot[1]];
+  blendParams(a->param, b->param, morphAmount);
+
+  uint16_t *table[3] = {nUserTable1, nUserTable2, nUserTable3};
+  for (byte w = 0; w < 3; w++)
+  {
+    if (bitRead(morphWaves, w))
+    {
+      for (uint16_t i = 0; i < WAVE_SAMPLES; i++)
+        table[w][i] = a->wave[w][i] + (((b->wave[w][i] - a->wave[w][i]) * morphAmount) >> 10);
+    }
+  }
+}
+
+boolean cachePinned(byte slot) // a cache entry that mustn't be reused
+{
+  return (slot == morphSlot[0] || slot == morphSlot[1] || slot == handoverSlot);
+}
+
+void showMorphExtra()
+{
+  lcd.setCursor(12, 1);
+  lcd.print((morphSlot[0] >= 0) ? "On  " : "Off ");
+}
+
+// PARAMS.ino
+#define PW_RANGE ((WAVE_SAMPLES / 2) - 15)
+
+constexpr paramDescriptor params[PARAMS] = {
+    // name, value, low, high, increment, curve, format, names, patch slot, settings slot, apply
+    {"O1Wv", &osc1WaveType, 0, 9, 1, CURVE_STEPS, FORMAT_LIST, "Sin Tri Saw Squ Us1 Us2 Us3 Nse Fac Wtb ", 0, NO_SLOT, applyOsc1Wave},
+    {"O1Oc", &osc1Octave, 1, 9, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 1, NO_SLOT, assignVoices},
+    {"O1Lv", &osc1Volume, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 2, NO_SLOT, createOsc1Volume},
+    {"O1Dt", &osc1Detune, -24, 24, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 3, NO_SLOT, assignVoices},
+    {"PWid", &uiPulseWidth, -PW_RANGE, PW_RANGE, 2, CURVE_LINEAR, FORMAT_NUMBER, NULL, 4, NO_SLOT, applyPulseWidth},
+    {"O2Wv", &osc2WaveType, 0, 9, 1, CURVE_STEPS, FORMAT_LIST, "Sin Tri Saw Squ Us1 Us2 Us3 Nse Fac Wtb ", 5, NO_SLOT, applyOsc2Wave},
+    {"O2Oc", &osc2Octave, 1, 9, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 6, NO_SLOT, assignVoices},
+    {"O2Lv", &osc2Volume, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 7, NO_SLOT, createOsc2Volume},
+    {"O2Dt", &osc2Detune, -256, 256, 2, CURVE_CENTER, FORMAT_CENTS, NULL, 8, NO_SLOT, assignVoices},
+    {"Cut ", &filterCutoff, 0, 255, 1, CURVE_CUTOFF, FORMAT_NUMBER, NULL, 9, NO_SLOT, NULL},
+    {"Res ", &filterResonance, 0, 255, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 10, NO_SLOT, applyResonance},
+    {"FTyp", &filterType, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "LP  BP  HP  ", 11, NO_SLOT, applyFilterType},
+    {"FByp", &filterBypass, 1, 0, 1, CURVE_STEPS, FORMAT_LIST, "Off On  ", 12, NO_SLOT, NULL},
+    {"Att ", &attackTime, 1, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 13, NO_SLOT, NULL},
+    {"Dec ", &decayTime, 1, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 14, NO_SLOT, NULL},
+    {"Sus ", &sustainLevel, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 15, NO_SLOT, NULL},
+    {"Rel ", &releaseTime, 1, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 16, NO_SLOT, NULL},
+    {"LShp", &lfoShape, 0, 7, 1, CURVE_STEPS, FORMAT_LIST, "Sin Tri Saw Squ Us1 Us2 Us3 Fac ", 17, NO_SLOT, applyLfoShape},
+    {"LRt ", &lfoRate, 1024, 1, 4, CURVE_LINEAR, FORMAT_NUMBER, NULL, 18, NO_SLOT, applyLfoRate},
+    {"LRng", &lfoLowRange, 1, 0, 1, CURVE_STEPS, FORMAT_LIST, "Hi  Low ", 19, NO_SLOT, NULL},
+    {"LTrg", &retrigger, 1, 0, 1, CURVE_STEPS, FORMAT_LIST, "Off On  ", 20, NO_SLOT, NULL},
+    {"LO1 ", &lfoOsc1DetuneFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 21, NO_SLOT, NULL},
+    {"LO2 ", &lfoOsc2DetuneFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 22, NO_SLOT, NULL},
+    {"LOc1", &osc1OctaveMod, 0, 3, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, 23, NO_SLOT, NULL},
+    {"LOc2", &osc2OctaveMod, 0, 3, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, 24, NO_SLOT, NULL},
+    {"LCut", &lfoAmount, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 25, NO_SLOT, NULL},
+    {"LAmp", &lfoAmpFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 26, NO_SLOT, NULL},
+    {"LPW ", &lfoPwFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 27, NO_SLOT, NULL},
+    {"EO1 ", &envOsc1PitchFactor, -1023, 1023, 4, CURVE_CENTER, FORMAT_SIXTEENTH, NULL, 28, NO_SLOT, NULL},
+    {"EO2 ", &envOsc2PitchFactor, -1023, 1023, 4, CURVE_CENTER, FORMAT_SIXTEENTH, NULL, 29, NO_SLOT, NULL},
+    {"ECut", &envFilterCutoffFactor, -1023, 1023, 4, CURVE_CENTER, FORMAT_SIXTEENTH, NULL, 30, NO_SLOT, NULL},
+    {"ELRt", &envLfoRate, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 31, NO_SLOT, NULL},
+    {"Shp ", &shaperType, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "Off 1   2   ", 32, NO_SLOT, createWaveShaper},
+    {"ShA1", &shaperType1PotVal, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 33, NO_SLOT, applyShaperAmount},
+    {"ShA2", &waveShapeAmount2, 1, 10, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 34, NO_SLOT, createWaveShaper},
+    {"Gain", &gainAmountPotVal, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 35, NO_SLOT, applyGain},
+    {"Bit ", &bitMuncher, 0, 11, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, 36, NO_SLOT, NULL},
+    {"Por ", &portamento, 0, 255, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 37, NO_SLOT, NULL},
+    {"Mon ", &monoMode, 0, 3, 1, CURVE_STEPS, FORMAT_LIST, "Off  Hi Low Lst ", 38, NO_SLOT, clearCurrentNotes},
+    {"Uni ", &unison, 0, 3, 1, CURVE_STEPS, FORMAT_LIST, "Off 2Vc 3Vc 4Vc ", 39, NO_SLOT, NULL},
+    {"Spr ", &uniSpread, 10000, 60000, 200, CURVE_LINEAR, FORMAT_SCALED, NULL, 40, NO_SLOT, NULL},
+    {"VO1 ", &velOsc1DetuneFactor, -1023, 1023, 8, CURVE_LINEAR, FORMAT_SIXTEENTH, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"VO2 ", &velOsc2DetuneFactor, -1023, 1023, 8, CURVE_LINEAR, FORMAT_SIXTEENTH, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"VCut", &velCutoffFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"VAmp", &velAmpFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"VPW ", &velPwFactor, 0, (WAVE_SAMPLES / 2) - 10, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"VLRt", &velLfoRateFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"Arp ", &arp, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Off On  ", NO_SLOT, NO_SLOT, applyArp},
+    {"ADiv", &arpDivSelection, 0, 6, 1, CURVE_STEPS, FORMAT_LIST, " 4   4t  8   8t 16  16t 32  ", NO_SLOT, NO_SLOT, NULL},
+    {"ADur", &arpNoteDur, 2, 95, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"BPM ", &bpm, 20, 320, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, setBpm},
+    {"ADir", &arpForward, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Rev Fwd ", NO_SLOT, NO_SLOT, sortArp},
+    {"ATyp", &arpIncrement, 0, 4, 1, CURVE_STEPS, FORMAT_LIST, "Rnd 1St 2St 3St 2B1 ", NO_SLOT, NO_SLOT, NULL},
+    {"AOct", &arpOctaves, 1, 4, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"MOut", &midiOut, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "No  Yes ", NO_SLOT, 0, NULL},
+    {"MChn", &midiChannel, 1, 16, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, NO_SLOT, 2, NULL},
+    {"Thru", &midiThruType, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "Off All Clk ", NO_SLOT, 3, checkThru},
+    {"Sync", &midiSync, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "NoneMst Slv ", NO_SLOT, 4, setSyncType},
+    {"KOut", &keysOut, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "No  Yes ", NO_SLOT, 5, NULL},
+    {"KVel", &keyVelocity, 0, 127, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, 6, NULL},
+    {"TOut", &midiTriggerOut, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "No  Yes ", NO_SLOT, 9, NULL},
+    {"TChn", &midiTriggerChannel, 1, 16, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, NO_SLOT, 10, NULL},
+    {"Vol ", &volume, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, NO_SLOT, NO_SLOT, NULL}, // stored by hand, see saveSettings()
+    {"CGld", &seqCCGlide, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Off On  ", NO_SLOT, 7, NULL},
+    {"CRte", &seqCCRoute, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Out Both", NO_SLOT, 8, NULL},
+    {"Bend", &bendRange, 0, 24, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, 1, NULL},
+    {"SDIO", &sdBlockIO, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "FileBlk ", NO_SLOT, 24, NULL},
+    {"Slot", &sdSlotStore, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Off On  ", NO_SLOT, 25, applySlotStore},
+    {"O1Fc", &osc1Factory, 0, FACTORY_WAVES - 1, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 46, NO_SLOT, applyOsc1Wave},
+    {"O2Fc", &osc2Factory, 0, FACTORY_WAVES - 1, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 47, NO_SLOT, applyOsc2Wave},
+    {"LFac", &lfoFactory, 0, FACTORY_WAVES - 1, 1, CURVE_LINEAR, FORMAT_NUMBER, NULL, 48, NO_SLOT, applyLfoShape},
+    {"WPos", &wavetablePosition, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 49, NO_SLOT, NULL},
+    {"WLfo", &wavetableLfoFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 50, NO_SLOT, NULL},
+    {"WEnv", &wavetableEnvFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 51, NO_SLOT, NULL},
+    {"WVel", &wavetableVelFactor, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, 52, NO_SLOT, NULL},
+    {"Chg ", &patchHandover, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "MuteNoteFade", NO_SLOT, 26, NULL},
+    {"Fade", &patchFadeTime, 0, 990, 10, CURVE_LINEAR, FORMAT_NUMBER, NULL, NO_SLOT, 27, NULL},
+    {"MphA", &morphFavourite[0], 1, FLASH_FAVOURITES, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"MphB", &morphFavourite[1], 1, FLASH_FAVOURITES, 1, CURVE_STEPS, FORMAT_NUMBER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"Mph ", &morphAmount, 0, 1023, 4, CURVE_LINEAR, FORMAT_QUARTER, NULL, NO_SLOT, NO_SLOT, NULL},
+    {"Grp ", &snapshotGroup, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "1-8 9-16", NO_SLOT, NO_SLOT, NULL},
+    {"Sync", &snapshotSync, 0, 1, 1, CURVE_STEPS, FORMAT_LIST, "Off Flsh", NO_SLOT, 28, NULL},
+    {"Src ", &source, 0, 2, 1, CURVE_STEPS, FORMAT_LIST, "LFO Env Vel ", NO_SLOT, NO_SLOT, applyModSource},
+    {"Dst ", &destination, 0, 6, 1, CURVE_STEPS, FORMAT_LIST, "Os1 Os2 Oc1 Oc2 Cut Amp PWi ", NO_SLOT, NO_SLOT, NULL},
+    {"Dst ", &destination, 7, 10, 1, CURVE_STEPS, FORMAT_LIST, "Os1 Os2 Cut LRt ", NO_SLOT, NO_SLOT, NULL},
+    {"Dst ", &destination, 11, 16, 1, CURVE_STEPS, FORMAT_LIST, "Os1 Os2 Cut Amp PWi LRt ", NO_SLOT, NO_SLOT, NULL},
+};
+
+// the pages that are nothing more than 4 parameters on 4 pots
+constexpr paramPage paramPages[] = {
+    {10, "Os1 Oct Lvl Det ", {P_OSC1_WAVE, P_OSC1_OCTAVE, P_OSC1_VOLUME, P_OSC1_DETUNE}, showOsc1Extra},
+    {20, "Os2 Oct Lvl Det ", {P_OSC2_WAVE, P_OSC2_OCTAVE, P_OSC2_VOLUME, P_OSC2_DETUNE}, showOsc2Extra},
+    {30, "Cut Res Typ Byp ", {P_CUTOFF, P_RESONANCE, P_FILTER_TYPE, P_FILTER_BYPASS}, NULL},
+    {40, "Att Dec Sus Rel ", {P_ATTACK, P_DECAY, P_SUSTAIN, P_RELEASE}, NULL},
+    {100, "Arp Div Dur BPM ", {P_ARP, P_ARP_DIV, P_ARP_DUR, P_BPM}, NULL},
+    {110, "Dir Typ Oct     ", {P_ARP_DIR, P_ARP_TYPE, P_ARP_OCTAVES, NO_PARAM}, NULL},
+    {300, "Out Chn Thr Sync", {P_MIDI_OUT, P_MIDI_CHANNEL, P_MIDI_THRU, P_MIDI_SYNC}, NULL},
+    {310, "Out Vel Bnd     ", {P_KEYS_OUT, P_KEY_VELOCITY, P_BEND_RANGE, NO_PARAM}, NULL},
+    {330, "Vol Chg Fade    ", {P_VOLUME, P_HANDOVER, P_FADE_TIME, NO_PARAM}, NULL},
+    {13, "Fac             ", {P_OSC1_FACTORY, NO_PARAM, NO_PARAM, NO_PARAM}, showFactoryName},
+    {23, "Fac             ", {P_OSC2_FACTORY, NO_PARAM, NO_PARAM, NO_PARAM}, showFactoryName},
+    {52, "Fac             ", {P_LFO_FACTORY, NO_PARAM, NO_PARAM, NO_PARAM}, showFactoryName},
+    {14, "Pos LFO Env Vel ", {P_WAVETABLE_POSITION, P_WAVETABLE_LFO, P_WAVETABLE_ENV, P_WAVETABLE_VEL}, NULL},
+    {24, "Pos LFO Env Vel ", {P_WAVETABLE_POSITION, P_WAVETABLE_LFO, P_WAVETABLE_ENV, P_WAVETABLE_VEL}, NULL},
+    {75, "A   B   Mix     ", {P_MORPH_A, P_MORPH_B, P_MORPH, NO_PARAM}, showMorphExtra},
+    {76, "Grp Syn Stored  ", {P_SNAPSHOT_GROUP, P_SNAPSHOT_SYNC, NO_PARAM, NO_PARAM}, showSnapshotExtra},
+    {60, "Src Dst Amt     ", {P_MOD_SOURCE, NO_PARAM, NO_PARAM, NO_PARAM}, NULL, selectModParam},
+    {65, "Shp Amt Bit Gain", {P_SHAPER_TYPE, NO_PARAM, P_BIT_MUNCHER, P_GAIN}, NULL, selectShaperParam},
+    {68, "Mon Uni Spr Por ", {P_MONO_MODE, P_UNISON, P_UNI_SPREAD, P_PORTAMENTO}, showMonoExtra, selectMonoParam},
+};
+#define PARAM_PAGES (sizeof(paramPages) / sizeof(paramPage))
+
+void applyOsc1Wave()
+{
+  setOsc1WaveType(osc1WaveType);
+}
+
+void applyOsc2Wave()
+{
+  setOsc2WaveType(osc2WaveType);
+}
+
+void applyPulseWidth()
+{
+  pulseWidth = uiPulseWidth;
+}
+
+void applyResonance()
+{
+  setFilterResonance(filterResonance);
+}
+
+void applyFilterType()
+{
+  setFilterType(filterType);
+}
+
+void applyLfoShape()
+{
+  setLfoShape(lfoShape);
+}
+
+void applyLfoRate()
+{
+  userLfoRate = lfoRate;
+  velLfoRate = lfoRate;
+}
+
+void applyModSource() // each source starts on its first destination
+{
+  const byte first[3] = {0, 7, 11};
+  destination = first[source];
+}
+
+byte selectModParam(byte pot, byte listed) // the destinations and the amount follow the source
+{
+  const byte destinations[3] = {P_MOD_DEST_LFO, P_MOD_DEST_ENV, P_MOD_DEST_VEL};
+  const byte amounts[17] = {P_LFO_OSC1, P_LFO_OSC2, P_LFO_OCT1, P_LFO_OCT2, P_LFO_CUTOFF, P_LFO_AMP, P_LFO_PW,
+                            P_ENV_OSC1, P_ENV_OSC2, P_ENV_CUTOFF, P_ENV_LFO_RATE,
+                            P_VEL_OSC1, P_VEL_OSC2, P_VEL_CUTOFF, P_VEL_AMP, P_VEL_PW, P_VEL_LFO_RATE};
+  if (pot == 1)
+    return destinations[source];
+  if (pot == 2)
+    return amounts[destination];
+  return listed;
+}
+
+byte selectShaperParam(byte pot, byte listed) // each shaper type has its own amount
+{
+  if (pot == 1)
+    return (shaperType == 1) ? P_SHAPER_AMOUNT : (shaperType == 2) ? P_SHAPER_AMOUNT2 : NA_PARAM;
+  return listed;
+}
+
+byte selectMonoParam(byte pot, byte listed) // unison and its spread only apply in mono mode
+{
+  if ((pot == 1 && !monoMode) || (pot == 2 && (!monoMode || !unison)))
+    return NA_PARAM;
+  return listed;
+}
+
+void showMonoExtra()
+{
+  if (portamento == 0)
+  {
+    lcd.setCursor(12, 1);
+    lcd.print("Off ");
+  }
+}
+
+void applyShaperAmount()
+{
+  float tmp = (float)shaperType1PotVal / 1024;
+  waveShapeAmount = tmp;
+  createWaveShaper();
+}
+
+void applyGain()
+{
+  float tmp = (float)gainAmountPotVal / 1024;
+  tmp += 1.0;
+  gainAmount = tmp;
+  createGainTable();
+}
+
+void applyArp()
+{
+  if (!arp)
+    clearHeld();
+}
+
+void showOsc1Extra()
+{
+  if (osc1WaveType == 3 || osc1WaveType == 4 || osc1WaveType >= 8) // Squ, Us1, Fac and Wtb have a sub page
+    arrow(3, 1);
+}
+
+void showOsc2Extra()
+{
+  if (osc2WaveType == 3 || osc2WaveType == 5 || osc2WaveType >= 8) // Squ, Us2, Fac and Wtb have a sub page
+    arrow(3, 1);
+}
+
+void showFactoryName()
+{
+  int choice = (menu == 13) ? osc1Factory : (menu == 23) ? osc2Factory : lfoFactory;
+  lcd.setCursor(4, 0);
+  lcd.print("Factory wave");
+  lcd.setCursor(4, 1);
+  lcd.print(factoryWaveNames[choice]);
+  for (byte i = strlen(factoryWaveNames[choice]); i < 12; i++)
+    lcd.print(" ");
+}
+
+const paramPage *findParamPage()
+{
+  if (menu != currentParamMenu) // only search when the menu has changed
+  {
+    currentParamMenu = menu;
+    currentParamPage = NULL;
+    for (byte i = 0; i < PARAM_PAGES; i++)
+    {
+      if (paramPages[i].menu == menu)
+        currentParamPage = &paramPages[i];
+    }
+  }
+  return currentParamPage;
+}
+
+int paramFromPot(byte id, int potValue) // potValue is 12 bits
+{
+  const paramDescriptor *p = &params[id];
+  int range = p->high - p->low;
+  switch (p->curve)
+  {
+  case CURVE_STEPS:
+  {
+    int steps = abs(range) + 1;
+    int step = constrain((potValue * steps) >> 12, 0, steps - 1);
+    return (range >= 0) ? p->low + step : p->low - step;
+  }
+
+  case CURVE_CENTER:
+    if (abs(potValue - 2048) < 40) // snap to center
+      return p->low + range / 2;
+    return p->low + (int)(((int64_t)range * potValue) / 4095);
+
+  case CURVE_CUTOFF:
+    return constrain(pow(potValue / 160.0, 1.71), 0, 255); // (base, exponent)
+
+  default: // CURVE_LINEAR
+    return p->low + (int)(((int64_t)range * potValue + 2047) / 4095);
+  }
+}
+
+void applyParam(byte id)
+{
+  if (params[id].apply != NULL)
+    params[id].apply();
+}
+
+boolean setParam(byte id, int value) // returns true if the value changed
+{
+  const paramDescriptor *p = &params[id];
+  value = constrain(value, min(p->low, p->high), max(p->low, p->high));
+  if (*p->value == value)
+    return false;
+  *p->value = value;
+  applyParam(id);
+  return true;
+}
+
+boolean paramGlides(byte id) // a parameter that can pass through the values between two settings, the rest can only switch
+{
+  const paramDescriptor *p = &params[id];
+  return (p->curve != CURVE_STEPS && abs(p->high - p->low) >= 255); // octaves, lists and wave numbers would jump
+}
+
+void blendParams(const int *from, const int *to, int32_t amount) // amount 0 - 1023 of the way from one patch to the other
+{
+  // only the parameters that differ are set, and setParam only runs the setters of values that changed
+  for (byte i = 0; i < PARAMS; i++)
+  {
+    byte slot = params[i].patchSlot;
+    if (slot == NO_SLOT || from[slot] == to[slot])
+      continue;
+    if (paramGlides(i))
+      setParam(i, from[slot] + (((to[slot] - from[slot]) * amount) >> 10));
+    else
+      setParam(i, (amount < 512) ? from[slot] : to[slot]);
+  }
+}
+
+byte paramByValue(int *value) // find a parameter by its variable, NO_PARAM if it isn't in the registry
+{
+  for (byte i = 0; i < PARAMS; i++)
+  {
+    if (params[i].value == value)
+      return i;
+  }
+  return NO_PARAM;
+}
+
+byte pageParam(const paramPage *page, byte pot)
+{
+  if (page->select != NULL)
+    return page->select(pot, page->param[pot]);
+  return page->param[pot];
+}
+
+boolean adjustParamPage() // returns false if the current menu isn't a parameter page
+{
+  static byte lastId[4] = {NO_PARAM, NO_PARAM, NO_PARAM, NO_PARAM};
+  const paramPage *page = findParamPage();
+  if (page == NULL)
+    return false;
+
+  for (byte i = 0; i < 4; i++)
+  {
+    byte id = pageParam(page, i);
+    if (id != lastId[i]) // a pot that now adjusts something else waits to be moved again
+    {
+      lastId[i] = id;
+      lockPot(i);
+      valueChange = true;
     }
-    if (inPulseCounter > 4)
+    if (id != NO_PARAM && id != NA_PARAM && unlockedPot(i))
     {
-      int totalBpm = 0;
-      for (byte i = 0; i < 24; i++)
-        totalBpm += tmpBpm[i];
-
-      if (bpm != totalBpm / 24 + 1)
-      {
-        bpm = totalBpm / 24 + 1; // +1 here because for some reason the BPM reading is off by one
-        setBpm();
-        if (menu == 230)
-          showValue(5, 1, bpm);
-      }
+      const paramDescriptor *p = &params[id];
+      assignIncrementButtons(p->value, min(p->low, p->high), max(p->low, p->high), p->increment);
+      setParam(id, paramFromPot(id, potHiRes[i]));
     }
-    inPulseCounter++;
-    lastClockInMicros = clockInMicros;
   }
+  return true;
 }
 
-void HandleStart(void)
+void showParam(byte col, byte id)
 {
-  if (syncIn)
+  const paramDescriptor *p = &params[id];
+  switch (p->format)
   {
-    seqRunning = true;
-    seqStep = 0; // rewind the sequence
-    inPulseCounter = 0;
-    pulseCounter = 0;
-    eighthCounter = 0;
-    longStep = true;
-    cueNextSeq();
-    seqJustStarted = true;
+  case FORMAT_QUARTER:
+    showValue(col, 1, *p->value >> 2);
+    break;
+
+  case FORMAT_LIST:
+  {
+    const char *label = p->names + (*p->value - min(p->low, p->high)) * 4;
+    lcd.setCursor(col, 1);
+    for (byte i = 0; i < 4; i++)
+      lcd.print(label[i]);
+  }
+  break;
+
+  case FORMAT_CENTS:
+    showValue(col, 1, (*p->value * 100) / PITCH_SEMITONE);
+    break;
+
+  case FORMAT_SIXTEENTH:
+    showValue(col, 1, *p->value >> 4);
+    break;
+
+  case FORMAT_SCALED:
+    showValue(col, 1, map(*p->value, p->low, p->high, 0, 255));
+    break;
+
+  default: // FORMAT_NUMBER
+    showValue(col, 1, *p->value);
+    break;
   }
 }
 
-void HandleStop(void)
+boolean showParamPage() // returns false if the current menu isn't a parameter page
 {
-  if (syncIn)
-  {
-    seqRunning = false;
-    seqSendMidiNoteOffs = true;
-    seqStep = 0; // rewind the sequence
-    pulseCounter = 0;
-    eighthCounter = 0;
-    longStep = true;
+  const paramPage *page = findParamPage();
+  if (page == NULL)
+    return false;
 
-    noteRelease();
+  lcd.setCursor(0, 0);
+  lcd.print(page->header);
+  for (byte i = 0; i < 4; i++)
+  {
+    byte id = pageParam(page, i);
+    lcd.setCursor(i * 4, 1);
+    if (id == NO_PARAM)
+      lcd.print("    ");
+    else if (id == NA_PARAM)
+      lcd.print("n/a ");
+    else
+      showParam(i * 4, id);
   }
+  if (page->extra != NULL)
+    page->extra();
+  return true;
 }
 
-void sendMidi()
+void loadParams(int *buffer, boolean settings, boolean force) // unpack a patch or settings buffer
 {
-  if (midiOut)
+  // set all the values first, then run each setter once - several parameters share expensive ones like createWaveShaper()
+  boolean changed[PARAMS];
+  for (byte i = 0; i < PARAMS; i++)
   {
-    // ARPEGGIATOR
-    if (arpSendMidiNoteOn)
+    byte slot = settings ? params[i].settingsSlot : params[i].patchSlot;
+    changed[i] = false;
+    if (slot != NO_SLOT)
     {
-      if (arpMidiOut != 255)
-        midiA.sendNoteOff(arpMidiOut, 127, midiChannel);
-      arpMidiOut = sortedArpList[arpPosition] + (arpOctaveCounter * 12) + 60;
-      midiA.sendNoteOn(arpMidiOut, 127, midiChannel);
-      arpSendMidiNoteOn = false;
-    }
-
-    else if (arpSendMidiNoteOff)
-    {
-      midiA.sendNoteOff(arpMidiOut, 127, midiChannel);
-      arpMidiOut = 255;
-      arpSendMidiNoteOff = false;
-    }
-
-    // SEQUENCER
-    else if (seqSendMidiNoteOns)
-    {
-      for (byte i = 0; i < 4; i++)
-      {
-        if (seqMidiOff[i] == 255 && seqMidiOn[i] != 255)
-        {
-          midiA.sendNoteOn(seqMidiOn[i] + 60, outVelocity, midiChannel);
-          seqMidiOff[i] = seqMidiOn[i];
-        }
-        else if (seqMidiOn[i] != 255)
-        {
-          midiA.sendNoteOff(seqMidiOff[i] + 60, 127, midiChannel);
-          midiA.sendNoteOn(seqMidiOn[i] + 60, outVelocity, midiChannel);
-          seqMidiOff[i] = seqMidiOn[i];
-        }
-      }
-      seqSendMidiNoteOns = false;
+      const paramDescriptor *p = &params[i];
+      int value = constrain(buffer[slot], min(p->low, p->high), max(p->low, p->high));
+      changed[i] = force || (*p->value != value);
+      *p->value = value;
     }
-
-    else if (seqSendMidiNoteOffs)
+  }
+  for (byte i = 0; i < PARAMS; i++)
+  {
+    if (changed[i] && params[i].apply != NULL)
     {
-      for (byte i = 0; i < 4; i++)
+      boolean done = false;
+      for (byte j = 0; j < i; j++)
       {
-        if (seqMidiOff[i] != 255)
-        {
-          midiA.sendNoteOff(seqMidiOff[i] + 60, 127, midiChannel);
-          seqMidiOff[i] = 255;
-        }
+        if (changed[j] && params[j].apply == params[i].apply)
+          done = true;
       }
-      seqSendMidiNoteOffs = false;
+      if (!done)
+        params[i].apply();
     }
   }
 }
 
-void checkForClock()
+void saveParams(int *buffer, boolean settings) // pack a patch or settings buffer
 {
-  if (receivingClock)
+  for (byte i = 0; i < PARAMS; i++)
   {
-    if ((millis() - lastClock) > 300)
-      receivingClock = false;
+    byte slot = settings ? params[i].settingsSlot : params[i].patchSlot;
+    if (slot != NO_SLOT)
+      buffer[slot] = *params[i].value;
   }
 }
 
-void checkThru()
+// POTS.ino
+void initPots() // put the ADC in free-running mode over the pot channels and let the PDC collect the results
 {
-  if (midiThruType == 0)
-    midiA.turnThruOff();
-  else if (midiThruType == 1)
-    midiA.turnThruOn(midi::Full);
-  else if (midiThruType == 2)
-    midiA.turnThruOn(midi::DifferentChannel); // in conjunction with MIDI_CHANNEL_OMNI, this only allows system messages though like clock, stop, start
-}
+  uint32_t channels = 0;
 
-void setSyncType()
-{
-  switch (midiSync)
+  for (byte i = 0; i < 16; i++)
+    potChannel[i] = 255;
+  for (byte i = 0; i < 5; i++)
   {
-  case 0:
-    syncIn = false;
-    midiClockOut = 0;
-    break;
-  case 1:
-    syncIn = false;
-    midiClockOut = 1;
-    break;
-  case 2:
-    syncIn = true;
-    midiClockOut = 0;
-    break;
-  }
+    byte ch = g_APinDescription[A0 + i].ulADCChannelNumber;
+    potChannel[ch] = i;
+    channels |= (1 << ch);
+  }
+
+  pmc_enable_periph_clk(ID_ADC);
+  ADC->ADC_CR = ADC_CR_SWRST;
+  // the ADC clock is MCK / ((PRESCAL + 1) * 2) and has to stay within 1 - 20MHz: 84MHz / 42 = 2MHz
+  // the 10k pots get their settling time from the longest tracking time, 16 clocks = 8us, instead of from a slow clock
+  // SETTLING only applies when the analog settings change between channels, which they don't here
+  // about 36 clocks per conversion, so each pot is read around 11kHz - getPots() only ever averages the newest buffer
+  ADC->ADC_MR = ADC_MR_FREERUN_ON | ADC_MR_PRESCAL(20) | ADC_MR_STARTUP_SUT96 | ADC_MR_SETTLING_AST17 | ADC_MR_TRACKTIM(15) | ADC_MR_TRANSFER(2);
+  ADC->ADC_EMR = ADC_EMR_TAG; // tag each result with its channel number, so we never lose track of which pot it belongs to
+  ADC->ADC_CHER = channels;
+
+  potDmaHead = 0;
+  potDmaReady = POT_DMA_BUFFERS;
+  ADC->ADC_RPR = (uint32_t)potDmaBuffer[0];
+  ADC->ADC_RCR = POT_OVERSAMPLE * 5;
+  ADC->ADC_RNPR = (uint32_t)potDmaBuffer[1];
+  ADC->ADC_RNCR = POT_OVERSAMPLE * 5;
+  ADC->ADC_PTCR = ADC_PTCR_RXTEN;
+
+  ADC->ADC_IER = ADC_IER_ENDRX;
+  NVIC_SetPriority(ADC_IRQn, 15); // lowest priority - the audio must never wait for the pots
+  NVIC_EnableIRQ(ADC_IRQn);
+  ADC->ADC_CR = ADC_CR_START;
+
+  while (potDmaReady == POT_DMA_BUFFERS) // wait for the first full buffer (a few ms)
+    ;
 }
 
-void clearCurrentNotes()
+void ADC_Handler() // the PDC filled a buffer and moved on to the next one
 {
-  for (byte i = 0; i < 10; i++)
-    currentNotes[i] = 255;
-
-  highestNote = 255;
-  lowestNote = 255;
-  lastNote = 255;
-  previousNote = 255;
+  if (ADC->ADC_ISR & ADC_ISR_ENDRX)
+  {
+    potDmaReady = potDmaHead;
+    potDmaHead = (potDmaHead + 1) % POT_DMA_BUFFERS;
+    // queue up the buffer after the one now filling - writing RNCR also clears ENDRX
+    ADC->ADC_RNPR = (uint32_t)potDmaBuffer[(potDmaHead + 1) % POT_DMA_BUFFERS];
+    ADC->ADC_RNCR = POT_OVERSAMPLE * 5;
+  }
 }
 
-// POTS.ino
 void getPots() // read the current pot values
 {
+  // average the last completed buffer - no conversions to wait for here
+  uint32_t sum[5] = {0, 0, 0, 0, 0};
+  uint16_t *buffer = potDmaBuffer[potDmaReady];
+  for (byte i = 0; i < POT_OVERSAMPLE * 5; i++)
+  {
+    byte p = potChannel[buffer[i] >> 12];
+    if (p < 5)
+      sum[p] += buffer[i] & 0x0FFF;
+  }
+  static boolean primed = false;
+  unsigned long now = millis();
+  potChanged = 0;
   for (byte i = 0; i < 5; i++)
   {
-    pot[i] = analogRead(i);
+    int raw = (sum[i] / POT_OVERSAMPLE) << 4;
+    if (!primed)
+      potFilter[i] = raw;
+    // one-pole filter - follow big moves quickly, smooth out small jitter hard
+    int diff = raw - potFilter[i];
+    potFilter[i] += diff >> ((abs(diff) > (64 << 4)) ? 1 : 3);
+
+    // adaptive hysteresis - a pot that has been resting for a while needs a bigger push before it counts as moved
+    int value = potFilter[i] >> 4;
+    int threshold = ((now - potMoveTime[i]) > 250) ? 6 : 2;
+    boolean atEnd = (value <= threshold || value >= 4095 - threshold) && value != potHiRes[i]; // always let the pot reach its ends
+    if (!primed || abs(value - potHiRes[i]) > threshold || atEnd)
+    {
+      potHiRes[i] = value;
+      pot[i] = value >> 2; // the menus work in 10 bits
+      potMoveTime[i] = now;
+      if (primed)
+        potChanged |= (1 << i);
+    }
   }
+  primed = true;
 
   // see if it's time to lock the pots
   if (lockTimer != 0 && (millis() - lockTimer) > 500) // the pots lock after 500ms
@@ -2370,22 +3450,21 @@ void lockPot(byte Pot) // values of 0 - 4 for each pot and 5 for all
 
 boolean unlockedPot(byte Pot) // check if a pot is locked or not
 {
+  // getPots() has already filtered out the jitter, so we only act on pots that really moved this pass
+  if (!(potChanged & (1 << Pot)))
+    return false;
+
   if (potLock[Pot] == 9999)
   {
-    if (abs(pot[Pot] - lastPotValue[Pot]) > 10) // the threshold value is 10
-    {
-      lastPotValue[Pot] = pot[Pot];
-      lockTimer = millis();
-      if (Pot < 4)
-        valueChange = true;
-    }
+    lockTimer = millis();
+    if (Pot < 4)
+      valueChange = true;
     return true;
   }
   else if (abs(potLock[Pot] - pot[Pot]) > 10) // the threshold value is 10
   {
     potLock[Pot] = 9999;
     lockTimer = millis();
-    lastPotValue[Pot] = pot[Pot];
     return true;
   }
   else
@@ -2394,6 +3473,9 @@ boolean unlockedPot(byte Pot) // check if a pot is locked or not
 
 void adjustValues()
 {
+  if (adjustParamPage()) // the simple pages are all handled by the parameter registry
+    return;
+
   switch (menu)
   {
   case 0: // main
@@ -2502,61 +3584,6 @@ void adjustValues()
       break;
     }
     break;
-  case 10: // OSC1
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&osc1WaveType, 0, 7, 1);
-      if (pot[0] < (1023 / waveshapes))
-        setOsc1WaveType(0); // sine
-      else if (pot[0] < (1023 / waveshapes) * 2)
-        setOsc1WaveType(1); // triangle
-      else if (pot[0] < (1023 / waveshapes) * 3)
-        setOsc1WaveType(2); // saw
-      else if (pot[0] < (1023 / waveshapes) * 4)
-        setOsc1WaveType(3); // square
-      else if (pot[0] < (1023 / waveshapes) * 5)
-        setOsc1WaveType(4); // user1
-      else if (pot[0] < (1023 / waveshapes) * 6)
-        setOsc1WaveType(5); // user2
-      else if (pot[0] < (1023 / waveshapes) * 7)
-        setOsc1WaveType(6); // user3
-      else
-        setOsc1WaveType(7); // noise
-    }
-
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&osc1Octave, 1, 9, 1);
-      osc1Octave = map(pot[1], 0, 1023, 1, 9);
-      if (osc1Octave != lastOsc1Octave)
-      {
-        lastOsc1Octave = osc1Octave;
-        assignVoices();
-      }
-    }
-
-    if (unlockedPot(2))
-    {
-      if (osc1Volume != pot[2])
-      {
-        osc1Volume = pot[2];
-        createOsc1Volume();
-      }
-      assignIncrementButtons(&osc1Volume, 0, 1023, 4);
-    }
-
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&osc1Detune, -24, +24, 1);
-      osc1Detune = map(pot[3], 0, 1023, -24, 24);
-      if (osc1Detune != lastOsc1Detune)
-      {
-        lastOsc1Detune = osc1Detune;
-        assignVoices();
-      }
-    }
-    break;
-
   case 11: // OSCILLATORS - set user wave shapes
     if (unlockedPot(3) && dirCount != 0)
     {
@@ -2579,64 +3606,6 @@ void adjustValues()
     }
     break;
 
-  case 20: // OSC2
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&osc2WaveType, 0, 7, 1);
-      if (pot[0] < (1023 / waveshapes))
-        setOsc2WaveType(0); // sine
-      else if (pot[0] < (1023 / waveshapes) * 2)
-        setOsc2WaveType(1); // triangle
-      else if (pot[0] < (1023 / waveshapes) * 3)
-        setOsc2WaveType(2); // saw
-      else if (pot[0] < (1023 / waveshapes) * 4)
-        setOsc2WaveType(3); // square
-      else if (pot[0] < (1023 / waveshapes) * 5)
-        setOsc2WaveType(4); // user1
-      else if (pot[0] < (1023 / waveshapes) * 6)
-        setOsc2WaveType(5); // user2
-      else if (pot[0] < (1023 / waveshapes) * 7)
-        setOsc2WaveType(6); // user3
-      else
-        setOsc2WaveType(7); // noise
-    }
-
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&osc2Octave, 1, 9, 1);
-      osc2Octave = map(pot[1], 0, 1023, 1, 9);
-      if (osc2Octave != lastOsc2Octave)
-      {
-        lastOsc2Octave = osc2Octave;
-        assignVoices();
-      }
-    }
-
-    if (unlockedPot(2))
-    {
-      if (osc2Volume != pot[2])
-      {
-        osc2Volume = pot[2];
-        createOsc2Volume();
-      }
-      assignIncrementButtons(&osc2Volume, 0, 1023, 4);
-    }
-
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&osc2Detune, -512 << 11, 512 << 11, 2 << 11);
-      if (pot[3] > 502 && pot[3] < 522)
-        osc2Detune = 0;
-      else
-        osc2Detune = int(pot[3] - 512) << 11;
-      if (osc2Detune != lastOsc2Detune)
-      {
-        lastOsc2Detune = osc2Detune;
-        assignVoices();
-      }
-    }
-    break;
-
   case 21: // OSCILLATORS - set user wave shapes
     if (unlockedPot(3) && dirCount != 0)
     {
@@ -2645,142 +3614,30 @@ void adjustValues()
       if (dirChoice != lastDirChoice)
       {
         lastDirChoice = dirChoice;
-        sd.vwd()->rewind();
-        tempCount = 0;
-        waveshapeLoaded = false;
-      }
-    }
-    break;
-
-  case 22: // Squ: Pulse Width
-    if (unlockedPot(3))
-    {
-      //valueChange = true;
-      uiPulseWidth = map(pot[3], 0, 1023, ((WAVE_SAMPLES / 2) - 15) * -1, ((WAVE_SAMPLES / 2) - 15));
-    }
-    break;
-
-  case 30: // FILTER
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&filterCutoff, 0, 255, 1);
-      //valueChange = true;
-      float sensVar = (pot[0] >> 2) * 1.0;
-      filterCutoff = pow(sensVar / 10, 1.71); //(base, exponent)
-    }
-
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&filterResonance, 0, 255, 1);
-      filterResonance = pot[1] >> 2;
-      setFilterResonance(filterResonance);
-    }
-
-    if (unlockedPot(2))
-    {
-      assignIncrementButtons(&filterType, 0, 2, 1);
-      if (pot[2] < 341)
-        setFilterType(0);
-      else if (pot[2] < 682)
-        setFilterType(1);
-      else
-        setFilterType(2);
-    }
-
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&filterBypass, 0, 1, 1); // a toggle value
-      if (pot[3] < 512)
-        filterBypass = true;
-      else
-        filterBypass = false;
-    }
-    break;
-
-  case 40: // ENVELOPE
-    if (unlockedPot(0))
-    {
-      attackTime = constrain(pot[0], 1, 1023); // we don't want to be able to set 0
-      assignIncrementButtons(&attackTime, 1, 1023, 4);
-    }
-    if (unlockedPot(1))
-    {
-      decayTime = constrain(pot[1], 1, 1023); // we don't want to be able to set 0
-      assignIncrementButtons(&decayTime, 1, 1023, 4);
-    }
-    if (unlockedPot(2))
-    {
-      sustainLevel = pot[2];
-      assignIncrementButtons(&sustainLevel, 0, 1023, 4);
+        sd.vwd()->rewind();
+        tempCount = 0;
+        waveshapeLoaded = false;
+      }
     }
+    break;
+
+  case 22: // Squ: Pulse Width
     if (unlockedPot(3))
     {
-      releaseTime = constrain(pot[3], 1, 1023); // we don't want to be able to set 0
-      assignIncrementButtons(&releaseTime, 1, 1023, 4);
+      //valueChange = true;
+      uiPulseWidth = map(pot[3], 0, 1023, ((WAVE_SAMPLES / 2) - 15) * -1, ((WAVE_SAMPLES / 2) - 15));
     }
     break;
 
   case 50: // LFO
     if (unlockedPot(0))
     {
-      assignIncrementButtons(&lfoShape, 0, 6, 1);
-      if (pot[0] < (1023 / 7))
-      {
-        if (lfoShape != 0)
-        {
-          lfoShape = 0; // sine
-          setLfoShape(lfoShape);
-        }
-      }
-      else if (pot[0] < (1023 / 7) * 2)
-      {
-        if (lfoShape != 1)
-        {
-          lfoShape = 1; // triangle
-          setLfoShape(lfoShape);
-        }
-      }
-      else if (pot[0] < (1023 / 7) * 3)
-      {
-        if (lfoShape != 2)
-        {
-          lfoShape = 2; // saw
-          setLfoShape(lfoShape);
-        }
-      }
-      else if (pot[0] < (1023 / 7) * 4)
-      {
-        if (lfoShape != 3)
-        {
-          lfoShape = 3; // square
-          setLfoShape(lfoShape);
-        }
-      }
-      else if (pot[0] < (1023 / 7) * 5)
-      {
-        if (lfoShape != 4)
-        {
-          lfoShape = 4; // user1
-          setLfoShape(lfoShape);
-        }
-      }
-      else if (pot[0] < (1023 / 7) * 6)
-      {
-        if (lfoShape != 5)
-        {
-          lfoShape = 5; // user2
-          setLfoShape(lfoShape);
-        }
-      }
-      else
+      assignIncrementButtons(&lfoShape, 0, 7, 1);
+      byte shape = pot[0] >> 7; // 8 shapes: sine, triangle, saw, square, user1, user2, user3, factory
+      if (lfoShape != shape)
       {
-        if (lfoShape != 0)
-        {
-          {
-            lfoShape = 6; // user3
-            setLfoShape(lfoShape);
-          }
-        }
+        lfoShape = shape;
+        setLfoShape(lfoShape);
       }
     }
     if (unlockedPot(1))
@@ -2850,260 +3707,27 @@ void adjustValues()
     }
     break;
 
-  case 60: // MODULATION
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&source, 0, 2, 1);
-      source = map(pot[0], 0, 1023, 0, 2);
-    }
-
-    if (unlockedPot(1))
-    {
-      switch (source)
-      {
-      case 0: // SOURCE LFO
-        assignIncrementButtons(&destination, 0, 6, 1);
-        dest = 1023 / 7; // how many destinations are there
-        if (pot[1] < dest)
-          destination = 0;
-        else if (pot[1] < dest * 2)
-          destination = 1;
-        else if (pot[1] < dest * 3)
-          destination = 2;
-        else if (pot[1] < dest * 4)
-          destination = 3;
-        else if (pot[1] < dest * 5)
-          destination = 4;
-        else if (pot[1] < dest * 6)
-          destination = 5;
-        else
-          destination = 6;
-        break;
-
-      case 1: // SOURCE ENVELOPE
-        assignIncrementButtons(&destination, 7, 10, 1);
-        dest = 1023 / 4; // how many destinations are there
-        if (pot[1] < dest)
-          destination = 7;
-        else if (pot[1] < dest * 2)
-          destination = 8;
-        else if (pot[1] < dest * 3)
-          destination = 9;
-        else
-          destination = 10;
-        break;
-
-      case 2: // SOURCE VELOCITY
-        assignIncrementButtons(&destination, 11, 16, 1);
-        dest = 1023 / 6; // how many destinations are there
-        if (pot[1] < dest)
-          destination = 11;
-        else if (pot[1] < dest * 2)
-          destination = 12;
-        else if (pot[1] < dest * 3)
-          destination = 13;
-        else if (pot[1] < dest * 4)
-          destination = 14;
-        else if (pot[1] < dest * 5)
-          destination = 15;
-        else
-          destination = 16;
-        break;
-      }
-    }
-
-    if (unlockedPot(2))
-    {
-      switch (source)
-      {
-      case 0: // SOURCE LFO
-        switch (destination)
-        {
-        case 0:
-          assignIncrementButtons(&lfoOsc1DetuneFactor, 0, 1023, 4);
-          lfoOsc1DetuneFactor = pot[2];
-          break;
-        case 1:
-          assignIncrementButtons(&lfoOsc2DetuneFactor, 0, 1023, 4);
-          lfoOsc2DetuneFactor = pot[2];
-          break;
-        case 2:
-          assignIncrementButtons(&osc1OctaveMod, 0, 3, 1);
-          osc1OctaveMod = pot[2] >> 8;
-          break;
-        case 3:
-          assignIncrementButtons(&osc2OctaveMod, 0, 3, 1);
-          osc2OctaveMod = pot[2] >> 8;
-          break;
-        case 4:
-          assignIncrementButtons(&lfoAmount, 0, 1023, 4);
-          lfoAmount = pot[2];
-          break;
-        case 5:
-          assignIncrementButtons(&lfoAmpFactor, 0, 1023, 4);
-          lfoAmpFactor = pot[2];
-          break;
-        case 6:
-          assignIncrementButtons(&lfoPwFactor, 0, 1023, 4);
-          lfoPwFactor = pot[2];
-          break;
-        }
-        break;
-
-      case 1: // SOURCE ENVELOPE
-        switch (destination)
-        {
-        case 7:
-          assignIncrementButtons(&envOsc1PitchFactor, -1023, 1023, 4);
-          if (pot[2] > 502 && pot[2] < 522) // snap to center / 0
-            envOsc1PitchFactor = 0;
-          else
-            envOsc1PitchFactor = (pot[2] - 512) << 1; // - 1023 to 1023
-          break;
-        case 8:
-          assignIncrementButtons(&envOsc2PitchFactor, -1023, 1023, 4);
-          if (pot[2] > 502 && pot[2] < 522) // snap to center / 0
-            envOsc2PitchFactor = 0;
-          else
-            envOsc2PitchFactor = (pot[2] - 512) << 1; // - 1023 to 1023
-        case 9:                                       // FILTER CUTOFF
-          assignIncrementButtons(&envFilterCutoffFactor, -1023, 1023, 4);
-          if (pot[2] > 502 && pot[2] < 522) // snap to center / 0
-            envFilterCutoffFactor = 0;
-          else
-            envFilterCutoffFactor = (pot[2] - 512) << 1; // - 1023 to 1023
-          break;
-        case 10: // LFO RATE
-          assignIncrementButtons(&envLfoRate, 0, 1023, 4);
-          envLfoRate = pot[2];
-          break;
-        }
-        break;
-
-      case 2: // SOURCE VELOCITY
-        switch (destination)
-        {
-        case 11:
-          assignIncrementButtons(&velOsc1DetuneFactor, -1023, 1023, 8);
-          velOsc1DetuneFactor = map(pot[2], 0, 1023, -1023, 1023);
-          break;
-        case 12:
-          assignIncrementButtons(&velOsc2DetuneFactor, -1023, 1023, 8);
-          velOsc2DetuneFactor = map(pot[2], 0, 1023, -1023, 1023);
-          break;
-        case 13:
-          assignIncrementButtons(&velCutoffFactor, 0, 1023, 4);
-          velCutoffFactor = pot[2];
-          break;
-        case 14:
-          assignIncrementButtons(&velAmpFactor, 0, 1023, 4);
-          velAmpFactor = pot[2];
-          break;
-        case 15:
-          assignIncrementButtons(&velPwFactor, 0, (WAVE_SAMPLES / 2) - 10, 1);
-          velPwFactor = map(pot[2], 0, 1023, 0, (WAVE_SAMPLES / 2) - 10);
-          break;
-        case 16:
-          assignIncrementButtons(&velLfoRateFactor, 0, 1023, 4);
-          velLfoRateFactor = pot[2];
-          break;
-        }
-        break;
-      }
-    }
-    break;
-
-  case 65: // SHAPER & GAIN
+  case 69: // FAVOURITES
     if (unlockedPot(0))
     {
-      assignIncrementButtons(&shaperType, 0, 2, 1);
-      int items = 3;
-      if (shaperType != (pot[0] / ((1023 / items) + 1)))
+      assignIncrementButtons(&flashChoice, 0, FLASH_FAVOURITES - 1, 1);
+      int tmp = constrain(pot[0] / ((1023 / FLASH_FAVOURITES) + 1), 0, FLASH_FAVOURITES - 1);
+      if (flashChoice != tmp)
       {
-        shaperType = pot[0] / ((1023 / items) + 1);
-        createWaveShaper();
+        flashChoice = tmp;
+        valueChange = true;
       }
     }
     if (unlockedPot(1))
     {
-      if (shaperType == 1)
-      {
-        assignIncrementButtons(&shaperType1PotVal, 0, 1023, 4);
-        if (pot[1] != shaperType1PotVal)
-        {
-          shaperType1PotVal = pot[1];
-          float tmp = (float)shaperType1PotVal / 1024;
-          waveShapeAmount = tmp;
-          createWaveShaper();
-        }
-      }
-      else if (shaperType == 2)
-      {
-        assignIncrementButtons(&waveShapeAmount2, 1, 10, 1);
-        int tmp = map(pot[1], 0, 1023, 1, 10);
-        if (tmp != waveShapeAmount2)
-        {
-          waveShapeAmount2 = tmp;
-          createWaveShaper();
-        }
-      }
-    }
-
-    if (unlockedPot(2))
-    {
-      assignIncrementButtons(&bitMuncher, 0, 11, 1);
-      int values = 11;
-      if (bitMuncher != (pot[2] / ((1023 / values) + 1)))
-        bitMuncher = pot[2] / ((1023 / values) + 1);
-    }
-
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&gainAmountPotVal, 0, 1023, 4);
-      if (pot[3] != gainAmountPotVal)
-      {
-        gainAmountPotVal = pot[3];
-        float tmp = (float)gainAmountPotVal / 1024;
-        tmp += 1.0;
-        gainAmount = tmp;
-        createGainTable();
-      }
-    }
-    break;
-
-  case 68: // MONO & PORTA
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&monoMode, 0, 3, 1);
-      int values = 4;
-      byte tmp = constrain(pot[0] / ((1023 / values) + 1), 0, 3);
-      if (monoMode != tmp)
+      assignIncrementButtons(&flashAction, 0, 1, 1);
+      int tmp = (pot[1] < 512) ? 0 : 1;
+      if (flashAction != tmp)
       {
-        monoMode = tmp;
-        clearCurrentNotes(); // clears the currentNotes table and resets variables that keep track of incoming MIDI notes
+        flashAction = tmp;
+        valueChange = true;
       }
     }
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&unison, 0, 3, 1);
-      int values = 4;
-      byte tmp = constrain(pot[1] / ((1023 / values) + 1), 0, 3);
-      if (unison != tmp)
-        unison = tmp;
-    }
-    if (unlockedPot(2))
-    {
-      assignIncrementButtons(&uniSpread, 10000, 60000, 200);
-      int tmp = map(pot[2], 0, 1023, 10000, 60000);
-      if (uniSpread != tmp)
-        uniSpread = tmp;
-    }
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&portamento, 0, 255, 1);
-      if (portamento != constrain(pot[3] >> 2, 0, 255))
-        portamento = constrain(pot[3] >> 2, 0, 255);
-    }
     break;
 
   case 70: // LOAD SYNTH PATCH
@@ -3138,76 +3762,6 @@ void adjustValues()
     }
     break;
 
-  case 100:             // ARP SETTINGS 1
-    if (unlockedPot(0)) // arp on/off
-    {
-      assignIncrementButtons(&arp, 0, 1, 1);
-      if (pot[0] < 512)
-      {
-        if (arp == true)
-        {
-          arp = false;
-          clearHeld();
-        }
-      }
-      else
-        arp = true;
-    }
-    if (unlockedPot(1)) // time division
-    {
-      assignIncrementButtons(&arpDivSelection, 0, 6, 1);
-      arpDivSelection = map(pot[1], 0, 1023, 0, 6);
-    }
-    if (unlockedPot(2)) // step duration in pulses
-    {
-      assignIncrementButtons(&arpNoteDur, 2, 95, 1);
-      arpNoteDur = map(pot[2], 0, 1023, 2, 95);
-    }
-    if (unlockedPot(3)) // set the BPM
-    {
-      assignIncrementButtons(&bpm, 20, 320, 1);
-      bpm = map(pot[3], 0, 1023, 20, 320);
-      if (bpm != lastBpm)
-      {
-        lastBpm = bpm;
-        setBpm();
-      }
-    }
-    break;
-
-  case 110:             // ARP SETTINGS 2
-    if (unlockedPot(0)) // direction
-    {
-      assignIncrementButtons(&arpForward, 0, 1, 1);
-      if (pot[0] < 512)
-      {
-        if (arpForward != 0)
-        {
-          arpForward = 0;
-          sortArp();
-        }
-      }
-      else
-      {
-        if (arpForward != 1)
-        {
-          arpForward = 1;
-          sortArp();
-        }
-      }
-    }
-    if (unlockedPot(1)) // type
-    {
-      assignIncrementButtons(&arpIncrement, 0, 4, 1);
-      arpIncrement = map(pot[1], 0, 1023, 0, 4);
-    }
-    if (unlockedPot(2)) // octaves
-    {
-      assignIncrementButtons(&arpOctaves, 1, 4, 1);
-      arpOctaves = map(pot[2], 0, 1023, 1, 4);
-    }
-    break;
-
   case 200: // SEQUENCER TRIGGER
     if (unlockedPot(0))
     {
@@ -3231,8 +3785,8 @@ void adjustValues()
 
     if (unlockedPot(2))
     {
-      assignIncrementButtons(&seq[currentSeq].transpose, -36, 36, 1);
-      seq[currentSeq].transpose = map(pot[2], 0, 1023, -36, 36);
+      assignIncrementButtons(&seqEditSetting[SEQ_TRANSPOSE], -36, 36, 1);
+      setSeqSetting(SEQ_TRANSPOSE, map(pot[2], 0, 1023, -36, 36));
     }
     break;
 
@@ -3258,26 +3812,16 @@ void adjustValues()
     }
     if (unlockedPot(2))
     {
-      if (pot[2] < 341)
-      {
-        seq[currentSeq].tie[seqEditStep] = 0;
-        seq[currentSeq].mute[seqEditStep] = 0;
-      }
-      else if (pot[2] < 682)
-      {
-        seq[currentSeq].tie[seqEditStep] = 1;
-        seq[currentSeq].mute[seqEditStep] = 0;
-      }
-      else if (pot[2] < 1023)
-      {
-        seq[currentSeq].tie[seqEditStep] = 0;
-        seq[currentSeq].mute[seqEditStep] = 1;
-      }
+      byte stepKind = map(pot[2], 0, 1023, 0, 3); // normal, tie, mute, accent
+      setSeqFlag(currentSeq, seqEditStep, SEQ_TIE, stepKind == 1);
+      setSeqFlag(currentSeq, seqEditStep, SEQ_MUTE, stepKind == 2);
+      setSeqFlag(currentSeq, seqEditStep, SEQ_ACCENT, stepKind == 3);
     }
     if (unlockedPot(3))
     {
-      assignIncrementButtons(&seqEditStep, 0, 15, 1);
-      int tmp = constrain(pot[3] / (1023 / 16), 0, 15);
+      int lastStep = seq[currentSeq].patternLength - 1;
+      assignIncrementButtons(&seqEditStep, 0, lastStep, 1);
+      int tmp = map(pot[3], 0, 1023, 0, lastStep);
       if (seqEditStep != tmp)
       {
         seqEditStep = tmp;
@@ -3291,72 +3835,80 @@ void adjustValues()
   case 211: // SEQUENCER EDIT STEP
     if (unlockedPot(0))
     {
-      assignIncrementButtons(&seq[currentSeq].voice[0][seqEditStep], -39, 48, 1);
+      assignIncrementButtons(&seqEditNote[0], -39, 48, 1);
       if (pot[0] < 100)
       {
-        seq[currentSeq].voice[0][seqEditStep] = 255;
+        seqEditNote[0] = 255;
+        setSeqNote(currentSeq, 0, seqEditStep, 255);
         valueChange = true;
       }
       else
       {
         int tmpNote = map(pot[0], 100, 1023, 21, 108) - 60;
-        if (tmpNote != seq[currentSeq].voice[0][seqEditStep])
+        if (tmpNote != seqEditNote[0])
         {
-          seq[currentSeq].voice[0][seqEditStep] = tmpNote;
+          seqEditNote[0] = tmpNote;
+          setSeqNote(currentSeq, 0, seqEditStep, tmpNote);
           valueChange = true;
         }
       }
     }
     if (unlockedPot(1))
     {
-      assignIncrementButtons(&seq[currentSeq].voice[1][seqEditStep], -39, 48, 1);
+      assignIncrementButtons(&seqEditNote[1], -39, 48, 1);
       if (pot[1] < 100)
       {
-        seq[currentSeq].voice[1][seqEditStep] = 255;
+        seqEditNote[1] = 255;
+        setSeqNote(currentSeq, 1, seqEditStep, 255);
         valueChange = true;
       }
       else
       {
         int tmpNote = map(pot[1], 100, 1023, 21, 108) - 60;
-        if (tmpNote != seq[currentSeq].voice[1][seqEditStep])
+        if (tmpNote != seqEditNote[1])
         {
-          seq[currentSeq].voice[1][seqEditStep] = tmpNote;
+          seqEditNote[1] = tmpNote;
+          setSeqNote(currentSeq, 1, seqEditStep, tmpNote);
           valueChange = true;
         }
       }
     }
     if (unlockedPot(2))
     {
-      assignIncrementButtons(&seq[currentSeq].voice[2][seqEditStep], -39, 48, 1);
+      assignIncrementButtons(&seqEditNote[2], -39, 48, 1);
       if (pot[2] < 100)
       {
-        seq[currentSeq].voice[2][seqEditStep] = 255;
+        seqEditNote[2] = 255;
+        setSeqNote(currentSeq, 2, seqEditStep, 255);
         valueChange = true;
       }
       else
       {
         int tmpNote = map(pot[2], 100, 1023, 21, 108) - 60;
-        if (tmpNote != seq[currentSeq].voice[2][seqEditStep])
+        if (tmpNote != seqEditNote[2])
         {
-          seq[currentSeq].voice[2][seqEditStep] = tmpNote;
+          seqEditNote[2] = tmpNote;
+          setSeqNote(currentSeq, 2, seqEditStep, tmpNote);
           valueChange = true;
         }
       }
     }
     if (unlockedPot(3))
     {
-      assignIncrementButtons(&seq[currentSeq].voice[3][seqEditStep], -39, 48, 1);
+      assignIncrementButtons(&seqEditNote[3], -39, 48, 1);
       if (pot[3] < 100)
       {
-        seq[currentSeq].voice[3][seqEditStep] = 255;
+        seqEditNote[3] = 255;
+        setSeqNote(currentSeq, 3, seqEditStep, 255);
         valueChange = true;
       }
       else
       {
         int tmpNote = map(pot[3], 100, 1023, 21, 108) - 60;
-        if (tmpNote != seq[currentSeq].voice[3][seqEditStep])
+        if (tmpNote != seqEditNote[3])
         {
-          seq[currentSeq].voice[3][seqEditStep] = tmpNote;
+          seqEditNote[3] = tmpNote;
+          setSeqNote(currentSeq, 3, seqEditStep, tmpNote);
           valueChange = true;
         }
       }
@@ -3366,18 +3918,18 @@ void adjustValues()
   case 220: // SEQUENCER EDIT STEP
     if (unlockedPot(0))
     {
-      assignIncrementButtons(&seq[currentSeq].patternLength, 1, 16, 1);
-      seq[currentSeq].patternLength = map(pot[0], 0, 1023, 1, 16);
+      assignIncrementButtons(&seqEditSetting[SEQ_LENGTH], 1, SEQ_MAX_STEPS, 1);
+      setSeqSetting(SEQ_LENGTH, map(pot[0], 0, 1023, 1, SEQ_MAX_STEPS));
     }
     if (unlockedPot(1))
     {
-      assignIncrementButtons(&seq[currentSeq].noteDur, 0, 1023, 4);
-      seq[currentSeq].noteDur = pot[1];
+      assignIncrementButtons(&seqEditSetting[SEQ_DURATION], 0, 1023, 4);
+      setSeqSetting(SEQ_DURATION, pot[1]);
     }
     if (unlockedPot(2))
     {
-      assignIncrementButtons(&seq[currentSeq].swing, 0, 1023, 4);
-      seq[currentSeq].swing = pot[2];
+      assignIncrementButtons(&seqEditSetting[SEQ_SWING], 0, 1023, 4);
+      setSeqSetting(SEQ_SWING, pot[2]);
     }
     if (unlockedPot(3))
     {
@@ -3400,6 +3952,45 @@ void adjustValues()
         bankMode = tmpMode;
       //valueChange = true;
     }
+    if (unlockedPot(2))
+    {
+      assignIncrementButtons(&seqGroup, 0, (SEQ_PATTERNS / 8) - 1, 1);
+      int tmpGroup = map(pot[2], 0, 1023, 0, (SEQ_PATTERNS / 8) - 1);
+      if (seqGroup != tmpGroup)
+      {
+        seqGroup = tmpGroup;
+        valueChange = true;
+      }
+    }
+    break;
+
+  case 240: // SEQUENCER CC LANES
+    if (unlockedPot(0))
+    {
+      assignIncrementButtons(&seqCCLane, 0, 3, 1);
+      int tmp = map(pot[0], 0, 1023, 0, 3);
+      if (tmp != seqCCLane)
+      {
+        seqCCLane = tmp;
+        seqCCNum = min(seq[currentSeq].controlNum[seqCCLane], 128);
+      }
+    }
+    if (unlockedPot(1))
+    {
+      assignIncrementButtons(&seqCCNum, 0, 128, 1);
+      seqCCNum = map(pot[1], 0, 1023, 0, 128);
+      seq[currentSeq].controlNum[seqCCLane] = (seqCCNum < 128) ? seqCCNum : 255;
+    }
+    if (unlockedPot(2))
+    {
+      assignIncrementButtons(&seqCCGlide, 0, 1, 1);
+      seqCCGlide = (pot[2] < 512) ? 0 : 1;
+    }
+    if (unlockedPot(3))
+    {
+      assignIncrementButtons(&seqCCRoute, 0, 1, 1);
+      seqCCRoute = (pot[3] < 512) ? 0 : 1;
+    }
     break;
 
   case 250: // LOAD SEQ BANK
@@ -3430,67 +4021,6 @@ void adjustValues()
     }
     break;
 
-  case 300: // SETTINGS MIDI
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&midiOut, 0, 1, 1);
-      int tmp = (pot[0] < 512) ? 0 : 1;
-      if (midiOut != tmp)
-      {
-        midiOut = tmp;
-        valueChange;
-      }
-    }
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&midiChannel, 1, 16, 1);
-      int tmp = map(pot[1], 0, 1023, 1, 16);
-      if (midiChannel != tmp)
-      {
-        midiChannel = tmp;
-        valueChange;
-      }
-    }
-    if (unlockedPot(2))
-    {
-      assignIncrementButtons(&midiThruType, 0, 2, 1);
-      byte items = 3;
-      int tmp = (pot[2] / (1022 / items) < (items - 1)) ? pot[2] / (1022 / items) : items - 1;
-      if (midiThruType != tmp)
-      {
-        midiThruType = tmp;
-        checkThru();
-        valueChange;
-      }
-    }
-    if (unlockedPot(3))
-    {
-      assignIncrementButtons(&midiSync, 0, 2, 1);
-      int tmp = (pot[3] / (1027 / 3));
-      if (midiSync != tmp)
-      {
-        midiSync = tmp;
-        setSyncType();
-      }
-    }
-    break;
-
-  case 310: // SETTINGS KEYBOARD
-    if (unlockedPot(0))
-    {
-      assignIncrementButtons(&keysOut, 0, 1, 1);
-      if (pot[0] < 512)
-        keysOut = 0;
-      else
-        keysOut = 1;
-    }
-    if (unlockedPot(1))
-    {
-      assignIncrementButtons(&keyVelocity, 0, 127, 1);
-      if (keyVelocity != pot[1] >> 3)
-        keyVelocity = pot[1] >> 3;
-    }
-    break;
   case 320: // // SETTINGS TRIGGER MIDI
     if (unlockedPot(0))
     {
@@ -3522,12 +4052,73 @@ void adjustValues()
         midiTrigger[editTrigger] = tmp;
     }
     break;
-  case 330: // // SETTINGS GENERAL
+  case 340: // SETTINGS MIDI LEARN
+    if (unlockedPot(0))
+    {
+      assignIncrementButtons(&ccLearnParam, 0, PARAMS - 1, 1);
+      ccLearnParam = map(pot[0], 0, 1023, 0, PARAMS - 1);
+    }
+    if (unlockedPot(3))
+    {
+      assignIncrementButtons(&ccLearn, 0, 2, 1);
+      int tmp = constrain(pot[3] / 341, 0, 2);
+      if (tmp != ccLearn)
+      {
+        ccLearn = tmp;
+        if (ccLearn == 2)
+          clearCCMapping(ccLearnParam);
+      }
+    }
+    break;
+
+  case 15: // OSC1 - wavetable bank
+  case 25: // OSC2 - wavetable bank
+    if (unlockedPot(0))
+    {
+      assignIncrementButtons(&wavetableChoice, 0, wavetableCount, 1);
+      int tmp = map(pot[0], 0, 1023, 0, wavetableCount);
+      if (tmp != wavetableChoice)
+      {
+        wavetableChoice = tmp;
+        getWavetableName(wavetableChoice);
+      }
+    }
+    break;
+
+  case 350: // SETTINGS TUNING
+    if (tuningCount < 0)
+      countTunings();
+    if (unlockedPot(0))
+    {
+      assignIncrementButtons(&tuningChoice, 0, tuningCount, 1);
+      int tmp = map(pot[0], 0, 1023, 0, tuningCount);
+      if (tmp != tuningChoice)
+      {
+        tuningChoice = tmp;
+        getTuningName(tuningChoice);
+      }
+    }
+    break;
+
+  case 370: // SETTINGS SD TIMING
+    if (unlockedPot(0))
+    {
+      assignIncrementButtons(&sdBlockIO, 0, 1, 1);
+      int tmp = (pot[0] < 512) ? 0 : 1;
+      if (tmp != sdBlockIO)
+      {
+        sdBlockIO = tmp;
+        valueChange = true;
+      }
+    }
+    break;
+
+  case 380: // SETTINGS SLOT STORE
     if (unlockedPot(0))
     {
-      assignIncrementButtons(&volume, 0, 1023, 4);
-      if (pot[0] != volume)
-        volume = pot[0];
+      assignIncrementButtons(&sdSlotStore, 0, 1, 1);
+      if (setParam(P_SLOT_STORE, (pot[0] < 512) ? 0 : 1))
+        valueChange = true;
     }
     break;
   }
@@ -3538,10 +4129,10 @@ void getMenu()
   switch (mainMenu)
   {
   case 0: // SYNTH
-    menuPages = 9;
+    menuPages = 12;
     if (unlockedPot(4)) // select the menu page
     {
-      assignIncrementButtons(&menuChoice, 0, 8, 1);
+      assignIncrementButtons(&menuChoice, 0, 11, 1);
       int tmp = 1023 / menuPages;
       menuChoice = constrain(pot[4] / tmp, 0, menuPages - 1);
       menu = synthMenu[menuChoice];
@@ -3589,10 +4180,10 @@ void getMenu()
     break;
 
   case 2: // SEQUENCER
-    menuPages = 5;
+    menuPages = 6;
     if (unlockedPot(4)) // select the menu page
     {
-      assignIncrementButtons(&menuChoice, 0, 4, 1);
+      assignIncrementButtons(&menuChoice, 0, 5, 1);
       int tmp = 1023 / menuPages;
       menuChoice = constrain(pot[4] / tmp, 0, menuPages - 1);
       menu = seqMenu[menuChoice];
@@ -3609,10 +4200,10 @@ void getMenu()
     break;
 
   case 3: // SETTINGS
-    menuPages = 5;
+    menuPages = 10;
     if (unlockedPot(4)) // select the menu page
     {
-      assignIncrementButtons(&menuChoice, 0, 4, 1);
+      assignIncrementButtons(&menuChoice, 0, 9, 1);
       int tmp = 1023 / menuPages;
       menuChoice = constrain(pot[4] / tmp, 0, menuPages - 1);
       menu = settingsMenu[menuChoice];
@@ -3624,316 +4215,948 @@ void getMenu()
         updateMenu();
       }
     }
-    break;
+    break;
+  }
+}
+
+void getSyncSelector()
+{
+  int lastSyncSelector = syncSelector;
+  syncSelector = constrain((pot[1] / 204), 0, 4);
+  if (syncSelector == lastSyncSelector)
+    lockPot(5);
+  valueChange = true;
+}
+
+// SD.ino
+void getWaveform()
+{
+  if (dirCount == 0 && dirChecked == false)
+  {
+    getDirCount();
+  }
+
+  else
+  {
+    if (tempCount != dirChoice)
+      selectDirChoice();
+    if (tempCount == dirChoice)
+    {
+      lcd.setCursor(0, 1);
+      lcd.print("    ");
+      lcd.print(fileName);
+      if (folder)
+        arrow(strlen(fileName) + 4, 1);
+      //lcd.print(char(127));
+      lcd.print("            "); // sloppy way to clear excess characters
+    }
+    if (!waveshapeLoaded)
+    {
+      // if (
+      if (checkExtension(".WAV"))
+        //);
+        loadWaveshape();
+    }
+  }
+}
+
+void getDirCount()
+{
+  indexDir();
+  dirChoice = 0;
+  dirChecked = true;
+  valueChange = true;
+}
+
+void indexDir() // walk the folder once, after that the browsers find entries in RAM
+{
+  if (slotStoreName() != NULL)
+  {
+    indexSlots();
+    return;
+  }
+  sd.vwd()->rewind();
+  tempCount = 0;
+  while (file.openNext(sd.vwd(), O_READ))
+  {
+    //if (!macFile())
+    if (tempCount < DIR_ENTRIES)
+    {
+      dirEntry *entry = &dirIndex[tempCount];
+      file.getFilename(entry->name);
+      entry->isDir = file.isDir();
+      entry->index = (sd.vwd()->curPosition() >> 5) - 1; // openNext() leaves the folder just past the entry
+      entry->size = file.fileSize();
+      entry->firstCluster = file.firstCluster();
+    }
+    tempCount++;
+    file.close();
+  }
+  dirCount = tempCount;
+  sd.vwd()->rewind();
+  dirIndexValid = true;
+}
+
+boolean selectDirChoice() // point fileName at the dirChoice-th entry of the folder
+{
+  if (!dirIndexValid)
+    indexDir();
+  tempCount = 0;
+  if (dirChoice < 1 || dirChoice > dirCount)
+    return false;
+
+  if (dirChoice <= DIR_ENTRIES)
+  {
+    strcpy(fileName, dirIndex[dirChoice - 1].name);
+    folder = dirIndex[dirChoice - 1].isDir;
+  }
+  else // past the end of the index - walk the folder
+  {
+    sd.vwd()->rewind();
+    for (int i = 0; i < dirChoice && file.openNext(sd.vwd(), O_READ); i++)
+    {
+      file.getFilename(fileName);
+      folder = file.isDir();
+      file.close();
+    }
+    sd.vwd()->rewind();
+  }
+  if (folder)
+    strcpy(folderName, fileName);
+  tempCount = dirChoice;
+  return true;
+}
+
+boolean openDirChoice() // open the selected entry straight from its position in the folder
+{
+  if (dirIndexValid && dirChoice >= 1 && dirChoice <= min(dirCount, DIR_ENTRIES) && strcmp(dirIndex[dirChoice - 1].name, fileName) == 0)
+    return openDirEntry(&file, dirChoice);
+  return file.open(fileName);
+}
+
+boolean openDirEntry(SdFile *target, int choice) // a file, or the store positioned at the start of a slot
+{
+  if (slotStoreName() != NULL)
+    return target->open(slotStoreName(), O_READ) && target->seekSet((uint32_t)dirIndex[choice - 1].index * slotBlocks() * SD_BLOCK);
+  return target->open(sd.vwd(), dirIndex[choice - 1].index, O_READ);
+}
+
+const char *slotStoreName() // the store of the current folder's browser, NULL for a file each
+{
+  if (!sdSlotStore || !inFolder)
+    return NULL;
+  if (menu == 70 || menu == 80)
+    return "PATCHES.TBK";
+  if (menu == 250 || menu == 260)
+    return "BANKS.TBK";
+  return NULL;
+}
+
+byte slotCount()
+{
+  return (menu == 250 || menu == 260) ? SLOT_BANKS : SLOT_PATCHES;
+}
+
+uint16_t slotBlocks()
+{
+  return (menu == 250 || menu == 260) ? SEQ_BANK_BLOCKS : PATCH_FILE_BLOCKS;
+}
+
+void indexSlots() // the browsers list the slots of the store - an empty one is shown as "NN ---"
+{
+  patchHeader header;
+  const char *extension = (menu == 250 || menu == 260) ? "SEQ" : "TB2";
+  boolean opened = file.open(slotStoreName(), O_READ);
+  for (byte i = 0; i < slotCount(); i++)
+  {
+    dirEntry *entry = &dirIndex[i];
+    entry->isDir = false;
+    entry->index = i;
+    entry->size = 0;
+    entry->firstCluster = 0;
+    if (opened && file.seekSet((uint32_t)i * slotBlocks() * SD_BLOCK) && file.read(&header, sizeof(header)) == sizeof(header) && memcmp(header.magic, "TB2", 3) == 0)
+      entry->size = sizeof(header) + header.length;
+    if (entry->size > 0)
+      sprintf(entry->name, "%02d.%s", i + 1, extension);
+    else
+      sprintf(entry->name, "%02d ---", i + 1);
+  }
+  if (opened)
+    file.close();
+  dirCount = slotCount();
+  dirIndexValid = true;
+}
+
+int firstFreeSlot() // -1 if the store is full
+{
+  if (!dirIndexValid)
+    indexDir();
+  for (byte i = 0; i < slotCount(); i++)
+  {
+    if (dirIndex[i].size == 0)
+      return i;
+  }
+  return -1;
+}
+
+boolean emptySlot() // nothing to overwrite, so no need to confirm
+{
+  return (slotStoreName() != NULL && strstr(fileName, "---") != NULL);
+}
+
+void applySlotStore() // the browsers list something else now, and a cached "01.TB2" may be the other one
+{
+  for (byte i = 0; i < PATCH_CACHE; i++)
+    patchCache[i].name[0] = 0;
+  dirIndexValid = false;
+  dirCount = 0;
+  dirChecked = false;
+}
+
+void loadWaveshape()
+{
+  if (!folder)
+  {
+    uint16_t *table = nUserTable1;
+    if (menu == 21)
+      table = nUserTable2;
+    else if (menu == 51)
+      table = nUserTable3;
+    waveFormat format;
+    openDirChoice();
+    if (readWaveFormat(&file, &format)) // anything else leaves the table as it was
+      resampleWave(&file, &format, table, sdScratch); // the file goes through sdScratch
+    file.close();
+    waveshapeLoaded = true;
+  }
+}
+
+boolean checkExtension(char ext[]) // checks the extension of the file, use argument like ".WAV", ".TB2"
+{
+  byte nameLength = strlen(fileName);
+  if (nameLength < 6)
+    return false;
+  else
+  {
+    char lastFour[5];
+    for (byte i = 0; i < 5; i++)
+      lastFour[i] = fileName[nameLength - 4 + i]; // create a string with only the last four chars
+    if (strcmp(ext, lastFour) == 0)
+      return true;
+    else
+      return false;
+  }
+}
+
+int countFolderFiles(const char *folder, const char *extension) // files with the extension, 0 if there's no folder
+{
+  SdFile dir;
+  SdFile entry;
+  int count = 0;
+  if (!dir.open(folder, O_READ))
+    return 0;
+  while (entry.openNext(&dir, O_READ))
+  {
+    char name[13];
+    entry.getFilename(name);
+    if (strstr(name, extension) != NULL)
+      count++;
+    entry.close();
+  }
+  dir.close();
+  return count;
+}
+
+boolean getFolderFileName(const char *folder, const char *extension, int choice, char *name) // the choice-th file with the extension, from 1, without the extension
+{
+  SdFile dir;
+  SdFile entry;
+  int count = 0;
+  if (!dir.open(folder, O_READ))
+    return false;
+  while (count < choice && entry.openNext(&dir, O_READ))
+  {
+    char entryName[13];
+    entry.getFilename(entryName);
+    char *found = strstr(entryName, extension);
+    if (found != NULL)
+    {
+      count++;
+      *found = 0;
+      strcpy(name, entryName);
+    }
+    entry.close();
+  }
+  dir.close();
+  return (count == choice);
+}
+
+void packName(int *buffer, byte slot, const char *name) // an 8 character name takes 4 ints
+{
+  char packed[16];
+  memset(packed, 0, sizeof(packed));
+  strncpy(packed, name, 8);
+  memcpy(&buffer[slot], packed, 16);
+}
+
+void unpackName(int *buffer, byte slot, char *name) // name needs 9 characters
+{
+  memcpy(name, &buffer[slot], 8);
+  name[8] = 0;
+}
+
+void savePatch()
+{
+  forgetCachedPatch(fileName);
+  if (slotStoreName() == NULL)
+    dirIndexValid = false; // the file may be new - a slot is renamed in place
+  if (saveTaggedFile(fileName, "TB2P", PATCH_FORMAT, PATCH_FILE_BLOCKS, writePatchRecords))
+  {
+    lcd.setCursor(4, 1);
+    lcd.print("Saved!      ");
+  }
+}
+
+void writePatchRecords(patchWriter *writer)
+{
+  // PARAMETERS - slot and value pairs
+  int param[PATCH_CACHE_PARAMS];
+  for (byte i = 0; i < PATCH_CACHE_PARAMS; i++)
+    param[i] = 0;
+  saveParams(param, false);  // every patch slot in the registry
+  packName(param, 41, tuningName);     // slots 41 - 44
+  packName(param, 53, wavetableName); // slots 53 - 56
+  param[45] = PATCH_VERSION;
+  uint16_t length = PATCH_CACHE_PARAMS * 5;
+  byte record[5] = {PATCH_TAG_PARAMS, (byte)(length & 0xFF), (byte)(length >> 8)};
+  writePatchBytes(writer, record, 3);
+  for (byte i = 0; i < PATCH_CACHE_PARAMS; i++)
+  {
+    writePatchBytes(writer, &i, 1);
+    writePatchBytes(writer, &param[i], 4);
+  }
+  // USER WAVESHAPES - delta packed, a smooth shape is close to a byte per sample
+  const uint16_t *wave[3] = {nUserTable1, nUserTable2, nUserTable3};
+  for (byte w = 0; w < 3; w++)
+  {
+    length = 2 + packWave<patchWriter>(NULL, wave[w]);
+    record[0] = PATCH_TAG_WAVE;
+    record[1] = length & 0xFF;
+    record[2] = length >> 8;
+    record[3] = w;
+    record[4] = PATCH_WAVE_DELTA;
+    writePatchBytes(writer, record, 5);
+    packWave(writer, wave[w]);
+  }
+}
+
+void loadPatch()
+{
+  if (patchHandover == HANDOVER_MUTE)
+  {
+    loadRampUp = false;
+    loadRampDown = true;
+  }
+  else
+    loadProceed();
+}
+
+void loadProceed()
+{
+  stopMorph();      // the loaded patch replaces the morph
+  finishHandover(); // a patch still waiting is overtaken
+  int8_t slot = findCachedPatch(fileName);
+  if (slot >= 0) // a memory copy instead of an SD read
+    patchCacheHits++;
+  else
+  {
+    patchCacheMisses++;
+    slot = readPatch();
+  }
+  if (slot >= 0 && patchHandover == HANDOVER_MUTE)
+    applyCachedPatch(slot, true);
+  else if (slot >= 0)
+    beginHandover(slot);
+  synthPatchLoaded = true;
+  loadRampUp = (patchHandover == HANDOVER_MUTE);
+  patchChoiceTime = millis();
+  patchStepDirection = (dirChoice < patchChoice) ? -1 : 1;
+  patchChoice = dirChoice;
+}
+
+void beginHandover(int8_t slot) // the cached patch is the inactive set, it takes over without muting the output
+{
+  stageHandover(slot);
+  handoverSlot = slot;
+  saveParams(handoverFrom, false);
+  handoverStart = millis();
+  handoverTick = 0;
+  handoverSwitched = false;
+  handoverDue = false;
+  handoverFading = false;
+  if (patchHandover == HANDOVER_NOTE && envelopeVolume == 0 && !envelopeTrigger) // nothing is sounding, no need to wait
+    finishHandover();
+}
+
+void stageHandover(int8_t slot) // read the tuning and open the wavetable bank the patch names, without changing what plays
+{
+  char name[9];
+  dropHandover();
+  unpackName(patchCache[slot].param, 41, name); // patches without a tuning keep the current one
+  if (name[0] != 0 && strcmp(name, tuningName) != 0)
+    handoverTuningRead = readTuning(name, &handoverTuning);
+  unpackName(patchCache[slot].param, 53, name); // or a wavetable bank
+  if (name[0] != 0 && strcmp(name, wavetableName) != 0)
+    handoverWavetableRead = openWavetable(name, &handoverWavetableFile, &handoverWavetableFormat) ? 1 : -1;
+}
+
+void dropHandover() // a staged tuning and bank that won't be used
+{
+  if (handoverWavetableRead > 0)
+    handoverWavetableFile.close();
+  handoverTuningRead = 0;
+  handoverWavetableRead = 0;
+}
+
+void updateHandover() // from the loop - the setters run here, never on the envelope's pass
+{
+  if (handoverSlot < 0)
+    return;
+  if (patchHandover != HANDOVER_NOTE || handoverFading)
+    fadeHandover();
+  else if (handoverDue || (envelopeVolume == 0 && !envelopeTrigger)) // a note is waiting for it, or nothing is sounding
+    finishHandover();
+  else if (millis() - handoverStart > HANDOVER_WAIT) // held notes and no new one, glide over instead
+  {
+    handoverFading = true;
+    handoverStart = millis();
+  }
+}
+
+void fadeHandover() // glide the parameters that differ between the two sets, switch the others and the waves halfway
+{
+  unsigned long elapsed = millis() - handoverStart;
+  if (elapsed >= (unsigned long)patchFadeTime)
+  {
+    finishHandover();
+    return;
+  }
+  if (millis() - handoverTick < HANDOVER_TICK)
+    return;
+  handoverTick = millis();
+
+  int32_t progress = (elapsed << 10) / patchFadeTime; // 0 - 1023
+  if (!handoverSwitched && progress >= 512)
+  {
+    applyCachedWaves(handoverSlot);
+    handoverSwitched = true;
+  }
+  blendParams(handoverFrom, patchCache[handoverSlot].param, progress);
+}
+
+void finishHandover() // the inactive set becomes the active one
+{
+  if (handoverSlot < 0)
+    return;
+  char name[9];
+  if (handoverTuningRead > 0)
+  {
+    tuning = handoverTuning;
+    unpackName(patchCache[handoverSlot].param, 41, tuningName);
+    tuningBuildNote = 0; // rebuildTuning() takes it from here
+  }
+  else if (handoverTuningRead < 0)
+    resetTuning();
+  if (handoverWavetableRead != 0)
+  {
+    unloadWavetable();
+    if (handoverWavetableRead > 0)
+    {
+      wavetableFile = handoverWavetableFile; // the open file changes hands, a read-only file has nothing to write back
+      wavetableFormat = handoverWavetableFormat;
+      unpackName(patchCache[handoverSlot].param, 53, name);
+      useWavetable(name);
+    }
+  }
+  handoverTuningRead = 0;
+  handoverWavetableRead = 0;
+  applyCachedPatch(handoverSlot, false);
+  handoverSlot = -1;
+  handoverDue = false;
+  valueChange = true;
+}
+
+int8_t readPatch() // stream the chosen file straight into the cache, -1 if it isn't a readable patch
+{
+  patchReader reader;
+  int8_t slot = -1;
+  unsigned long started = micros();
+  if (flashFavouriteName(fileName) >= 0)
+    return readFlashPatch(flashFavouriteName(fileName));
+  if (openDirChoice())
+  {
+    slot = claimCachedPatch(fileName);
+    int result = (slot >= 0 && openPatchReader(&reader, &file, slot, sdBlockIO)) ? 1 : -1;
+    while (result == 1)
+      result = readPatchStep(&reader);
+    if (slot >= 0)
+      endBlockRead(&reader);
+    if (result == 0)
+      finishCachedPatch(slot);
+    else if (slot >= 0)
+    {
+      patchCache[slot].name[0] = 0;
+      slot = -1;
+    }
+  }
+  file.close();
+  sdLoadTime[sdBlockIO] = micros() - started;
+  return slot;
+}
+
+int8_t flashFavouriteName(const char *name) // "*FAV1" to "*FAV8" are the favourites, -1 for a file
+{
+  if (strncmp(name, "*FAV", 4) != 0)
+    return -1;
+  return constrain(atoi(name + 4) - 1, 0, FLASH_FAVOURITES - 1);
+}
+
+void applyCachedPatch(int8_t slot, boolean files)
+{
+  applyCachedWaves(slot);
+  applyPatchParams(patchCache[slot].param, files);
+}
+
+void applyPatchParams(int *param, boolean files) // a patch's parameter slots, once its user waves are in place - files false when a handover staged them
+{
+  loadParams(param, false, false); // every patch slot in the registry, only the setters of changed values are run
+  char name[9];
+  unpackName(param, 41, name); // patches without a tuning keep the current one
+  if (files && name[0] != 0 && strcmp(name, tuningName) != 0)
+    loadTuning(name);
+  unpackName(param, 53, name); // or a wavetable bank
+  if (files && name[0] != 0 && strcmp(name, wavetableName) != 0)
+    loadWavetable(name);
+  // the user tables may have changed under an unchanged wave type
+  applyOsc1Wave();
+  applyOsc2Wave();
+}
+
+void applyCachedWaves(int8_t slot)
+{
+  // USER WAVESHAPES
+  for (uint16_t i = 0; i < 600; i++)
+  {
+    nUserTable1[i] = patchCache[slot].wave[0][i];
+    nUserTable2[i] = patchCache[slot].wave[1][i];
+    nUserTable3[i] = patchCache[slot].wave[2][i];
+  }
+}
+
+int8_t findCachedPatch(const char *name) // -1 if it isn't cached
+{
+  for (byte i = 0; i < PATCH_CACHE; i++)
+  {
+    if (patchCache[i].complete && strcmp(patchCache[i].name, name) == 0 && strcmp(patchCache[i].folder, currentFolder) == 0)
+    {
+      patchCache[i].lastUsed = millis();
+      return i;
+    }
+  }
+  return -1;
+}
+
+int8_t claimCachedPatch(const char *name) // the least recently used entry, -1 if a morph or handover has them all pinned
+{
+  int8_t oldest = -1;
+  for (byte i = 0; i < PATCH_CACHE; i++)
+  {
+    if (cachePinned(i))
+      continue;
+    if (patchCache[i].name[0] == 0)
+    {
+      oldest = i;
+      break;
+    }
+    if (oldest < 0 || patchCache[i].lastUsed < patchCache[oldest].lastUsed)
+      oldest = i;
   }
+  if (oldest < 0)
+    return -1;
+  strcpy(patchCache[oldest].folder, currentFolder);
+  strcpy(patchCache[oldest].name, name);
+  patchCache[oldest].complete = false;
+  patchCache[oldest].lastUsed = millis();
+  return oldest;
 }
 
-void getSyncSelector()
+void finishCachedPatch(int8_t slot) // fully read - bring it up to the current PATCH_VERSION
 {
-  int lastSyncSelector = syncSelector;
-  syncSelector = constrain((pot[1] / 204), 0, 4);
-  if (syncSelector == lastSyncSelector)
-    lockPot(5);
-  valueChange = true;
+  int *param = patchCache[slot].param;
+  if (param[45] < 1) // osc2Detune used to be a phase increment offset
+  {
+    param[8] = param[8] >> 12; // +- 512 << 11 becomes +- 256 pitch units
+    param[45] = 1;
+  }
+  patchCache[slot].complete = true;
 }
 
-// SD.ino
-void getWaveform()
+void forgetCachedPatch(const char *name) // the file was written
 {
-  if (dirCount == 0 && dirChecked == false)
+  for (byte i = 0; i < PATCH_CACHE; i++)
   {
-    getDirCount();
+    if (strcmp(patchCache[i].name, name) == 0 && strcmp(patchCache[i].folder, currentFolder) == 0)
+      patchCache[i].name[0] = 0;
   }
+}
 
-  else
+boolean openPatchReader(patchReader *reader, SdFile *source, int8_t slot, boolean blocks) // false if it isn't a patch
+{
+  reader->direct = false;
+  if (blocks)
+    beginBlockRead(reader, source);
+  reader->param = patchCache[slot].param;
+  reader->wave = patchCache[slot].wave;
+  reader->offset = 0;
+  // values missing from the file keep their current setting
+  for (byte i = 0; i < PATCH_CACHE_PARAMS; i++)
+    patchCache[slot].param[i] = 0;
+  saveParams(patchCache[slot].param, false);
+  patchCache[slot].param[45] = PATCH_VERSION;
+  memcpy(patchCache[slot].wave[0], nUserTable1, sizeof(patchCache[slot].wave[0]));
+  memcpy(patchCache[slot].wave[1], nUserTable2, sizeof(patchCache[slot].wave[1]));
+  memcpy(patchCache[slot].wave[2], nUserTable3, sizeof(patchCache[slot].wave[2]));
+
+  if (readTaggedHeader(reader, source, "TB2P"))
+    return true;
+  reader->legacy = true;
+  return (source != NULL && source->fileSize() == PATCH_LEGACY_SIZE && rewindPatchReader(reader, 0));
+}
+
+boolean readTaggedHeader(patchReader *reader, SdFile *source, const char *magic) // false for a legacy file or the wrong magic, a NULL source reads flash
+{
+  uint32_t size = reader->flashSize;
+  if (source != NULL)
   {
-    while (tempCount < dirChoice)
-    {
-      file.openNext(sd.vwd(), O_READ);
-      tempCount++;
-      file.getFilename(fileName);
-      if (file.isDir())
-      {
-        folder = true;
-        file.getFilename(folderName);
-      }
-      else
-        folder = false;
-      file.close();
-    }
-    if (tempCount == dirChoice)
-    {
-      lcd.setCursor(0, 1);
-      lcd.print("    ");
-      lcd.print(fileName);
-      if (folder)
-        arrow(strlen(fileName) + 4, 1);
-      //lcd.print(char(127));
-      lcd.print("            "); // sloppy way to clear excess characters
-    }
-    if (!waveshapeLoaded)
+    size = source->fileSize();
+    reader->flash = NULL;
+  }
+  reader->file = source;
+  reader->base = (source != NULL) ? source->curPosition() : 0;
+  reader->flashUsed = 0;
+  return readPatchHeader(reader, magic, size - reader->base);
+}
+
+boolean verifyTaggedFile(patchReader *reader) // check the CRC, then rewind to the first record
+{
+  uint32_t length = reader->remaining;
+  return (verifyPatchRecords(reader) && restartTaggedFile(reader, length));
+}
+
+boolean restartTaggedFile(patchReader *reader, uint32_t length) // back to the first record, length is the records' total
+{
+  if (!rewindPatchReader(reader, sizeof(patchHeader)))
+    return false;
+  reader->remaining = length;
+  reader->crc = 0xFFFFFFFF;
+  reader->position = 0;
+  reader->used = 0;
+  reader->filled = 0;
+  return true;
+}
+
+boolean rewindPatchReader(patchReader *reader, uint32_t position)
+{
+  reader->used = 0;
+  reader->filled = 0;
+  if (reader->flash != NULL)
+  {
+    reader->flashUsed = position;
+    return true;
+  }
+  if (!reader->direct)
+    return reader->file->seekSet(reader->base + position);
+  // multi-block reads only go forwards - start again from the first block
+  sd.card()->readStop();
+  reader->direct = sd.card()->readStart(reader->firstBlock);
+  reader->blockUsed = SD_BLOCK;
+  for (uint32_t i = 0; i < position && reader->direct; i++)
+  {
+    byte skipped;
+    fetchPatchBytes(reader, &skipped, 1);
+  }
+  return reader->direct;
+}
+
+boolean beginBlockRead(patchReader *reader, SdFile *source) // multi-block reads, if the file is in one run of blocks
+{
+  uint32_t endBlock;
+  reader->direct = false;
+  if (!source->contiguousRange(&reader->firstBlock, &endBlock) || !sd.vol()->cacheClear())
+    return false;
+  reader->firstBlock += source->curPosition() / SD_BLOCK; // a slot starts on a block
+  reader->direct = sd.card()->readStart(reader->firstBlock);
+  reader->blockUsed = SD_BLOCK;
+  return reader->direct;
+}
+
+void endBlockRead(patchReader *reader)
+{
+  if (reader->direct)
+    sd.card()->readStop();
+  reader->direct = false;
+}
+
+int fetchPatchBytes(patchReader *reader, byte *data, uint16_t count) // from the file, flash, or straight from the card a block at a time
+{
+  if (reader->flash != NULL)
+  {
+    uint32_t left = reader->flashSize - reader->flashUsed;
+    if (count > left)
+      count = left;
+    memcpy(data, reader->flash + reader->flashUsed, count);
+    reader->flashUsed += count;
+    return count;
+  }
+  if (!reader->direct)
+    return reader->file->read(data, count);
+  byte *block = (byte *)sdScratch;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    if (reader->blockUsed == SD_BLOCK)
     {
-      // if (
-      if (checkExtension(".WAV"))
-        //);
-        loadWaveshape();
+      if (!sd.card()->readData(block))
+        return -1;
+      reader->blockUsed = 0;
     }
+    data[i] = block[reader->blockUsed++];
   }
+  return count;
 }
 
-void getDirCount()
+void beginTaggedFile(patchWriter *writer, SdFile *target) // a NULL target only measures
 {
-  sd.vwd()->rewind();
-  tempCount = 0;
-  while (file.openNext(sd.vwd(), O_READ))
-  {
-    //if (!macFile())
-    tempCount++;
+  patchHeader header;
+  memset(&header, 0, sizeof(header));
+  writer->file = target;
+  writer->length = 0;
+  writer->crc = 0xFFFFFFFF;
+  writer->ok = true;
+  writer->flash = NULL;
+  writer->direct = false;
+  writer->used = 0;
+  if (target != NULL)
+    target->write(&header, sizeof(header)); // written again once the length and CRC are known
+}
+
+boolean endTaggedFile(patchWriter *writer, const char *magic, uint16_t format)
+{
+  patchHeader header;
+  fillPatchHeader(writer, &header, magic, format);
+  return (writer->ok && writer->file->seekSet(0) && writer->file->write(&header, sizeof(header)) == sizeof(header));
+}
+
+boolean saveTaggedFile(const char *name, const char *magic, uint16_t format, uint16_t blocks, void (*records)(patchWriter *))
+{
+  patchWriter writer;
+  unsigned long started = micros();
+  boolean saved = false;
+  if (slotStoreName() != NULL)
+    return saveSlot(atoi(name) - 1, magic, format, records);
+  if (sdBlockIO)
+    saved = saveTaggedBlocks(name, magic, format, blocks, records);
+  if (!saved) // through the file system, with a FAT and directory update
+  {
+    file.open(name, O_RDWR | O_CREAT | O_TRUNC); // create file if it doesn't exist - truncated, as an older file may be longer
+    beginTaggedFile(&writer, &file);
+    records(&writer);
+    saved = endTaggedFile(&writer, magic, format) && file.sync();
     file.close();
   }
-  dirCount = tempCount;
-  dirChoice = 0;
-  sd.vwd()->rewind();
-  dirChecked = true;
-  valueChange = true;
+  sdSaveTime[sdBlockIO] = micros() - started;
+  return saved;
 }
 
-void loadWaveshape()
+boolean saveTaggedBlocks(const char *name, const char *magic, uint16_t format, uint16_t blocks, void (*records)(patchWriter *))
 {
-  if (!folder)
+  uint32_t firstBlock;
+  boolean saved = openContiguous(name, blocks, &firstBlock) && writeTaggedRun(firstBlock, blocks, magic, format, records);
+  file.close();
+  return saved;
+}
+
+boolean writeTaggedRun(uint32_t firstBlock, uint16_t blocks, const char *magic, uint16_t format, void (*records)(patchWriter *)) // only the blocks the data needs
+{
+  // the blocks go out in order, so a dry run first for the header's length and CRC
+  patchWriter writer;
+  patchHeader header;
+  beginTaggedFile(&writer, NULL);
+  records(&writer);
+  fillPatchHeader(&writer, &header, magic, format);
+  uint32_t used = (sizeof(header) + header.length + SD_BLOCK - 1) / SD_BLOCK;
+  if (used > blocks)
+    return false;
+  boolean saved = sd.vol()->cacheClear() && sd.card()->writeStart(firstBlock, used);
+  if (saved)
   {
-    file.open(fileName);
-    file.seekSet(44);                 // just after the header data
-    file.read(waveShapeBuffer, 1200); // we know our waveeshape files are all 1200 bytes long (ie. 600 * 16 bit ints)
-    file.close();
-    switch (menu)
+    beginTaggedFile(&writer, NULL);
+    writer.direct = true;
+    writer.blockUsed = 0;
+    appendBlockBytes(&writer, &header, sizeof(header));
+    records(&writer);
+    flushPatchWriter(&writer);
+    if (writer.blockUsed > 0) // pad the last block
     {
-    case 11:
-      for (int i = 0; i < 600; i++)
-        nUserTable1[i] = (waveShapeBuffer[i] >> 4) + 2048;
-      break;
-    case 21:
-      for (int i = 0; i < 600; i++)
-        nUserTable2[i] = (waveShapeBuffer[i] >> 4) + 2048;
-      break;
-    case 51:
-      for (int i = 0; i < 600; i++)
-        nUserTable3[i] = (waveShapeBuffer[i] >> 4) + 2048;
-      break;
+      memset((byte *)sdScratch + writer.blockUsed, 0, SD_BLOCK - writer.blockUsed);
+      writer.ok = writer.ok && sd.card()->writeData((byte *)sdScratch);
     }
-    file.close();
-    waveshapeLoaded = true;
+    saved = sd.card()->writeStop() && writer.ok;
   }
+  return saved;
 }
 
-boolean checkExtension(char ext[]) // checks the extension of the file, use argument like ".WAV", ".TB2"
+boolean saveSlot(byte slot, const char *magic, uint16_t format, void (*records)(patchWriter *)) // no FAT or directory update, the store's blocks are overwritten
 {
-  byte nameLength = strlen(fileName);
-  if (nameLength < 6)
+  uint32_t firstBlock;
+  unsigned long started = micros();
+  boolean saved = false;
+  if (slot < slotCount())
+    saved = openSlotStore(&firstBlock) && writeTaggedRun(firstBlock + (uint32_t)slot * slotBlocks(), slotBlocks(), magic, format, records);
+  file.close();
+  slotSaveTime = micros() - started;
+  slotSaveWorst = max(slotSaveWorst, slotSaveTime);
+  if (saved && dirIndexValid)
+  {
+    sprintf(dirIndex[slot].name, "%02d.%s", slot + 1, (menu == 250 || menu == 260) ? "SEQ" : "TB2");
+    dirIndex[slot].size = SD_BLOCK; // only tested against 0 and a header
+  }
+  return saved;
+}
+
+boolean openSlotStore(uint32_t *firstBlock) // leaves file open on the store, made once per folder
+{
+  uint32_t endBlock;
+  uint32_t size = (uint32_t)slotCount() * slotBlocks() * SD_BLOCK;
+  if (file.open(slotStoreName(), O_RDWR))
+    return (file.fileSize() >= size && file.contiguousRange(firstBlock, &endBlock)); // a copied in, fragmented store isn't replaced - its slots are the patches
+  if (!file.createContiguous(sd.vwd(), slotStoreName(), size) || !file.contiguousRange(firstBlock, &endBlock) || !sd.vol()->cacheClear())
     return false;
-  else
+  // the blocks aren't erased, so blank the first block of every slot
+  memset(sdScratch, 0, SD_BLOCK);
+  for (byte i = 0; i < slotCount(); i++)
   {
-    char lastFour[5];
-    for (byte i = 0; i < 5; i++)
-      lastFour[i] = fileName[nameLength - 4 + i]; // create a string with only the last four chars
-    if (strcmp(ext, lastFour) == 0)
-      return true;
-    else
+    if (!sd.card()->writeBlock(*firstBlock + (uint32_t)i * slotBlocks(), (byte *)sdScratch))
       return false;
   }
+  return true;
 }
 
-void savePatch()
+boolean openContiguous(const char *name, uint16_t blocks, uint32_t *firstBlock) // leaves file open on a preallocated run of blocks
 {
-  file.open(fileName, O_RDWR | O_CREAT); // create file if it doesn't exist and open the file for write
-  // OSC1
-  patchBuffer[0] = osc1WaveType;
-  patchBuffer[1] = osc1Octave;
-  patchBuffer[2] = osc1Volume;
-  patchBuffer[3] = osc1Detune;
-  patchBuffer[4] = pulseWidth;
-  // OSC2
-  patchBuffer[5] = osc2WaveType;
-  patchBuffer[6] = osc2Octave;
-  patchBuffer[7] = osc2Volume;
-  patchBuffer[8] = osc2Detune;
-  // FILTER
-  patchBuffer[9] = filterCutoff;
-  patchBuffer[10] = filterResonance;
-  patchBuffer[11] = fType;
-  patchBuffer[12] = filterBypass;
-  // ENVELOPE
-  patchBuffer[13] = attackTime;
-  patchBuffer[14] = decayTime;
-  patchBuffer[15] = sustainLevel;
-  patchBuffer[16] = releaseTime;
-  // LFO
-  patchBuffer[17] = lfoShape;
-  patchBuffer[18] = lfoRate;
-  patchBuffer[19] = lfoLowRange;
-  patchBuffer[20] = retrigger;
-  // MODULATION
-  patchBuffer[21] = lfoOsc1DetuneFactor;
-  patchBuffer[22] = lfoOsc2DetuneFactor;
-  patchBuffer[23] = osc1OctaveMod;
-  patchBuffer[24] = osc2OctaveMod;
-  patchBuffer[25] = lfoAmount;
-  patchBuffer[26] = lfoAmpFactor;
-  patchBuffer[27] = lfoPwFactor;
-  patchBuffer[28] = envOsc1PitchFactor;
-  patchBuffer[29] = envOsc2PitchFactor;
-  patchBuffer[30] = envFilterCutoffFactor;
-  patchBuffer[31] = envLfoRate;
-  // SHAPER & GAIN
-  patchBuffer[32] = shaperType;
-  patchBuffer[33] = shaperType1PotVal;
-  patchBuffer[34] = waveShapeAmount2;
-  patchBuffer[35] = gainAmountPotVal;
-  patchBuffer[36] = bitMuncher;
-  // MONO & PORTA
-  patchBuffer[37] = portamento;
-  patchBuffer[38] = monoMode;
-  patchBuffer[39] = unison;
-  patchBuffer[40] = uniSpread;
-  // write zeros to 100 for future use
-  for (byte i = 41; i < 100; i++)
-    patchBuffer[i] = 0;
-  // USER 1 WAVESHAPE
-  for (uint16_t i = 0; i < 600; i++)
-    patchBuffer[i + 100] = nUserTable1[i];
-  // USER 2 WAVESHAPE
-  for (uint16_t i = 0; i < 600; i++)
-    patchBuffer[i + 700] = nUserTable2[i];
-  // USER 3 WAVESHAPE
-  for (uint16_t i = 0; i < 600; i++)
-    patchBuffer[i + 1300] = nUserTable3[i];
-  // WRITE TO SD
-  if (file.write(patchBuffer, 7600) != -1) // note - we are writing 1900 4 byte ints from the patch buffer to 7600 bytes on the SD
+  uint32_t endBlock;
+  uint32_t size = (uint32_t)blocks * SD_BLOCK;
+  if (file.open(name, O_RDWR))
   {
-    if (file.sync())
+    if (file.fileSize() >= size && file.contiguousRange(firstBlock, &endBlock))
+      return true;
+    file.close();
+    sd.remove(name); // fragmented or too small - replaced once, every later save is an overwrite
+  }
+  return file.createContiguous(sd.vwd(), name, size) && file.contiguousRange(firstBlock, &endBlock);
+}
+
+void appendBlockBytes(patchWriter *writer, const void *data, uint16_t count)
+{
+  const byte *bytes = (const byte *)data;
+  byte *block = (byte *)sdScratch;
+  for (uint16_t i = 0; i < count; i++)
+  {
+    block[writer->blockUsed++] = bytes[i];
+    if (writer->blockUsed == SD_BLOCK)
     {
-      lcd.setCursor(4, 1);
-      lcd.print("Saved!      ");
+      writer->ok = writer->ok && sd.card()->writeData(block);
+      writer->blockUsed = 0;
     }
   }
-  file.close();
 }
 
-void loadPatch()
+boolean putPatchBytes(patchWriter *writer, const byte *data, uint16_t count) // a chunk from flushPatchWriter(), false if it couldn't be written
 {
-  loadRampUp = false;
-  loadRampDown = true;
+  if (writer->flash != NULL)
+    appendFlashBytes(writer->flash, data, count);
+  else if (writer->direct)
+    appendBlockBytes(writer, data, count);
+  else if (writer->file != NULL)
+    return (writer->file->write(data, count) == count);
+  return true; // a dry run only measures
 }
 
-void loadProceed()
+void prefetchPatches() // read the neighbours of the current patch into the cache, a record per loop pass
 {
-  file.open(fileName);
-  if (file.read(patchBuffer, 7600) == 7600) // note - we are reading 7600 bytes to a buffer of 1900 4 byte ints
-  {
-    // OSC1
-    osc1WaveType = patchBuffer[0];
-    setOsc1WaveType(osc1WaveType);
-    osc1Octave = patchBuffer[1];
-    osc1Volume = patchBuffer[2];
-    osc1Detune = patchBuffer[3];
-    pulseWidth = patchBuffer[4];
-    uiPulseWidth = pulseWidth;
-    // OSC2
-    osc2WaveType = patchBuffer[5];
-    setOsc2WaveType(osc2WaveType);
-    osc2Octave = patchBuffer[6];
-    osc2Volume = patchBuffer[7];
-    osc2Detune = patchBuffer[8];
-    // FILTER
-    filterCutoff = patchBuffer[9];
-    filterResonance = patchBuffer[10];
-    setFilterResonance(filterResonance);
-    fType = patchBuffer[11];
-    filterBypass = patchBuffer[12];
-    // ENVELOPE
-    attackTime = patchBuffer[13];
-    decayTime = patchBuffer[14];
-    sustainLevel = patchBuffer[15];
-    releaseTime = patchBuffer[16];
-    // LFO
-    lfoShape = patchBuffer[17];
-    setLfoShape(lfoShape);
-    lfoRate = patchBuffer[18];
-    userLfoRate = lfoRate;
-    lfoLowRange = patchBuffer[19];
-    retrigger = patchBuffer[20];
-    // MODULATION
-    lfoOsc1DetuneFactor = patchBuffer[21];
-    lfoOsc2DetuneFactor = patchBuffer[22];
-    osc1OctaveMod = patchBuffer[23];
-    osc2OctaveMod = patchBuffer[24];
-    lfoAmount = patchBuffer[25];
-    lfoAmpFactor = patchBuffer[26];
-    lfoPwFactor = patchBuffer[27];
-    envOsc1PitchFactor = patchBuffer[28];
-    envOsc2PitchFactor = patchBuffer[29];
-    envFilterCutoffFactor = patchBuffer[30];
-    envLfoRate = patchBuffer[31];
-    // USER 1 WAVESHAPE
-    for (uint16_t i = 0; i < 600; i++)
-      nUserTable1[i] = patchBuffer[i + 100];
-    // USER 2 WAVESHAPE
-    for (uint16_t i = 0; i < 600; i++)
-      nUserTable2[i] = patchBuffer[i + 700];
-    // USER 3 WAVESHAPE
-    for (uint16_t i = 0; i < 600; i++)
-      nUserTable3[i] = patchBuffer[i + 1300];
-    // SHAPER & GAIN
-    int changeCounter = 0;
-    if (patchBuffer[32] != shaperType)
-    {
-      shaperType = patchBuffer[32];
-      changeCounter++;
-    }
-    if (patchBuffer[33] != shaperType1PotVal)
-    {
-      shaperType1PotVal = patchBuffer[33];
-      float tmp = (float)shaperType1PotVal / 1024;
-      waveShapeAmount = tmp;
-      changeCounter++;
-    }
-    if (patchBuffer[34] != waveShapeAmount2)
-    {
-      waveShapeAmount2 = patchBuffer[34];
-      changeCounter++;
-    }
-    if (changeCounter) // ie. changeCounter is not 0
-      createWaveShaper();
-    if (patchBuffer[35] != gainAmountPotVal)
-    {
-      gainAmountPotVal = patchBuffer[35];
-      float tmp = (float)gainAmountPotVal / 1024;
-      tmp += 1.0;
-      gainAmount = tmp;
-      createGainTable();
-    }
-    bitMuncher = patchBuffer[36];
-    // MONO & PORTA
-    portamento = patchBuffer[37];
-    monoMode = patchBuffer[38];
-    unison = patchBuffer[39];
-    uniSpread = patchBuffer[40];
-    if (uniSpread == 0)
-      uniSpread = 10000;
+  boolean idle = (menu == 70 && synthPatchLoaded && !loadRampDown && !loadRampUp && handoverSlot < 0 && dirIndexValid && (millis() - patchChoiceTime) > PATCH_DWELL);
+  if (!idle)
+  {
+    if (prefetchSlot >= 0) // the user moved on - drop the half read patch
+    {
+      prefetchFile.close();
+      patchCache[prefetchSlot].name[0] = 0;
+      prefetchSlot = -1;
+    }
+    return;
+  }
+
+  if (prefetchSlot < 0)
+  {
+    int neighbour[2] = {dirChoice + patchStepDirection, dirChoice - patchStepDirection};
+    int next = 0;
+    for (byte i = 0; i < 2; i++) // the one ahead first, then the one behind takes the current patch's entry
+    {
+      if (neighbour[i] >= 1 && neighbour[i] <= min(dirCount, DIR_ENTRIES))
+      {
+        dirEntry *entry = &dirIndex[neighbour[i] - 1];
+        if (!entry->isDir && entry->size >= sizeof(patchHeader) && strstr(entry->name, ".TB2") != NULL && findCachedPatch(entry->name) < 0 && next == 0)
+          next = neighbour[i];
+      }
+    }
+    if (next == 0 || !openDirEntry(&prefetchFile, next))
+      return;
+    prefetchSlot = claimCachedPatch(dirIndex[next - 1].name);
+    if (prefetchSlot < 0) // a morph has both entries, nothing to prefetch into
+    {
+      prefetchFile.close();
+      return;
+    }
+    if (!openPatchReader(&prefetchReader, &prefetchFile, prefetchSlot, false)) // spread over loop passes, so no multi-block reads
+    {
+      prefetchFile.close();
+      patchCache[prefetchSlot].name[0] = 0;
+      prefetchSlot = -1;
+      return;
+    }
+  }
+
+  int result = readPatchStep(&prefetchReader);
+  if (result != 1)
+  {
+    prefetchFile.close();
+    if (result == 0)
+      finishCachedPatch(prefetchSlot);
+    else
+      patchCache[prefetchSlot].name[0] = 0;
+    prefetchSlot = -1;
   }
-  file.close();
-  synthPatchLoaded = true;
-  loadRampUp = true;
 }
 
 void setFolder()
 {
   dirCount = 0;
   dirChecked = false;
+  dirIndexValid = false;
   switch (inFolder)
   {
   case true:
     inFolder = false;
+    currentFolder[0] = 0;
     sd.chdir(); // change current directory to root
     sd.vwd()->rewind();
     clearJust();
@@ -3942,6 +5165,7 @@ void setFolder()
 
   case false:
     inFolder = true;
+    strcpy(currentFolder, folderName);
     sd.chdir(folderName); // change current directory to folderName
     sd.vwd()->rewind();
     clearJust();
@@ -3952,19 +5176,8 @@ void setFolder()
 
 void getSynthPatch()
 {
-  while (tempCount < dirChoice && (file.openNext(sd.vwd(), O_READ)))
-  {
-    tempCount++;
-    file.getFilename(fileName);
-    if (file.isDir())
-    {
-      folder = true;
-      file.getFilename(folderName);
-    }
-    else
-      folder = false;
-    file.close();
-  }
+  if (tempCount != dirChoice)
+    selectDirChoice();
   if (tempCount == dirChoice)
   {
     lcd.setCursor(0, 1);
@@ -3986,19 +5199,10 @@ void saveSynthPatch()
 {
   if (dirCount == 0 && dirChecked == false)
   {
-    static uint16_t tempCount = 0;
-    while (file.openNext(sd.vwd(), O_READ))
-    {
-      file.close();
-      dirCount++;
-    }
-    dirChoice = 0;
-    sd.vwd()->rewind();
-    dirChecked = true;
-    valueChange = true;
-    if (dirCount < 98)
+    getDirCount();
+    numberName = (slotStoreName() != NULL) ? firstFreeSlot() + 1 : dirCount + 1; // the first empty slot, or the next number
+    if (numberName > 0 && numberName < 99)
     {
-      numberName = dirCount + 1;
       if (numberName < 10)
       {
         sprintf(saveName, "0%d.TB2", numberName);
@@ -4022,20 +5226,8 @@ void saveSynthPatch()
 
   else
   {
-    while (tempCount < dirChoice)
-    {
-      file.openNext(sd.vwd(), O_READ);
-      tempCount++;
-      file.getFilename(fileName);
-      if (file.isDir())
-      {
-        folder = true;
-        file.getFilename(folderName);
-      }
-      else
-        folder = false;
-      file.close();
-    }
+    if (tempCount != dirChoice)
+      selectDirChoice();
     if (tempCount == dirChoice)
     {
       lcd.setCursor(0, 1);
@@ -4074,19 +5266,10 @@ void saveSeqBank()
 {
   if (dirCount == 0 && dirChecked == false)
   {
-    static uint16_t tempCount = 0;
-    while (file.openNext(sd.vwd(), O_READ))
-    {
-      file.close();
-      dirCount++;
-    }
-    dirChoice = 0;
-    sd.vwd()->rewind();
-    dirChecked = true;
-    valueChange = true;
-    if (dirCount < 98)
+    getDirCount();
+    numberName = (slotStoreName() != NULL) ? firstFreeSlot() + 1 : dirCount + 1; // the first empty slot, or the next number
+    if (numberName > 0 && numberName < 99)
     {
-      numberName = dirCount + 1;
       if (numberName < 10)
       {
         sprintf(saveName, "0%d.SEQ", numberName);
@@ -4110,20 +5293,8 @@ void saveSeqBank()
 
   else
   {
-    while (tempCount < dirChoice)
-    {
-      file.openNext(sd.vwd(), O_READ);
-      tempCount++;
-      file.getFilename(fileName);
-      if (file.isDir())
-      {
-        folder = true;
-        file.getFilename(folderName);
-      }
-      else
-        folder = false;
-      file.close();
-    }
+    if (tempCount != dirChoice)
+      selectDirChoice();
     if (tempCount == dirChoice)
     {
       lcd.setCursor(0, 1);
@@ -4138,59 +5309,100 @@ void saveSeqBank()
 
 void saveBank()
 {
-  file.open(fileName, O_RDWR | O_CREAT); // create file if it doesn't exist and open the file for write
-  // PACK THE BUFFER WITH CURRENT SEQUENCES
-  for (byte i = 0; i < 8; i++) // for each of the 8 sequences
-  {
-    for (byte j = 0; j < 4; j++) // for each of the 4 voices
-    {
-      for (byte k = 0; k < 16; k++) // NOTE VALUES for each of the 16 steps
-        seqBankBuffer[(i * 186) + (j * 16) + k] = seq[i].voice[j][k];
-    }
-    for (byte m = 0; m < 16; m++) // TIES for each of the 16 steps
-      seqBankBuffer[(i * 186) + 64 + m] = seq[i].tie[m];
-    for (byte n = 0; n < 16; n++) // MUTES for each of the 16 steps
-      seqBankBuffer[(i * 186) + 80 + n] = seq[i].mute[n];
-    for (byte o = 0; o < 16; o++) // VELOCITY for each of the 16 steps
-      seqBankBuffer[(i * 186) + 96 + o] = seq[i].velocity[o];
-    for (byte p = 0; p < 4; p++) // CC NUMBER for each of the 4 controllers
-      seqBankBuffer[(i * 186) + 112 + p] = seq[i].controlNum[p];
-    for (byte q = 0; q < 4; q++) // for each of the 4 controllers
-    {
-      for (byte r = 0; r < 16; r++) // CC VALUE for each of the 16 steps
-        seqBankBuffer[(i * 186) + 116 + (q * 16) + r] = seq[i].controlValue[q][r];
-    }
-    seqBankBuffer[(i * 186) + 180] = seq[i].noteDur;       // NOTE DURATION
-    seqBankBuffer[(i * 186) + 181] = seq[i].divSelection;  // TEMPO DIVISION
-    seqBankBuffer[(i * 186) + 182] = seq[i].patternLength; // PATTERN LENGTH
-    seqBankBuffer[(i * 186) + 183] = seq[i].transpose;     // TRANSPOSE VALUE
-    seqBankBuffer[(i * 186) + 184] = seq[i].swing;         // SWING AMOUNT
-    seqBankBuffer[(i * 186) + 185] = seq[i].bpm;           // TEMPO
-  }
-  seqBankBuffer[1488] = bankMode;
-  for (int s = 1489; s < 1600; s++)
-    seqBankBuffer[s] = 0; // write zeros for padding in case we need it for future use
-  // WRITE TO SD
-  if (file.write(seqBankBuffer, 6400) != -1) // note - we are writing 1600 4 byte ints from the patch buffer to 6400 bytes on the SD
+  if (slotStoreName() == NULL)
+    dirIndexValid = false; // the file may be new - a slot is renamed in place
+  writeFlashTagged(FLASH_BANK, 0, "TB2S", SEQ_BANK_FORMAT, writeBankRecords); // the current bank is restored from flash at boot
+  if (saveTaggedFile(fileName, "TB2S", SEQ_BANK_FORMAT, SEQ_BANK_BLOCKS, writeBankRecords))
   {
-    if (file.sync())
+    lcd.setCursor(4, 1);
+    lcd.print("Saved!      ");
+  }
+}
+
+void writeBankRecords(patchWriter *writer)
+{
+  byte record[SEQ_PATTERN_HEAD + 3];
+  // BANK MODE
+  record[0] = SEQ_TAG_MODE;
+  record[1] = 1;
+  record[2] = 0;
+  record[3] = bankMode;
+  writePatchBytes(writer, record, 4);
+  // PATTERNS - only the ones in use
+  for (byte p = 0; p < SEQ_PATTERNS; p++)
+  {
+    if (seqPatternEmpty(p))
+      continue;
+    byte steps = seq[p].patternLength; // and any steps past the end that still hold notes
+    for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
+    {
+      if (seq[p].bar[b] != NO_BAR)
+        steps = max(steps, (b + 1) * SEQ_BAR_STEPS);
+    }
+    uint16_t length = SEQ_PATTERN_HEAD + (steps * 6);
+    record[0] = SEQ_TAG_PATTERN;
+    record[1] = length & 0xFF;
+    record[2] = length >> 8;
+    record[3] = p;
+    record[4] = steps;
+    record[5] = seq[p].patternLength;
+    record[6] = seq[p].divSelection;
+    record[7] = seq[p].transpose;
+    record[8] = seq[p].noteDur & 0xFF;
+    record[9] = seq[p].noteDur >> 8;
+    record[10] = seq[p].swing & 0xFF;
+    record[11] = seq[p].swing >> 8;
+    record[12] = seq[p].bpm & 0xFF;
+    record[13] = seq[p].bpm >> 8;
+    for (byte q = 0; q < 4; q++)
+      record[14 + q] = seq[p].controlNum[q];
+    writePatchBytes(writer, record, SEQ_PATTERN_HEAD + 3);
+    for (byte step = 0; step < steps; step++) // 4 notes, velocity and the tie, mute and accent bits
+    {
+      for (byte v = 0; v < 4; v++)
+        record[v] = seqNote(p, v, step);
+      record[4] = seqVelocity(p, step);
+      record[5] = seqFlag(p, step, SEQ_TIE) | (seqFlag(p, step, SEQ_MUTE) << 1) | (seqFlag(p, step, SEQ_ACCENT) << 2);
+      writePatchBytes(writer, record, 6);
+    }
+  }
+  // CC VALUES - pattern, step, lane and value for each
+  uint16_t events = writeSeqCCEvents(NULL);
+  record[0] = SEQ_TAG_CC;
+  record[1] = (events * 4) & 0xFF;
+  record[2] = (events * 4) >> 8;
+  writePatchBytes(writer, record, 3);
+  writeSeqCCEvents(writer);
+}
+
+uint16_t writeSeqCCEvents(patchWriter *writer) // returns the number of values, a NULL writer only counts
+{
+  uint16_t events = 0;
+  for (byte p = 0; p < SEQ_PATTERNS; p++)
+  {
+    for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
     {
-      lcd.setCursor(4, 1);
-      lcd.print("Saved!      ");
+      for (byte lane = 0; lane < 4; lane++)
+      {
+        seqBlock *block = seqLane(p, b * SEQ_BAR_STEPS, SEQ_LANE_CC + lane, false);
+        for (byte i = 0; i < SEQ_BAR_STEPS && block != NULL; i++)
+        {
+          if (block->value[i] == 255)
+            continue;
+          byte event[4] = {p, (byte)(b * SEQ_BAR_STEPS + i), lane, block->value[i]};
+          if (writer != NULL)
+            writePatchBytes(writer, event, 4);
+          events++;
+        }
+      }
     }
   }
-  file.close();
+  return events;
 }
 
 void loadBank()
 {
-  file.open(fileName);
-  if (file.read(seqBankBuffer, 6400) == 6400) // note - we are reading 6400 bytes to a buffer of 1600 4 byte ints
-  {
-    // we update the buffer with the sequence
-    // but we only want to unpack it if we hit the enter key with unpackSeqBankBuffer()
-  }
-  file.close();
+  // nothing is read while browsing - the file goes straight to the sequences if we hit the enter key with unpackSeqBank()
   seqBankLoaded = true;
 }
 
@@ -4198,88 +5410,272 @@ void getSeqBank()
 {
   if (dirCount == 0 && dirChecked == false)
   {
-    static uint16_t tempCount = 0;
-    while (file.openNext(sd.vwd(), O_READ))
+    getDirCount();
+  }
+
+  else
+  {
+    if (tempCount != dirChoice)
+      selectDirChoice();
+    if (tempCount == dirChoice)
     {
-      file.close();
-      dirCount++;
+      lcd.setCursor(0, 1);
+      lcd.print("    ");
+      lcd.print(fileName);
+      if (folder)
+        arrow(strlen(fileName) + 4, 1);
+      lcd.print("            "); // sloppy way to clear excess characters
     }
-    dirChoice = 0;
-    sd.vwd()->rewind();
-    dirChecked = true;
-    valueChange = true;
+    if (!seqBankLoaded)
+    {
+      if (checkExtension(".SEQ"))
+        loadBank();
+    }
+  }
+}
+
+void setSeqBankValue(int index, int value) // the int at this position in a legacy .SEQ file, into the current group
+{
+  if (index >= 1488)
+  {
+    if (index == 1488)
+      bankMode = value;
+    return; // zeros for padding
+  }
+  byte pattern = (seqGroup * 8) + (index / 186);
+  sequence *s = &seq[pattern];
+  int i = index % 186;
+  if (i < 64) // NOTE VALUES for each of the 4 voices and 16 steps
+    setSeqNote(pattern, i / 16, i % 16, value);
+  else if (i < 80) // TIES for each of the 16 steps
+    setSeqFlag(pattern, i - 64, SEQ_TIE, value);
+  else if (i < 96) // MUTES for each of the 16 steps
+    setSeqFlag(pattern, i - 80, SEQ_MUTE, value);
+  else if (i < 112) // VELOCITY for each of the 16 steps
+    setSeqVelocity(pattern, i - 96, value);
+  else if (i < 116) // CC NUMBER for each of the 4 controllers
+    s->controlNum[i - 112] = value;
+  else if (i < 180) // CC VALUE for each of the 4 controllers and 16 steps
+    setSeqControlValue(pattern, (i - 116) / 16, (i - 116) % 16, value);
+  else
+  {
+    switch (i)
+    {
+    case 180:
+      s->noteDur = value; // NOTE DURATION
+      break;
+    case 181:
+      s->divSelection = value; // TEMPO DIVISION
+      break;
+    case 182:
+      s->patternLength = value; // PATTERN LENGTH
+      if (seqStep >= s->patternLength)
+        seqStep = 0;
+      break;
+    case 183:
+      s->transpose = value; // TRANSPOSE VALUE
+      break;
+    case 184:
+      s->swing = value; // SWING AMOUNT
+      break;
+    case 185:
+      s->bpm = value; // TEMPO
+      break;
+    }
+  }
+}
+
+boolean unpackSeqBank() // false if the file isn't a bank
+{
+  patchReader reader;
+  boolean loaded = false;
+  unsigned long started = micros();
+  if (!openDirChoice())
+    return false;
+  reader.direct = false;
+  if (sdBlockIO)
+    beginBlockRead(&reader, &file);
+  if (readTaggedHeader(&reader, &file, "TB2S"))
+    loaded = readBankRecords(&reader);
+  else if (file.fileSize() == SEQ_BANK_INTS * 4)
+  {
+    // CONVERT A LEGACY BANK - its 8 sequences go to the current group, a block at a time
+    endBlockRead(&reader); // the converter reads through the file system
+    file.seekSet(0);
+    noteRelease();
+    for (byte p = 0; p < 8; p++)
+      resetSeqPattern((seqGroup * 8) + p);
+    seqPoolFull = false;
+    for (int start = 0; start < SEQ_BANK_INTS; start += SD_SCRATCH)
+    {
+      int count = file.read(sdScratch, min(SEQ_BANK_INTS - start, SD_SCRATCH) * 4) / 4;
+      for (int i = 0; i < count; i++)
+        setSeqBankValue(start + i, sdScratch[i]);
+      if (count < SD_SCRATCH)
+        break;
+    }
+    loaded = !seqPoolFull; // the other groups left too little of the pool - the steps that fitted stay
   }
+  endBlockRead(&reader);
+  file.close();
+  sdLoadTime[sdBlockIO] = micros() - started;
+  return loaded;
+}
 
-  else
-  {
-    while (tempCount < dirChoice)
-    {
-      file.openNext(sd.vwd(), O_READ);
-      tempCount++;
-      file.getFilename(fileName);
-      if (file.isDir())
+boolean seqBankFits(patchReader *reader) // count the bars and blocks the bank's records take, then rewind - false if they're more than the pools hold
+{
+  uint32_t barNeeded[(SEQ_PATTERNS * 4 + 31) / 32];
+  uint32_t ccNeeded[(SEQ_PATTERNS * 16 + 31) / 32]; // a bit per pattern, bar and CC lane - the values come in any order
+  memset(barNeeded, 0, sizeof(barNeeded));
+  memset(ccNeeded, 0, sizeof(ccNeeded));
+  uint16_t blocks = 0;
+  uint32_t length = reader->remaining;
+  while ((reader->remaining > 0 || reader->used < reader->filled) && !reader->failed)
+  {
+    byte tag = readPatchByte(reader);
+    uint16_t recordLength = readPatchByte(reader);
+    recordLength |= readPatchByte(reader) << 8;
+    uint32_t end = reader->position + recordLength;
+    if (tag == SEQ_TAG_PATTERN)
+    {
+      byte p = readPatchByte(reader) % SEQ_PATTERNS;
+      byte steps = readPatchByte(reader);
+      steps = min(steps, SEQ_MAX_STEPS);
+      for (byte i = 2; i < SEQ_PATTERN_HEAD; i++) // the settings
+        readPatchByte(reader);
+      uint16_t lanes[SEQ_MAX_STEPS / SEQ_BAR_STEPS] = {0, 0, 0, 0}; // a bit for each lane in use, per bar
+      for (byte step = 0; step < steps && reader->position + 6 <= end; step++)
+      {
+        byte b = step / SEQ_BAR_STEPS;
+        for (byte v = 0; v < 4; v++)
+        {
+          if ((int8_t)readPatchByte(reader) != NOTE_OFF_PACKED)
+            bitSet(lanes[b], v);
+        }
+        if (readPatchByte(reader) != 255)
+          bitSet(lanes[b], SEQ_LANE_VELOCITY);
+        if (readPatchByte(reader) & 7)
+          bitSet(lanes[b], SEQ_LANE_FLAGS);
+      }
+      for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
       {
-        folder = true;
-        file.getFilename(folderName);
+        for (byte l = 0; l < SEQ_LANES; l++)
+          blocks += bitRead(lanes[b], l);
+        if (lanes[b] != 0)
+          bitSet(barNeeded[(p * 4 + b) / 32], (p * 4 + b) % 32);
       }
-      else
-        folder = false;
-      file.close();
-    }
-    if (tempCount == dirChoice)
-    {
-      lcd.setCursor(0, 1);
-      lcd.print("    ");
-      lcd.print(fileName);
-      if (folder)
-        arrow(strlen(fileName) + 4, 1);
-      lcd.print("            "); // sloppy way to clear excess characters
     }
-    if (!seqBankLoaded)
+    else if (tag == SEQ_TAG_CC)
     {
-      if (checkExtension(".SEQ"))
-        loadBank();
+      while (reader->position + 4 <= end && !reader->failed)
+      {
+        byte p = readPatchByte(reader);
+        byte step = readPatchByte(reader);
+        byte lane = readPatchByte(reader);
+        byte value = readPatchByte(reader);
+        if (p >= SEQ_PATTERNS || step >= SEQ_MAX_STEPS || lane >= 4 || value == 255)
+          continue;
+        uint16_t bar = p * 4 + step / SEQ_BAR_STEPS;
+        if (!bitRead(ccNeeded[(bar * 4 + lane) / 32], (bar * 4 + lane) % 32))
+        {
+          bitSet(ccNeeded[(bar * 4 + lane) / 32], (bar * 4 + lane) % 32);
+          bitSet(barNeeded[bar / 32], bar % 32);
+          blocks++;
+        }
+      }
     }
+    while (reader->position < end && !reader->failed)
+      readPatchByte(reader);
   }
+  uint16_t bars = 0;
+  for (uint16_t b = 0; b < SEQ_PATTERNS * 4; b++)
+    bars += bitRead(barNeeded[b / 32], b % 32);
+  if (bars > SEQ_BARS || blocks > SEQ_BLOCKS)
+    seqPoolFull = true;
+  return (!reader->failed && !seqPoolFull && restartTaggedFile(reader, length));
 }
 
-void unpackSeqBankBuffer()
+boolean readBankRecords(patchReader *reader) // straight to the sequences - the bank is checked first, so a bad one, or one too big for the pool, leaves them alone
 {
-  // UNPACK THE BUFFER TO CURRENT SEQUENCES
-  for (byte i = 0; i < 8; i++) // for each of the 8 sequences
+  seqPoolFull = false;
+  if (verifyTaggedFile(reader) && seqBankFits(reader))
   {
-    for (byte j = 0; j < 4; j++) // for each of the 4 voices
-    {
-      for (byte k = 0; k < 16; k++) // NOTE VALUES for each of the 16 steps
-        seq[i].voice[j][k] = seqBankBuffer[(i * 186) + (j * 16) + k];
-    }
-    for (byte m = 0; m < 16; m++) // TIES for each of the 16 steps
-      seq[i].tie[m] = seqBankBuffer[(i * 186) + 64 + m];
-    for (byte n = 0; n < 16; n++) // MUTES for each of the 16 steps
-      seq[i].mute[n] = seqBankBuffer[(i * 186) + 80 + n];
-    for (byte o = 0; o < 16; o++) // VELOCITY for each of the 16 steps
-      seq[i].velocity[o] = seqBankBuffer[(i * 186) + 96 + o];
-    for (byte p = 0; p < 4; p++) // CC NUMBER for each of the 4 controllers
-      seq[i].controlNum[p] = seqBankBuffer[(i * 186) + 112 + p];
-    for (byte q = 0; q < 4; q++) // for each of the 4 controllers
-    {
-      for (byte r = 0; r < 16; r++) // CC VALUE for each of the 16 steps
-        seq[i].controlValue[q][r] = seqBankBuffer[(i * 186) + 116 + (q * 16) + r];
+    noteRelease();
+    for (byte p = 0; p < SEQ_PATTERNS; p++)
+      resetSeqPattern(p);
+    clearSeqPool();
+    while (reader->remaining > 0 || reader->used < reader->filled)
+    {
+      byte tag = readPatchByte(reader);
+      uint16_t length = readPatchByte(reader);
+      length |= readPatchByte(reader) << 8;
+      uint32_t end = reader->position + length;
+      if (tag == SEQ_TAG_MODE)
+        bankMode = readPatchByte(reader);
+      else if (tag == SEQ_TAG_PATTERN)
+      {
+        byte p = readPatchByte(reader) % SEQ_PATTERNS;
+        byte steps = readPatchByte(reader);
+        byte patternLength = readPatchByte(reader);
+        steps = min(steps, SEQ_MAX_STEPS);
+        seq[p].patternLength = constrain(patternLength, 1, SEQ_MAX_STEPS);
+        seq[p].divSelection = readPatchByte(reader);
+        seq[p].transpose = (int8_t)readPatchByte(reader);
+        seq[p].noteDur = readPatchByte(reader);
+        seq[p].noteDur |= readPatchByte(reader) << 8;
+        seq[p].swing = readPatchByte(reader);
+        seq[p].swing |= readPatchByte(reader) << 8;
+        seq[p].bpm = readPatchByte(reader);
+        seq[p].bpm |= readPatchByte(reader) << 8;
+        for (byte q = 0; q < 4; q++)
+          seq[p].controlNum[q] = readPatchByte(reader);
+        for (byte step = 0; step < steps && reader->position + 6 <= end; step++)
+        {
+          for (byte v = 0; v < 4; v++)
+          {
+            int8_t note = readPatchByte(reader);
+            setSeqNote(p, v, step, (note == NOTE_OFF_PACKED) ? 255 : note);
+          }
+          setSeqVelocity(p, step, readPatchByte(reader));
+          byte flags = readPatchByte(reader);
+          setSeqFlag(p, step, SEQ_TIE, bitRead(flags, 0));
+          setSeqFlag(p, step, SEQ_MUTE, bitRead(flags, 1));
+          setSeqFlag(p, step, SEQ_ACCENT, bitRead(flags, 2));
+        }
+      }
+      else if (tag == SEQ_TAG_CC)
+      {
+        while (reader->position + 4 <= end && !reader->failed)
+        {
+          byte p = readPatchByte(reader);
+          byte step = readPatchByte(reader);
+          byte lane = readPatchByte(reader);
+          byte value = readPatchByte(reader);
+          if (p < SEQ_PATTERNS && step < SEQ_MAX_STEPS && lane < 4)
+            setSeqControlValue(p, lane, step, value);
+        }
+      }
+      while (reader->position < end && !reader->failed) // the rest of the record, or all of an unknown one
+        readPatchByte(reader);
+      if (reader->failed)
+        break;
     }
-    seq[i].noteDur = seqBankBuffer[(i * 186) + 180];       // NOTE DURATION
-    seq[i].divSelection = seqBankBuffer[(i * 186) + 181];  // TEMPO DIVISION
-    seq[i].patternLength = seqBankBuffer[(i * 186) + 182]; // PATTERN LENGTH
-    if (seqStep >= seq[i].patternLength)
+    if (seqStep >= seq[currentSeq].patternLength)
       seqStep = 0;
-    seq[i].transpose = seqBankBuffer[(i * 186) + 183]; // TRANSPOSE VALUE
-    seq[i].swing = seqBankBuffer[(i * 186) + 184];     // SWING AMOUNT
-    seq[i].bpm = seqBankBuffer[(i * 186) + 185];       // TEMPO
+    return true;
   }
-  bankMode = seqBankBuffer[1488];
+  return false;
 }
 
 void loadSettings()
 {
+  if (readFlashRecord(&flashMemory, FLASH_SETTINGS, 0, sdScratch, 400)) // the copy in flash needs no SD read
+  {
+    unpackSettings();
+    return;
+  }
+  if (!sdAvailable)
+    return;
   sd.chdir(); // change current directory to root
   // if we're in the root and we can't open the file, make it with savePreferences()
   if (!file.open("TB2PREFS.set"))
@@ -4288,70 +5684,75 @@ void loadSettings()
   }
   else // load the preferences
   {
-    if (file.read(settingsBuffer, 400) == 400) // note - we are reading 400 bytes to a buffer of 100 4 byte ints
-    {
-      // UNPACK THE BUFFER TO SETTINGS
-      midiOut = settingsBuffer[0];
-      midiChannel = settingsBuffer[2];
-      midiThruType = settingsBuffer[3];
-      checkThru();
-      midiSync = settingsBuffer[4];
-      setSyncType();
-      keysOut = settingsBuffer[5];
-      keyVelocity = settingsBuffer[6];
-      //settingsBuffer[7]
-      //settingsBuffer[8]
-      midiTriggerOut = settingsBuffer[9];
-      midiTriggerChannel = settingsBuffer[10];
-      if (midiTriggerChannel == 0)
-        midiTriggerChannel = 1; // in case preferences have not yet been saved
-      for (int i = 0; i < 8; i++)
-        midiTrigger[i] = settingsBuffer[11 + i];
-      volume = settingsBuffer[19];
-      if (volume == 0)
-        volume = 1023; // in case preferences have not yet been saved
-      else if (volume == 1025)
-        volume = 0;
-    }
+    if (file.read(sdScratch, 400) == 400) // note - we are reading 400 bytes to a buffer of 100 4 byte ints
+      unpackSettings();
     file.close();
   }
 }
 
+int savedSetting(int stored, int current) // a slot added since the file was saved reads 0, keep the value we have
+{
+  if (stored == 0)
+    return current;
+  return (stored == SETTING_ZERO) ? 0 : stored;
+}
+
+void unpackSettings() // UNPACK THE BUFFER TO SETTINGS
+{
+  sdScratch[1] = savedSetting(sdScratch[1], bendRange); // a bend range and patch fade of 0 are both usable, so can't mean unsaved
+  sdScratch[27] = savedSetting(sdScratch[27], patchFadeTime);
+  loadParams(sdScratch, true, true); // an unsaved channel of 0 is constrained to 1
+  loadCCMap(sdScratch);
+  char name[9];
+  unpackName(sdScratch, 20, name); // slots 20 - 23
+  if (name[0] != 0)
+    loadTuning(name);
+  for (int i = 0; i < 8; i++)
+    midiTrigger[i] = sdScratch[11 + i];
+  volume = sdScratch[19];
+  if (volume == 0)
+    volume = 1023; // in case preferences have not yet been saved
+  else if (volume == 1025)
+    volume = 0;
+}
+
 void saveSettings()
 {
 
   // PACK THE BUFFER WITH SEETTINGS
   for (int i = 0; i < 100; i++)
-    settingsBuffer[i] = 0; // clear the buffer
-
-  settingsBuffer[0] = midiOut;
-  settingsBuffer[2] = midiChannel;
-  settingsBuffer[3] = midiThruType;
-  settingsBuffer[4] = midiSync;
-  settingsBuffer[5] = keysOut;
-  settingsBuffer[6] = keyVelocity;
-  //settingsBuffer[7]
-  //settingsBuffer[8]
-  settingsBuffer[9] = midiTriggerOut;
-  settingsBuffer[10] = midiTriggerChannel;
+    sdScratch[i] = 0; // clear the buffer
+
+  saveParams(sdScratch, true);
+  if (bendRange == 0)
+    sdScratch[1] = SETTING_ZERO;
+  if (patchFadeTime == 0)
+    sdScratch[27] = SETTING_ZERO;
+  saveCCMap(sdScratch);
+  packName(sdScratch, 20, tuningName);
   for (int i = 0; i < 8; i++)
-    settingsBuffer[11 + i] = midiTrigger[i];
-  settingsBuffer[19] = (volume > 0) ? volume : 1025;
+    sdScratch[11 + i] = midiTrigger[i];
+  sdScratch[19] = (volume > 0) ? volume : 1025;
+  boolean saved = writeFlashRecord(&flashMemory, FLASH_SETTINGS, 0, sdScratch, 400); // read back first at boot
   file.open("TB2PREFS.set", O_RDWR | O_CREAT); // create file if it doesn't exist and open the file for write
-  if (file.write(settingsBuffer, 400) != -1)   // note - we are writing 100 4 byte ints from the patch buffer to 400 bytes on the SD
+  if (file.write(sdScratch, 400) != -1)   // note - we are writing 100 4 byte ints from the patch buffer to 400 bytes on the SD
   {
     if (file.sync())
-    {
-      lcd.setCursor(0, 1);
-      lcd.print("Settings Saved! ");
-    }
+      saved = true;
   }
   file.close();
+  if (saved)
+  {
+    lcd.setCursor(0, 1);
+    lcd.print("Settings Saved! ");
+  }
 }
 
 void gotoRootDir()
 {
   inFolder = false;
+  dirIndexValid = false;
+  currentFolder[0] = 0;
   sd.chdir(); // change current directory to root
   sd.vwd()->rewind();
 }
@@ -4403,13 +5804,16 @@ void seqNextStep()
     break;
   }
 
-  if (!seq[currentSeq].mute[seqStep] && !seq[currentSeq].tie[seqStep]) // if this step isn't muted or a tie step
+  boolean stepMute = seqFlag(currentSeq, seqStep, SEQ_MUTE);
+  boolean stepTie = seqFlag(currentSeq, seqStep, SEQ_TIE);
+  if (!stepMute && !stepTie) // if this step isn't muted or a tie step
   {
     if (!monoMode)
     {
       for (int i = 0; i < 4; i++)
       {
-        voice[i] = (seq[currentSeq].voice[i][seqStep] != 255) ? seq[currentSeq].voice[i][seqStep] + seq[currentSeq].transpose : 255;
+        int note = seqNote(currentSeq, i, seqStep);
+        voice[i] = (note != 255) ? note + seq[currentSeq].transpose : 255;
         seqMidiOn[i] = voice[i];
         if (voice[i] == 255)
           muteVoice[i] = true;
@@ -4417,7 +5821,8 @@ void seqNextStep()
     }
     else // mono mode
     {
-      voice[0] = (seq[currentSeq].voice[0][seqStep] != 255) ? seq[currentSeq].voice[0][seqStep] + seq[currentSeq].transpose : 255;
+      int note = seqNote(currentSeq, 0, seqStep);
+      voice[0] = (note != 255) ? note + seq[currentSeq].transpose : 255;
       seqMidiOn[0] = voice[0];
       if (voice[0] == 255)
         muteVoice[0] = true;
@@ -4435,32 +5840,100 @@ void seqNextStep()
         }
       }
     }
-    if (!seq[currentSeq].tie[nextStep()])
+    if (!seqFlag(currentSeq, nextStep(), SEQ_TIE))
       seqReleasePulse = (pulseCounter + map(seq[currentSeq].noteDur, 0, 1023, 4, (seqDivision[seq[currentSeq].divSelection]) - 1)) % 96;
 
     if (seqMidiOn[0] != 255)
     {
       noteTrigger();
-      setVeloModulation(seq[currentSeq].velocity[seqStep]);
-      outVelocity = seq[currentSeq].velocity[seqStep];
+      byte stepVelocity = seqFlag(currentSeq, seqStep, SEQ_ACCENT) ? 127 : seqVelocity(currentSeq, seqStep); // accents play at full velocity
+      setVeloModulation(stepVelocity);
+      outVelocity = stepVelocity;
       seqReleased = false;
     }
     seqSendMidiNoteOns = true; // trigger the sending of notes in the loop (can't do it here in the interrupt)
   }
 
-  if (seq[currentSeq].tie[seqStep] && !seq[currentSeq].tie[nextStep()])
+  if (stepTie && !seqFlag(currentSeq, nextStep(), SEQ_TIE))
     seqReleasePulse = (pulseCounter + map(seq[currentSeq].noteDur, 0, 1023, 4, (seqDivision[seq[currentSeq].divSelection]) - 1)) % 96;
 
-  if (seq[currentSeq].mute[seqStep])
+  if (stepMute)
   {
     if (seqReleasePulse != 255)
       seqReleasePulse = (pulseCounter + 1) % 96;
   }
 
-  seqStep = nextStep();
+  // CC LANES - latched here, sent from the loop by seqControlLanes()
+  int followingStep = nextStep();
+  for (byte q = 0; q < 4; q++)
+  {
+    seqCCFrom[q] = seqControlValue(currentSeq, q, seqStep);
+    seqCCTo[q] = seqControlValue(currentSeq, q, followingStep);
+  }
+  seqCCStepStart = millis();
+  seqCCStepLength = max(1UL, (60000UL * seqDivision[seq[currentSeq].divSelection]) / (bpm * 96UL));
+  seqCCLatch++;
+
+  seqStep = followingStep;
   longStep = !longStep;
 }
 
+void seqControlLanes() // send the CC lanes, once per control tick
+{
+  if (!seqRunning || seqCCTick == controlTicks)
+    return;
+  seqCCTick = controlTicks;
+
+  // the clock ISR latches a new step in the middle of the loop, so take a copy that is all from one step
+  // the ISR always runs to the end before the loop carries on, so an unchanged latch count means the copy is whole
+  byte lanesFrom[4];
+  byte lanesTo[4];
+  unsigned long stepStart;
+  unsigned long stepLength;
+  byte latch;
+  do
+  {
+    latch = seqCCLatch;
+    for (byte q = 0; q < 4; q++)
+    {
+      lanesFrom[q] = seqCCFrom[q];
+      lanesTo[q] = seqCCTo[q];
+    }
+    stepStart = seqCCStepStart;
+    stepLength = seqCCStepLength;
+  } while (latch != seqCCLatch);
+
+  unsigned long now = millis();
+  unsigned long elapsed = min(now - stepStart, stepLength);
+  for (byte q = 0; q < 4; q++)
+  {
+    byte number = seq[currentSeq].controlNum[q];
+    byte from = lanesFrom[q];
+    byte to = lanesTo[q];
+    if (number > 127 || from > 127) // lane off, or no value on this step
+      continue;
+
+    byte value = from;
+    if (seqCCGlide && to < 128)
+      value = from + ((int)(to - from) * (long)elapsed) / (long)stepLength;
+    if (value == seqCCSent[q])
+      continue;
+    if (value != from && (now - seqCCSentTime[q]) < SEQ_CC_INTERVAL) // thin out the glide, the step values themselves always go out
+      continue;
+
+    seqCCSent[q] = value;
+    seqCCSentTime[q] = now;
+    if (midiOut)
+      midiA.sendControlChange(number, value, midiChannel);
+    if (seqCCRoute)
+    {
+      byte id = ccParam((midiChannel - 1) & 15, number);
+      if (id != NO_PARAM)
+        queueCC(id, value);
+    }
+  }
+}
+
 int nextStep()
 {
   // deal with seqIncrement that's out of range
@@ -4477,61 +5950,275 @@ int nextStep()
 
 void copySeq() // copy the current sequence to another location
 {
-  for (byte j = 0; j < 4; j++) // for each of the 4 voices
+  if (destinationSeq == sourceSeq)
+    return;
+  freeSeqPattern(destinationSeq);
+  for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++) // NOTES, VELOCITY, TIES, MUTES, ACCENTS and CC VALUES - only the lanes in use
   {
-    for (byte k = 0; k < 16; k++) // NOTE VALUES for each of the 16 steps
-      seq[destinationSeq].voice[j][k] = seq[sourceSeq].voice[j][k];
+    for (byte l = 0; l < SEQ_LANES; l++)
+    {
+      seqBlock *from = seqLane(sourceSeq, b * SEQ_BAR_STEPS, l, false);
+      if (from == NULL)
+        continue;
+      seqBlock *to = seqLane(destinationSeq, b * SEQ_BAR_STEPS, l, true);
+      if (to != NULL)
+        *to = *from;
+    }
   }
-  for (byte m = 0; m < 16; m++) // TIES for each of the 16 steps
-    seq[destinationSeq].tie[m] = seq[sourceSeq].tie[m];
-  for (byte n = 0; n < 16; n++) // MUTES for each of the 16 steps
-    seq[destinationSeq].mute[n] = seq[sourceSeq].mute[n];
-  for (byte o = 0; o < 16; o++) // VELOCITY for each of the 16 steps
-    seq[destinationSeq].velocity[o] = seq[sourceSeq].velocity[o];
   for (byte p = 0; p < 4; p++) // CC NUMBER for each of the 4 controllers
     seq[destinationSeq].controlNum[p] = seq[sourceSeq].controlNum[p];
-  for (byte q = 0; q < 4; q++) // for each of the 4 controllers
-  {
-    for (byte r = 0; r < 16; r++) // CC VALUE for each of the 16 steps
-      seq[destinationSeq].controlValue[q][r] = seq[sourceSeq].controlValue[q][r];
-  }
   seq[destinationSeq].noteDur = seq[sourceSeq].noteDur;             // NOTE DURATION
   seq[destinationSeq].divSelection = seq[sourceSeq].divSelection;   // TEMPO DIVISION
   seq[destinationSeq].patternLength = seq[sourceSeq].patternLength; // PATTERN LENGTH
   seq[destinationSeq].transpose = seq[sourceSeq].transpose;         // TRANSPOSE VALUE
   seq[destinationSeq].swing = seq[sourceSeq].swing;                 // SWING AMOUNT
   seq[destinationSeq].bpm = seq[sourceSeq].bpm;                     // TEMPO
-  copied = true;
 }
 
 void clearSeq()
 {
   noteRelease();
-  for (byte j = 0; j < 4; j++) // for each of the 4 voices
+  resetSeqPattern(currentSeq);
+}
+
+void resetSeqPattern(byte pattern)
+{
+  freeSeqPattern(pattern);     // NOTES, TIES, MUTES, VELOCITY and CC VALUES
+  for (byte p = 0; p < 4; p++) // CC NUMBER for each of the 4 controllers
+    seq[pattern].controlNum[p] = 255;
+  seq[pattern].noteDur = 1023;     // NOTE DURATION
+  seq[pattern].divSelection = 1;   // TEMPO DIVISION
+  seq[pattern].patternLength = 16; // PATTERN LENGTH
+  seq[pattern].transpose = 0;      // TRANSPOSE VALUE
+  seq[pattern].swing = 0;          // SWING AMOUNT
+  seq[pattern].bpm = 120;          // TEMPO
+}
+
+void clearSeqPool() // every pattern back to rests
+{
+  for (byte p = 0; p < SEQ_PATTERNS; p++)
   {
-    for (byte k = 0; k < 16; k++) // NOTE VALUES for each of the 16 steps
-      seq[currentSeq].voice[j][k] = 255;
+    for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
+      seq[p].bar[b] = NO_BAR;
   }
-  for (byte m = 0; m < 16; m++) // TIES for each of the 16 steps
-    seq[currentSeq].tie[m] = 0;
-  for (byte n = 0; n < 16; n++) // MUTES for each of the 16 steps
-    seq[currentSeq].mute[n] = 0;
-  for (byte o = 0; o < 16; o++) // VELOCITY for each of the 16 steps
-    seq[currentSeq].velocity[o] = 255;
-  for (byte p = 0; p < 4; p++) // CC NUMBER for each of the 4 controllers
-    seq[currentSeq].controlNum[p] = 255;
-  for (byte q = 0; q < 4; q++) // for each of the 4 controllers
+  memset(seqBarUsed, 0, sizeof(seqBarUsed));
+  memset(seqBlockUsed, 0, sizeof(seqBlockUsed));
+  seqPoolFull = false;
+}
+
+int claimSeqPool(uint32_t *used, byte size) // the first free entry of the bar or block pool, -1 when it's full
+{
+  for (byte i = 0; i < size; i++)
+  {
+    if (!bitRead(used[i / 32], i % 32))
+    {
+      bitSet(used[i / 32], i % 32);
+      return i;
+    }
+  }
+  seqPoolFull = true;
+  return -1;
+}
+
+byte seqLaneFill(byte lane) // what a block holds before anything is entered
+{
+  if (lane < SEQ_LANE_VELOCITY)
+    return (byte)NOTE_OFF_PACKED;
+  return (lane == SEQ_LANE_FLAGS) ? 0 : 255;
+}
+
+seqBlock *seqLane(byte pattern, int step, byte lane, boolean create) // NULL for a lane of rests, or when the pool is full
+{
+  // the clock ISR reads through here, so a new bar or block is filled before it is linked in
+  byte *bar = &seq[pattern].bar[step / SEQ_BAR_STEPS];
+  if (*bar == NO_BAR)
+  {
+    int b = create ? claimSeqPool(seqBarUsed, SEQ_BARS) : -1;
+    if (b < 0)
+      return NULL;
+    memset(seqBars[b].block, NO_BLOCK, sizeof(seqBars[b].block));
+    *bar = b;
+  }
+  byte *block = &seqBars[*bar].block[lane];
+  if (*block == NO_BLOCK)
+  {
+    int k = create ? claimSeqPool(seqBlockUsed, SEQ_BLOCKS) : -1;
+    if (k < 0)
+    {
+      tidySeqLane(pattern, step, lane); // a bar claimed just now for this lane goes back
+      return NULL;
+    }
+    memset(seqBlocks[k].value, seqLaneFill(lane), sizeof(seqBlocks[k].value));
+    *block = k;
+  }
+  return &seqBlocks[*block];
+}
+
+void tidySeqLane(byte pattern, int step, byte lane) // a lane back to all rests gives its block to the pool, the bar goes with its last block
+{
+  byte *bar = &seq[pattern].bar[step / SEQ_BAR_STEPS];
+  if (*bar == NO_BAR)
+    return;
+  byte *block = &seqBars[*bar].block[lane];
+  if (*block != NO_BLOCK)
+  {
+    for (byte i = 0; i < SEQ_BAR_STEPS; i++)
+    {
+      if (seqBlocks[*block].value[i] != seqLaneFill(lane))
+        return;
+    }
+    byte k = *block;
+    *block = NO_BLOCK;
+    bitClear(seqBlockUsed[k / 32], k % 32);
+  }
+  for (byte l = 0; l < SEQ_LANES; l++)
+  {
+    if (seqBars[*bar].block[l] != NO_BLOCK)
+      return;
+  }
+  byte b = *bar;
+  *bar = NO_BAR;
+  bitClear(seqBarUsed[b / 32], b % 32);
+}
+
+int seqNote(byte pattern, byte v, int step) // relative to middle C, 255 for off
+{
+  seqBlock *block = seqLane(pattern, step, v, false);
+  if (block == NULL || block->note[step % SEQ_BAR_STEPS] == NOTE_OFF_PACKED)
+    return 255;
+  return block->note[step % SEQ_BAR_STEPS];
+}
+
+void setSeqNote(byte pattern, byte v, int step, int note)
+{
+  seqBlock *block = seqLane(pattern, step, v, note != 255);
+  if (block == NULL)
+    return;
+  block->note[step % SEQ_BAR_STEPS] = (note == 255) ? NOTE_OFF_PACKED : constrain(note, -127, 127);
+  if (note == 255)
+    tidySeqLane(pattern, step, v);
+}
+
+byte seqVelocity(byte pattern, int step)
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_VELOCITY, false);
+  return (block != NULL) ? block->value[step % SEQ_BAR_STEPS] : 255;
+}
+
+void setSeqVelocity(byte pattern, int step, byte velocity)
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_VELOCITY, velocity != 255);
+  if (block == NULL)
+    return;
+  block->value[step % SEQ_BAR_STEPS] = velocity;
+  if (velocity == 255)
+    tidySeqLane(pattern, step, SEQ_LANE_VELOCITY);
+}
+
+boolean seqFlag(byte pattern, int step, byte flag) // SEQ_TIE, SEQ_MUTE or SEQ_ACCENT
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_FLAGS, false);
+  return block != NULL && bitRead(block->flag[flag], step % SEQ_BAR_STEPS);
+}
+
+void setSeqFlag(byte pattern, int step, byte flag, boolean on)
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_FLAGS, on);
+  if (block == NULL)
+    return;
+  bitWrite(block->flag[flag], step % SEQ_BAR_STEPS, on);
+  if (!on)
+    tidySeqLane(pattern, step, SEQ_LANE_FLAGS);
+}
+
+byte seqControlValue(byte pattern, byte lane, int step) // 255 for none
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_CC + lane, false);
+  return (block != NULL) ? block->value[step % SEQ_BAR_STEPS] : 255;
+}
+
+void setSeqControlValue(byte pattern, byte lane, int step, byte value) // 255 removes the value
+{
+  seqBlock *block = seqLane(pattern, step, SEQ_LANE_CC + lane, value != 255);
+  if (block == NULL)
+    return;
+  block->value[step % SEQ_BAR_STEPS] = value;
+  if (value == 255)
+    tidySeqLane(pattern, step, SEQ_LANE_CC + lane);
+}
+
+void freeSeqPattern(byte pattern) // give its bars and their blocks back to the pools
+{
+  for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
+  {
+    byte bar = seq[pattern].bar[b];
+    if (bar == NO_BAR)
+      continue;
+    seq[pattern].bar[b] = NO_BAR; // unlinked first, the clock ISR may be reading it
+    for (byte l = 0; l < SEQ_LANES; l++)
+    {
+      byte k = seqBars[bar].block[l];
+      if (k != NO_BLOCK)
+        bitClear(seqBlockUsed[k / 32], k % 32);
+    }
+    bitClear(seqBarUsed[bar / 32], bar % 32);
+  }
+}
+
+boolean seqPatternEmpty(byte pattern) // no steps, CC values or changed settings - not worth saving
+{
+  for (byte b = 0; b < SEQ_MAX_STEPS / SEQ_BAR_STEPS; b++)
+  {
+    if (seq[pattern].bar[b] != NO_BAR)
+      return false;
+  }
+  for (byte p = 0; p < 4; p++)
+  {
+    if (seq[pattern].controlNum[p] != 255)
+      return false;
+  }
+  return (seq[pattern].noteDur == 1023 && seq[pattern].divSelection == 1 && seq[pattern].patternLength == 16 &&
+          seq[pattern].transpose == 0 && seq[pattern].swing == 0 && seq[pattern].bpm == 120);
+}
+
+void setSeqSetting(byte setting, int value) // SEQ_TRANSPOSE, SEQ_LENGTH, SEQ_DURATION or SEQ_SWING of the current pattern, and the buttons' copy
+{
+  sequence *s = &seq[currentSeq];
+  seqEditSetting[setting] = value;
+  switch (setting)
   {
-    for (byte r = 0; r < 16; r++) // CC VALUE for each of the 16 steps
-      seq[currentSeq].controlValue[q][r] = 255;
+  case SEQ_TRANSPOSE:
+    s->transpose = value;
+    break;
+  case SEQ_LENGTH:
+    s->patternLength = value;
+    if (seqEditStep >= s->patternLength)
+      seqEditStep = s->patternLength - 1;
+    break;
+  case SEQ_DURATION:
+    s->noteDur = value;
+    break;
+  case SEQ_SWING:
+    s->swing = value;
+    break;
   }
-  seq[currentSeq].noteDur = 1023;     // NOTE DURATION
-  seq[currentSeq].divSelection = 1;   // TEMPO DIVISION
-  seq[currentSeq].patternLength = 16; // PATTERN LENGTH
-  seq[currentSeq].transpose = 0;      // TRANSPOSE VALUE
-  seq[currentSeq].swing = 0;          // SWING AMOUNT
-  seq[currentSeq].bpm = 120;          // TEMPO
 }
+
+void seqPoolWarning() // tell the user a step couldn't be stored
+{
+  if (!seqPoolFull)
+    return;
+  seqPoolFull = false;
+  lcd.setCursor(0, 1);
+  lcd.print("Pool full!      ");
+}
+
+void editSeqNotes() // the increment buttons work on a copy of the edited step's notes
+{
+  for (byte i = 0; i < 4; i++)
+    seqEditNote[i] = seqNote(currentSeq, i, seqEditStep);
+}
+
 void seqPlayStop()
 {
   seqRunning = !seqRunning;
@@ -4544,6 +6231,11 @@ void seqPlayStop()
   {
     cueNextSeq();
     seqJustStarted = true;
+    for (byte q = 0; q < 4; q++)
+    {
+      seqCCFrom[q] = 255;
+      seqCCSent[q] = 255; // resend every lane's first value
+    }
     if (midiClockOut)
       midiA.sendRealTime(midi::Start); // send a midi clock start signal
   }
@@ -4558,59 +6250,57 @@ void seqPlayStop()
 
 void cueNextSeq()
 {
+  byte group = currentSeq - (currentSeq % 8); // the loops stay within the group of 8 the white keys select
+  byte inGroup = currentSeq % 8;
   switch (bankMode)
   {
   case 0: // do nothing
     break;
-  case 1:                      // loop 2
-    if ((currentSeq % 2) == 0) // for even numbered sequences
+  case 1:                   // loop 2
+    if ((inGroup % 2) == 0) // for even numbered sequences
       selectedSeq = currentSeq + 1;
     else
       selectedSeq = currentSeq - 1;
     break;
   case 2: // loop 4
-    if (currentSeq < 3)
-      selectedSeq = currentSeq + 1;
-    else if (currentSeq == 3)
-      selectedSeq = 0;
-    else if (currentSeq < 7)
+    if (inGroup == 3 || inGroup == 7)
+      selectedSeq = currentSeq - 3;
+    else
       selectedSeq = currentSeq + 1;
-    else if (currentSeq == 7)
-      selectedSeq = 4;
     break;
   case 3:
-    if (currentSeq < 7)
+    if (inGroup < 7)
       selectedSeq = currentSeq + 1;
     else
-      selectedSeq = 0;
+      selectedSeq = group;
     break;
   case 4:
     do
-      selectedSeq = random(0, 8);      // upper bound is not included in random()
-    while (selectedSeq == currentSeq); // if the random function delivers the currentSeq we'll get stuck
+      selectedSeq = group + random(0, 8); // upper bound is not included in random()
+    while (selectedSeq == currentSeq);    // if the random function delivers the currentSeq we'll get stuck
     break;
   }
 }
 
 boolean updateSeqNotes()
 {
-  assignIncrementButtons(&seqEditStep, 0, 15, 1);
+  assignIncrementButtons(&seqEditStep, 0, seq[currentSeq].patternLength - 1, 1);
   if (!midiMode)
   {
     for (byte i = 0; i < 4; i++)
-      seq[currentSeq].voice[i][seqEditStep] = 255;
+      setSeqNote(currentSeq, i, seqEditStep, 255);
     byte useVoice = 0;
     for (byte i = 0; i < 13; i++)
     {
       if (pressed[i] && useVoice < 4)
       {
-        seq[currentSeq].voice[useVoice][seqEditStep] = i;
+        setSeqNote(currentSeq, useVoice, seqEditStep, i);
         useVoice++;
       }
     }
-    seq[currentSeq].velocity[seqEditStep] = keyVelocity;
-    seq[currentSeq].mute[seqEditStep] = 0;
-    seq[currentSeq].tie[seqEditStep] = 0;
+    setSeqVelocity(currentSeq, seqEditStep, keyVelocity);
+    setSeqFlag(currentSeq, seqEditStep, SEQ_MUTE, 0);
+    setSeqFlag(currentSeq, seqEditStep, SEQ_TIE, 0);
     valueChange = true;
     return true;
   }
@@ -4619,19 +6309,19 @@ boolean updateSeqNotes()
     byte voxCounter = 0;
     for (byte i = 0; i < 4; i++)
     {
-      seq[currentSeq].voice[i][seqEditStep] = 255;
+      setSeqNote(currentSeq, i, seqEditStep, 255);
 
       if (voice[i] != 255)
       {
-        seq[currentSeq].voice[voxCounter][seqEditStep] = voice[i];
+        setSeqNote(currentSeq, voxCounter, seqEditStep, voice[i]);
         voxCounter++;
       }
     }
     if (voxCounter != 0)
     {
-      seq[currentSeq].velocity[seqEditStep] = midiVelocity;
-      seq[currentSeq].mute[seqEditStep] = 0;
-      seq[currentSeq].tie[seqEditStep] = 0;
+      setSeqVelocity(currentSeq, seqEditStep, midiVelocity);
+      setSeqFlag(currentSeq, seqEditStep, SEQ_MUTE, 0);
+      setSeqFlag(currentSeq, seqEditStep, SEQ_TIE, 0);
       valueChange = true;
       return true;
     }
@@ -4643,42 +6333,156 @@ boolean updateSeqNotes()
 void clearStep()
 {
   for (byte j = 0; j < 4; j++) // NOTE for each of the 4 voices
-    seq[currentSeq].voice[j][seqEditStep] = 255;
-  // TIE
-  seq[currentSeq].tie[seqEditStep] = 0;
-  // MUTE
-  seq[currentSeq].mute[seqEditStep] = 0;
+    setSeqNote(currentSeq, j, seqEditStep, 255);
+  // TIE, MUTE and ACCENT
+  setSeqFlag(currentSeq, seqEditStep, SEQ_TIE, 0);
+  setSeqFlag(currentSeq, seqEditStep, SEQ_MUTE, 0);
+  setSeqFlag(currentSeq, seqEditStep, SEQ_ACCENT, 0);
   // VELOCITY
-  seq[currentSeq].velocity[seqEditStep] = 255;
+  setSeqVelocity(currentSeq, seqEditStep, 255);
   // CONTROLLERS
   for (byte q = 0; q < 4; q++) // for each of the 4 controllers
-    seq[currentSeq].controlValue[q][seqEditStep] = 255;
+    setSeqControlValue(currentSeq, q, seqEditStep, 255);
 }
 
-// SYNTH.ino
+// SNAPSHOT.ino
+void storeSnapshot(byte n) // the current parameters and user waves - just the parameters if the pool has no room for the waves
+{
+  // the pool entries are worked out first, with this slot's old entries counted as free
+  const uint16_t *table[3] = {nUserTable1, nUserTable2, nUserTable3};
+  int8_t pooled[3] = {-1, -1, -1};
+  boolean claimed[SNAPSHOT_WAVES] = {false};
+  for (byte p = 0; p < SNAPSHOT_WAVES; p++)
+  {
+    for (byte j = 0; j < SNAPSHOTS; j++)
+    {
+      for (byte k = 0; k < 3; k++)
+      {
+        if (j != n && snapshots.slot[j].used && snapshots.slot[j].wave[k] == p)
+          claimed[p] = true;
+      }
+    }
+  }
+  boolean referenced[SNAPSHOT_WAVES];
+  memcpy(referenced, claimed, sizeof(referenced)); // in use before this store
+  for (byte w = 0; w < 3; w++)
+  {
+    for (byte p = 0; p < SNAPSHOT_WAVES && pooled[w] < 0; p++)
+    {
+      if (referenced[p] && memcmp(snapshots.wave[p], table[w], sizeof(snapshots.wave[p])) == 0)
+        pooled[w] = p; // already pooled
+    }
+    for (byte v = 0; v < w && pooled[w] < 0; v++)
+    {
+      if (memcmp(table[v], table[w], sizeof(nUserTable1)) == 0)
+        pooled[w] = pooled[v]; // the same as a wave just placed
+    }
+    for (byte p = 0; p < SNAPSHOT_WAVES && pooled[w] < 0; p++)
+    {
+      if (!claimed[p])
+      {
+        pooled[w] = p;
+        claimed[p] = true;
+      }
+    }
+  }
+  boolean waves = (pooled[0] >= 0 && pooled[1] >= 0 && pooled[2] >= 0); // all three or none, a recall never mixes two sets
 
-// *** WAVE SHAPES ***
+  snapshot *s = &snapshots.slot[n];
+  for (byte i = 0; i < PATCH_CACHE_PARAMS; i++)
+    s->param[i] = 0;
+  saveParams(s->param, false);
+  packName(s->param, 41, tuningName);
+  packName(s->param, 53, wavetableName);
+  s->param[45] = PATCH_VERSION;
+  s->used = waves ? SNAPSHOT_STORED : SNAPSHOT_NO_WAVES;
+  for (byte w = 0; w < 3; w++)
+  {
+    if (waves && !referenced[pooled[w]])
+      memcpy(snapshots.wave[pooled[w]], table[w], sizeof(snapshots.wave[0]));
+    s->wave[w] = waves ? pooled[w] : -1;
+  }
 
-// fill the note table with the phase increment values we require to generate the note
-void createNoteTable(float fSampleRate)
+  snapshotDirty = true;
+  snapshotStoreTime = millis();
+  snapshotSyncOffset = -1; // a sync under way is left unfinished, the last complete copy stays the newest
+}
+
+boolean recallSnapshot(byte n) // false if the slot is empty - a different tuning or wavetable bank is read from the card
+{
+  snapshot *s = &snapshots.slot[n];
+  if (!s->used)
+    return false;
+  stopMorph();
+  handoverSlot = -1; // the snapshot replaces whatever was on its way in
+  handoverDue = false;
+  dropHandover();
+  uint16_t *table[3] = {nUserTable1, nUserTable2, nUserTable3};
+  for (byte w = 0; w < 3; w++)
+  {
+    if (s->wave[w] >= 0)
+      memcpy(table[w], snapshots.wave[s->wave[w]], sizeof(snapshots.wave[0]));
+  }
+  applyPatchParams(s->param, true);
+  return true;
+}
+
+void syncSnapshots() // a page per pass, so the audio and the panel never wait on a whole bank
 {
-  for (uint32_t unMidiNote = 0; unMidiNote < MIDI_NOTES; unMidiNote++)
+  if (!snapshotSync)
+    return;
+  if (snapshotSyncOffset < 0)
+  {
+    if (!snapshotDirty || millis() - snapshotStoreTime < SNAPSHOT_SYNC_DELAY)
+      return;
+    beginFlashRecord(&flashMemory, &snapshotFlash, FLASH_SNAPSHOTS, 0);
+    snapshotDirty = false;
+    snapshotSyncOffset = 0;
+    return;
+  }
+  // whole pages only, so flashPage is free again between passes for the other flash saves
+  uint16_t count = min((uint32_t)FLASH_PAGE, sizeof(snapshots) - snapshotSyncOffset);
+  appendFlashBytes(&snapshotFlash, (const byte *)&snapshots + snapshotSyncOffset, count);
+  snapshotSyncOffset += count;
+  if (snapshotSyncOffset == (int32_t)sizeof(snapshots))
   {
-    float fFrequency = ((pow(2.0, (unMidiNote - 69.0) / 12.0)) * 440.0);
-    nMidiPhaseIncrement[unMidiNote] = fFrequency * TICKS_PER_CYCLE;
+    endFlashRecord(&snapshotFlash);
+    snapshotSyncOffset = -1;
   }
 }
 
-// create the individual samples for our sinewave table
-void createSineTable()
+void loadSnapshots() // the copy in flash, if there is one
 {
-  for (uint32_t nIndex = 0; nIndex < WAVE_SAMPLES; nIndex++)
+  if (!readFlashRecord(&flashMemory, FLASH_SNAPSHOTS, 0, &snapshots, sizeof(snapshots)))
+    memset(&snapshots, 0, sizeof(snapshots));
+}
+
+void showSnapshotExtra() // the group's stored slots, by key
+{
+  lcd.setCursor(8, 1);
+  for (byte i = 0; i < 8; i++)
   {
-    // SINE
-    nSineTable[nIndex] = (uint16_t)(((1 + sin(((2.0 * PI) / WAVE_SAMPLES) * nIndex)) * 4095.0) / 2);
+    byte used = snapshots.slot[(snapshotGroup * 8) + i].used;
+    if (used == SNAPSHOT_NO_WAVES)
+      lcd.print("*"); // stored without its user waves
+    else if (used)
+      lcd.print(i + 1);
+    else
+      lcd.print("-");
   }
 }
 
+// SYNTH.ino
+
+// *** WAVE SHAPES ***
+
+// fill the note table with the phase increment values we require to generate the note
+void createNoteTable()
+{
+  memcpy(nMidiPhaseIncrement, equalTemperament, sizeof(nMidiPhaseIncrement));
+  resetScale(&tuning); // the scale that table is
+}
+
 void createSquareTable(int16_t pw)
 {
   static int16_t lastPw = 127; // don't initialize to 0
@@ -4696,27 +6500,6 @@ void createSquareTable(int16_t pw)
   }
 }
 
-void createSawTable()
-{
-  for (uint32_t nIndex = 0; nIndex < WAVE_SAMPLES; nIndex++)
-  {
-    // SAW
-    nSawTable[nIndex] = (4095 / WAVE_SAMPLES) * nIndex;
-  }
-}
-
-void createTriangleTable()
-{
-  for (uint32_t nIndex = 0; nIndex < WAVE_SAMPLES; nIndex++)
-  {
-    // Triangle
-    if (nIndex < WAVE_SAMPLES / 2)
-      nTriangleTable[nIndex] = (4095 / (WAVE_SAMPLES / 2)) * nIndex;
-    else
-      nTriangleTable[nIndex] = (4095 / (WAVE_SAMPLES / 2)) * (WAVE_SAMPLES - nIndex);
-  }
-}
-
 void clearUserTables()
 {
   for (uint32_t nIndex = 0; nIndex < WAVE_SAMPLES; nIndex++)
@@ -4755,7 +6538,10 @@ void audioHandler()
     switch (voiceSounding[i % 4])
     {
     case true:
-      ulOutput[i] = *(wavePointer[i] + (ulPhaseAccumulator[i] >> 20));
+      if (waveBytes[i] != NULL)
+        ulOutput[i] = waveBytes[i][ulPhaseAccumulator[i] >> 20] << 4; // 8 to 12 bits
+      else
+        ulOutput[i] = *(wavePointer[i] + (ulPhaseAccumulator[i] >> 20));
       break;
     case false:
       ulOutput[i] = 2048; // 2048 is silence
@@ -4836,7 +6622,7 @@ void audioHandler()
   int32_t loadMuteOut = (((gainOut - 2048) * loadRampFactor) >> 10) + 2048;
 
   // volume
-  int32_t volumeOut = (((loadMuteOut - 2048) * volume) >> 10) + 2048;
+  int32_t volumeOut = (((loadMuteOut - 2048) * volumeSlew.current) >> 10) + 2048;
 
   // write to DAC0
   dacc_set_channel_selection(DACC_INTERFACE, 0);
@@ -4846,11 +6632,16 @@ void audioHandler()
   dacc_write_conversion_data(DACC_INTERFACE, volumeOut);
 }
 
+uint32_t pitchToIncrement(int32_t pitch) // through the current note table, see pitchIncrement()
+{
+  return pitchIncrement(nMidiPhaseIncrement, pitch);
+}
+
 void assignVoices()
 {
-  static uint32_t incrementSource[8];
-  static uint32_t incrementCurrent[8];
-  static uint32_t incrementTarget[8];
+  static int32_t pitchSource[8];
+  static int32_t pitchCurrent[8];
+  static int32_t pitchTarget[8];
 
   for (int i = 0; i < 8; i++)
   {
@@ -4858,13 +6649,9 @@ void assignVoices()
     {
       voiceSounding[i % 4] = true;
       if (i < 4)
-      {
-        incrementTarget[i] = nMidiPhaseIncrement[voice[i % 4] + (osc1OctaveOut * 12) + osc1Detune];
-      }
+        pitchTarget[i] = (voice[i % 4] + (osc1OctaveOut * 12) + osc1Detune) << 8;
       else
-      {
-        incrementTarget[i] = nMidiPhaseIncrement[voice[i % 4] + (osc2OctaveOut * 12)] + osc2Detune;
-      }
+        pitchTarget[i] = ((voice[i % 4] + (osc2OctaveOut * 12)) << 8) + osc2Detune;
     }
   }
 
@@ -4872,33 +6659,26 @@ void assignVoices()
   {
     for (byte i = 0; i < 8; i++)
     {
-      incrementCurrent[i] = incrementTarget[i];
-      incrementSource[i] = incrementTarget[i];
+      pitchCurrent[i] = pitchTarget[i];
+      pitchSource[i] = pitchTarget[i];
     }
   }
-  else
-  {
-    for (byte i = 0; i < 8; i++)
-      incrementCurrent[i] = map(millis(), portaStartTime, portaEndTime, incrementSource[i], incrementTarget[i]);
-  }
-
-  if (monoMode && unison)
-  {
-    for (byte i = 0; i < 8; i++)
-    {
-      if (i < 4)
-        incrementCurrent[i] += (uniSpread * i);
-      else
-        incrementCurrent[i] += (uniSpread * (i - 4));
-    }
+  else
+  {
+    for (byte i = 0; i < 8; i++)
+      pitchCurrent[i] = map(millis(), portaStartTime, portaEndTime, pitchSource[i], pitchTarget[i]); // a glide that is even in pitch
   }
-  //MOD detune
-  for (int i = 0; i < 8; i++)
+
+  //MOD detune - everything sums in pitch units
+  int32_t bend = (bendSlew.current * bendRange) >> 5; // 8192 = bendRange semitones
+  int32_t osc1Mod = lfoOsc1Detune + envOsc1Pitch + velOsc1Detune + modVibrato + bend;
+  int32_t osc2Mod = lfoOsc2Detune + envOsc2Pitch + velOsc2Detune + modVibrato + bend;
+  for (byte i = 0; i < 8; i++)
   {
-    if (i < 4)
-      ulPhaseIncrement[i] = constrain(incrementCurrent[i] + lfoOsc1Detune + envOsc1Pitch + velOsc1Detune, 0, 178954880);
-    else
-      ulPhaseIncrement[i] = constrain(incrementCurrent[i] + lfoOsc2Detune + envOsc2Pitch + velOsc2Detune, 0, 178954880);
+    int32_t pitch = pitchCurrent[i] + ((i < 4) ? osc1Mod : osc2Mod);
+    if (monoMode && unison)
+      pitch += (uniSpread * (i % 4)) / 1000; // 10 - 60 pitch units between the unison voices
+    ulPhaseIncrement[i] = pitchToIncrement(pitch);
   }
 }
 
@@ -4930,7 +6710,11 @@ void setOsc1WaveType(int shape)
     case 6: // user3
       wavePointer[i] = &nUserTable3[0];
       break;
+    case 9: // wavetable
+      wavePointer[i] = &nWavetable[0];
+      break;
     }
+    waveBytes[i] = (shape == 8) ? factoryWaves[osc1Factory] : NULL;
   }
 }
 
@@ -4962,7 +6746,11 @@ void setOsc2WaveType(int shape)
     case 6: // user3
       wavePointer[i + 4] = &nUserTable3[0];
       break;
+    case 9: // wavetable
+      wavePointer[i + 4] = &nWavetable[0];
+      break;
     }
+    waveBytes[i + 4] = (shape == 8) ? factoryWaves[osc2Factory] : NULL;
   }
 }
 
@@ -4993,6 +6781,73 @@ void createGainTable()
   }
 }
 
+// TUNING.ino
+// the parsing and the maths are in TB2_Tuning.h, this is the SD side and the incremental rebuild
+void resetTuning() // back to 12-TET, A4 = 440Hz
+{
+  resetScale(&tuning);
+  tuningName[0] = 0;
+  tuningBuildNote = 0; // rebuildTuning() takes it from here
+}
+
+int8_t readTuning(const char *name, scaleTuning *t) // name without the extension - 1 if it was read, 0 if there's no scale, -1 if it's broken
+{
+  char path[22];
+  sprintf(path, "/TUNINGS/%s.SCL", name);
+  if (!tuningFile.open(path, O_READ))
+    return 0;
+  boolean ok = parseScale(tuningFile, t);
+  tuningFile.close();
+  if (!ok)
+    return -1;
+
+  resetKeyboardMap(t); // the keyboard map is optional
+  sprintf(path, "/TUNINGS/%s.KBM", name);
+  if (tuningFile.open(path, O_READ))
+  {
+    if (!parseKeyboardMap(tuningFile, t))
+      t->mapSize = 0;
+    tuningFile.close();
+  }
+  return 1;
+}
+
+boolean loadTuning(const char *name) // a missing scale keeps the current tuning, a broken one resets to 12-TET
+{
+  int8_t read = readTuning(name, &tuning);
+  if (read < 0)
+    resetTuning();
+  if (read <= 0)
+    return false;
+  strncpy(tuningName, name, 8);
+  tuningName[8] = 0;
+  tuningBuildNote = 0;
+  return true;
+}
+
+void rebuildTuning() // called from the loop, a few notes at a time
+{
+  if (tuningBuildNote >= MIDI_NOTES)
+    return;
+  if (tuningBuildNote == 0)
+    tuneReference(&tuning);
+
+  byte last = min(tuningBuildNote + TUNING_NOTES_PER_PASS, MIDI_NOTES);
+  for (; tuningBuildNote < last; tuningBuildNote++)
+    nMidiPhaseIncrement[tuningBuildNote] = tuningIncrement(&tuning, tuningBuildNote); // unmapped keys are 0, silent
+}
+
+void countTunings()
+{
+  tuningCount = countFolderFiles("/TUNINGS", ".SCL");
+}
+
+void getTuningName(int choice) // the name of the choice-th .SCL in /TUNINGS, without the extension
+{
+  if (choice == 0 || !getFolderFileName("/TUNINGS", ".SCL", choice, tuningChoiceName))
+    strcpy(tuningChoiceName, "12-TET");
+}
+
 // UI.ino
 
 // *** LED ***
@@ -5130,6 +6985,21 @@ void updateMenu()
     lcd.setCursor(0, 0);
     lcd.print("MONO & PORTA    ");
     break;
+  case 69:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("FAVOURITES      ");
+    break;
+  case 75:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("MORPH           ");
+    break;
+  case 76:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SNAPSHOTS       ");
+    break;
   case 100:
     clearLCD();
     lcd.setCursor(0, 0);
@@ -5172,6 +7042,13 @@ void updateMenu()
     lcd.setCursor(0, 1);
     lcd.print("Bank Settings   ");
     break;
+  case 240:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SEQUENCER       ");
+    lcd.setCursor(0, 1);
+    lcd.print("CC Lanes        ");
+    break;
   case 300:
     clearLCD();
     lcd.setCursor(0, 0);
@@ -5200,6 +7077,41 @@ void updateMenu()
     lcd.setCursor(0, 1);
     lcd.print("General         ");
     break;
+  case 340:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SETTINGS        ");
+    lcd.setCursor(0, 1);
+    lcd.print("MIDI Learn      ");
+    break;
+  case 350:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SETTINGS        ");
+    lcd.setCursor(0, 1);
+    lcd.print("Tuning          ");
+    break;
+  case 360:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SETTINGS        ");
+    lcd.setCursor(0, 1);
+    lcd.print("Diagnostics     ");
+    break;
+  case 370:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SETTINGS        ");
+    lcd.setCursor(0, 1);
+    lcd.print("SD Timing       ");
+    break;
+  case 380:
+    clearLCD();
+    lcd.setCursor(0, 0);
+    lcd.print("SETTINGS        ");
+    lcd.setCursor(0, 1);
+    lcd.print("Slot Store      ");
+    break;
   }
 }
 
@@ -5210,6 +7122,9 @@ void updateValues()
     arrowAnimation = false;
     uiRefresh = false;
     valueChange = false;
+    if (showParamPage()) // the simple pages are all drawn from the parameter registry
+      return;
+
     switch (menu)
     {
     case 0: // SPLASH/MAIN
@@ -5217,55 +7132,6 @@ void updateValues()
       lcd.print("Main            ");
       break;
 
-    case 10: // OSC1
-      lcd.setCursor(0, 0);
-      lcd.print("Os1 Oct Lvl Det ");
-
-      switch (osc1WaveType)
-      {
-      case 0:
-        lcd.setCursor(0, 1);
-        lcd.print("Sin ");
-        break;
-      case 1:
-        lcd.setCursor(0, 1);
-        lcd.print("Tri ");
-        break;
-      case 2:
-        lcd.setCursor(0, 1);
-        lcd.print("Saw ");
-        break;
-      case 3:
-        lcd.setCursor(0, 1);
-        lcd.print("Squ ");
-        arrow(3, 1);
-        break;
-      case 4:
-        lcd.setCursor(0, 1);
-        lcd.print("Us1 ");
-        arrow(3, 1);
-        break;
-      case 5:
-        lcd.setCursor(0, 1);
-        lcd.print("Us2 ");
-        break;
-      case 6:
-        lcd.setCursor(0, 1);
-        lcd.print("Us3 ");
-        break;
-      case 7:
-        lcd.setCursor(0, 1);
-        lcd.print("Nse ");
-        break;
-      }
-
-      showValue(4, 1, osc1Octave); // octave
-
-      showValue(8, 1, osc1Volume >> 2); // level
-
-      showValue(12, 1, osc1Detune); // detune
-      break;
-
     case 11: // OSCILLATORS - change user waveshape
       lcd.setCursor(0, 0);
       lcd.print("Us1: ");
@@ -5298,54 +7164,6 @@ void updateValues()
       showValue(11, 1, (map(uiPulseWidth, ((WAVE_SAMPLES / 2) - 15) * -1, ((WAVE_SAMPLES / 2) - 15), 0, 255)));
       break;
 
-    case 20: // OSC2
-      lcd.setCursor(0, 0);
-      lcd.print("Os2 Oct Lvl Det ");
-
-      switch (osc2WaveType)
-      {
-      case 0:
-        lcd.setCursor(0, 1);
-        lcd.print("Sin ");
-        break;
-      case 1:
-        lcd.setCursor(0, 1);
-        lcd.print("Tri ");
-        break;
-      case 2:
-        lcd.setCursor(0, 1);
-        lcd.print("Saw ");
-        break;
-      case 3:
-        lcd.setCursor(0, 1);
-        lcd.print("Squ ");
-        arrow(3, 1);
-        break;
-      case 4:
-        lcd.setCursor(0, 1);
-        lcd.print("Us1 ");
-        break;
-      case 5:
-        lcd.setCursor(0, 1);
-        lcd.print("Us2 ");
-        arrow(3, 1);
-        break;
-      case 6:
-        lcd.setCursor(0, 1);
-        lcd.print("Us3 ");
-        break;
-      case 7:
-        lcd.setCursor(0, 1);
-        lcd.print("Nse ");
-        break;
-      }
-      showValue(4, 1, osc2Octave); // octave
-
-      showValue(8, 1, osc2Volume >> 2); // level
-
-      showValue(12, 1, osc2Detune >> 14); // detune
-      break;
-
     case 21: // OSC2 - change user waveshape
       lcd.setCursor(0, 0);
       lcd.print("Us2: ");
@@ -5379,44 +7197,6 @@ void updateValues()
       showValue(11, 1, (map(uiPulseWidth, ((WAVE_SAMPLES / 2) - 15) * -1, ((WAVE_SAMPLES / 2) - 15), 0, 255)));
       break;
 
-    case 30: // FILTER
-      lcd.setCursor(0, 0);
-      lcd.print("Cut Res Typ Byp");
-      showValue(0, 1, filterCutoff);
-      showValue(4, 1, filterResonance);
-      lcd.setCursor(12, 1);
-      switch (fType)
-      {
-      case 0:
-        lcd.setCursor(8, 1);
-        lcd.print("LP  ");
-        break;
-      case 1:
-        lcd.setCursor(8, 1);
-        lcd.print("BP  ");
-        break;
-      case 2:
-        lcd.setCursor(8, 1);
-        lcd.print("HP  ");
-        break;
-      }
-      if (filterBypass)
-      {
-        lcd.print("On ");
-      }
-      else
-        lcd.print("Off");
-      break;
-
-    case 40: // ENVELOPE
-      lcd.setCursor(0, 0);
-      lcd.print("Att Dec Sus Rel ");
-      showValue(0, 1, attackTime >> 2);
-      showValue(4, 1, decayTime >> 2);
-      showValue(8, 1, sustainLevel >> 2);
-      showValue(12, 1, releaseTime >> 2);
-      break;
-
     case 50: // LFO
       lcd.setCursor(0, 0);
       if (!lfoSync)
@@ -5454,6 +7234,11 @@ void updateValues()
         lcd.print("Us3 ");
         arrow(3, 1);
         break;
+      case 7:
+        lcd.setCursor(0, 1);
+        lcd.print("Fac ");
+        arrow(3, 1);
+        break;
       }
 
       if (!lfoSync)
@@ -5485,261 +7270,48 @@ void updateValues()
         lcd.setCursor(12, 1);
         lcd.print("On  ");
       }
-      else // retrigger is false
-      {
-        lcd.setCursor(12, 1);
-        lcd.print("Off ");
-      }
-      break;
-
-    case 51: // LFO - change user waveshape
-      lcd.setCursor(0, 0);
-      lcd.print("Us3: ");
-
-      if (inFolder)
-      {
-        lcd.setCursor(4, 0);
-        lcd.print(folderName);
-        lcd.print("        ");
-        if (justEnteredFolder)
-        {
-          lcd.setCursor(0, 1);
-          lcd.print("Load Wave [P4] ");
-        }
-      }
-      else
-      {
-        lcd.setCursor(4, 0);
-        lcd.print("Root");
-        lcd.print("        ");
-        lcd.setCursor(0, 1);
-        lcd.print("Set Folder [P4] ");
-      }
-      getWaveform();
-      break;
-
-    case 60: // MODULATION
-      static byte lastSource = 255;
-      lcd.setCursor(0, 0);
-      lcd.print("Src Dst Amt     ");
-      switch (source)
-      {
-      case 0: // SOURCE LFO
-        if (lastSource != source)
-        {
-          destination = 0;
-          lcd.setCursor(0, 1);
-          lcd.print("                ");
-          lastSource = source;
-        }
-        lcd.setCursor(0, 1);
-        lcd.print("LFO ");
-
-        switch (destination)
-        {
-        case 0:
-          lcd.setCursor(4, 1);
-          lcd.print("Os1 ");
-          showValue(8, 1, lfoOsc1DetuneFactor >> 2);
-          break;
-        case 1:
-          lcd.setCursor(4, 1);
-          lcd.print("Os2 ");
-          showValue(8, 1, lfoOsc2DetuneFactor >> 2);
-          break;
-        case 2:
-          lcd.setCursor(4, 1);
-          lcd.print("Oc1 ");
-          showValue(8, 1, osc1OctaveMod);
-          break;
-        case 3:
-          lcd.setCursor(4, 1);
-          lcd.print("Oc2 ");
-          showValue(8, 1, osc2OctaveMod);
-          break;
-        case 4:
-          lcd.setCursor(4, 1);
-          lcd.print("Cut ");
-          showValue(8, 1, lfoAmount >> 2);
-          break;
-        case 5:
-          lcd.setCursor(4, 1);
-          lcd.print("Amp ");
-          showValue(8, 1, lfoAmpFactor >> 2);
-          break;
-        case 6:
-          lcd.setCursor(4, 1);
-          lcd.print("PWi ");
-          showValue(8, 1, lfoPwFactor >> 2);
-          break;
-        }
-        break;
-
-      case 1: // SOURCE ENVELOPE
-      {
-        if (lastSource != source)
-        {
-          destination = 7;
-          lcd.setCursor(0, 1);
-          lcd.print("                ");
-          lastSource = source;
-        }
-        lcd.setCursor(0, 1);
-        lcd.print("Env ");
-        switch (destination)
-        {
-        case 7:
-          lcd.setCursor(4, 1);
-          lcd.print("Os1 ");
-          showValue(8, 1, envOsc1PitchFactor >> 4);
-          break;
-        case 8:
-          lcd.setCursor(4, 1);
-          lcd.print("Os2 ");
-          showValue(8, 1, envOsc2PitchFactor >> 4);
-          break;
-        case 9:
-          lcd.setCursor(4, 1);
-          lcd.print("Cut ");
-          showValue(8, 1, envFilterCutoffFactor >> 4);
-          break;
-        case 10:
-          lcd.setCursor(4, 1);
-          lcd.print("LRt ");
-          showValue(8, 1, envLfoRate >> 2);
-          break;
-        }
-      }
-      break;
-
-      case 2: // SOURCE VELOCITY
-      {
-        if (lastSource != source)
-        {
-          destination = 11;
-          lcd.setCursor(0, 1);
-          lcd.print("                ");
-          lastSource = source;
-        }
-        lcd.setCursor(0, 1);
-        lcd.print("Vel ");
-        switch (destination)
-        {
-        case 11:
-          lcd.setCursor(4, 1);
-          lcd.print("Os1 ");
-          showValue(8, 1, velOsc1DetuneFactor >> 4);
-          break;
-        case 12:
-          lcd.setCursor(4, 1);
-          lcd.print("Os2 ");
-          showValue(8, 1, velOsc2DetuneFactor >> 4);
-          break;
-        case 13:
-          lcd.setCursor(4, 1);
-          lcd.print("Cut ");
-          showValue(8, 1, velCutoffFactor >> 2);
-          break;
-        case 14:
-          lcd.setCursor(4, 1);
-          lcd.print("Amp ");
-          showValue(8, 1, velAmpFactor >> 2);
-          break;
-        case 15:
-          lcd.setCursor(4, 1);
-          lcd.print("PWi ");
-          showValue(8, 1, velPwFactor);
-          break;
-        case 16:
-          lcd.setCursor(4, 1);
-          lcd.print("LRt ");
-          showValue(8, 1, velLfoRateFactor >> 2);
-          break;
-        }
-      }
-      break;
+      else // retrigger is false
+      {
+        lcd.setCursor(12, 1);
+        lcd.print("Off ");
       }
       break;
 
-    case 65: // SHAPER & GAIN
+    case 51: // LFO - change user waveshape
       lcd.setCursor(0, 0);
-      lcd.print("Shp Amt Bit Gain");
-      lcd.setCursor(0, 1);
-      lcd.print("                ");
-      lcd.setCursor(0, 1);
-      if (shaperType == 0)
-        lcd.print("Off ");
+      lcd.print("Us3: ");
+
+      if (inFolder)
+      {
+        lcd.setCursor(4, 0);
+        lcd.print(folderName);
+        lcd.print("        ");
+        if (justEnteredFolder)
+        {
+          lcd.setCursor(0, 1);
+          lcd.print("Load Wave [P4] ");
+        }
+      }
       else
-        lcd.print(shaperType);
-      lcd.setCursor(4, 1);
-      switch (shaperType)
       {
-      case 0:
-        lcd.print("n/a ");
-        break;
-      case 1:
-        showValue(4, 1, (int)(waveShapeAmount * 255));
-        break;
-      case 2:
-        showValue(4, 1, waveShapeAmount2);
-        break;
+        lcd.setCursor(4, 0);
+        lcd.print("Root");
+        lcd.print("        ");
+        lcd.setCursor(0, 1);
+        lcd.print("Set Folder [P4] ");
       }
-      //lcd.setCursor(8, 1);
-      showValue(8, 1, bitMuncher);
-      //lcd.setCursor(12, 1);
-      showValue(12, 1, (int)((gainAmount - 1) * 255));
+      getWaveform();
       break;
 
-    case 68: // MONO & PORTA
+    case 69: // FAVOURITES - patches kept in flash
       lcd.setCursor(0, 0);
-      lcd.print("Mon Uni Spr Por ");
-      lcd.setCursor(0, 1);
-      lcd.print("                ");
+      lcd.print("Fav Do          ");
       lcd.setCursor(0, 1);
-      if (!monoMode)
-        lcd.print("Off n/a n/a ");
-      else
-      {
-        lcd.setCursor(0, 1);
-        switch (monoMode)
-        {
-        case 1:
-          lcd.print(" Hi ");
-          break;
-        case 2:
-          lcd.print("Low ");
-          break;
-        case 3:
-          lcd.print("Lst ");
-          break;
-        }
-        lcd.setCursor(4, 1);
-        switch (unison)
-        {
-        case 0:
-          lcd.print("Off ");
-          break;
-        case 1:
-          lcd.print("2Vc ");
-          break;
-        case 2:
-          lcd.print("3Vc ");
-          break;
-        case 3:
-          lcd.print("4Vc ");
-          break;
-        }
-        lcd.setCursor(8, 1);
-        if (unison)
-          lcd.print(map(uniSpread, 10000, 60000, 0, 255));
-        else
-          lcd.print("n/a ");
-      }
-      lcd.setCursor(12, 1);
-      if (portamento > 0)
-        lcd.print(portamento);
-      else
-        lcd.print("Off");
+      lcd.print(flashChoice + 1);
+      lcd.print("   ");
+      lcd.setCursor(4, 1);
+      lcd.print(flashAction ? "Save " : "Load ");
+      lcd.print(findFlashRecord(&flashMemory, FLASH_PATCHES, flashChoice) != NULL ? "Used   " : "Empty  ");
       break;
 
     case 70: // SYNTH LOAD
@@ -5789,83 +7361,6 @@ void updateValues()
       saveSynthPatch();
       break;
 
-    case 100: // ARP PAGE 1
-      lcd.setCursor(0, 0);
-      lcd.print("Arp Div Dur BPM ");
-      lcd.setCursor(0, 1);
-      switch (arp)
-      {
-      case 0:
-        lcd.print("Off ");
-        break;
-      case 1:
-        lcd.print("On  ");
-        break;
-      }
-      lcd.setCursor(4, 1);
-      switch (arpDivSelection)
-      {
-      case 0:
-        lcd.print(" 4  ");
-        break;
-      case 1:
-        lcd.print(" 4t ");
-        break;
-      case 2:
-        lcd.print(" 8  ");
-        break;
-      case 3:
-        lcd.print(" 8t ");
-        break;
-      case 4:
-        lcd.print("16  ");
-        break;
-      case 5:
-        lcd.print("16t ");
-        break;
-      case 6:
-        lcd.print("32  ");
-        break;
-      }
-      showValue(8, 1, arpNoteDur);
-      showValue(12, 1, bpm);
-      break;
-
-    case 110: // ARP PAGE 2
-      lcd.setCursor(0, 0);
-      lcd.print("Dir Typ Oct     ");
-      lcd.setCursor(0, 1);
-      switch (arpForward)
-      {
-      case 0:
-        lcd.print("Rev ");
-        break;
-      case 1:
-        lcd.print("Fwd  ");
-        break;
-      }
-      lcd.setCursor(4, 1);
-      switch (arpIncrement)
-      {
-      case 0:
-        lcd.print("Rnd ");
-        break;
-      case 1:
-        lcd.print("1St ");
-        break;
-      case 2:
-        lcd.print("2St ");
-        break;
-      case 3:
-        lcd.print("3St ");
-        break;
-      case 4:
-        lcd.print("2B1 ");
-        break;
-      }
-      showValue(8, 1, arpOctaves);
-      break;
-
     case 200: // SEQ TRIGGER
       lcd.setCursor(0, 0);
       lcd.print("1 2 3 4 5 6 7 8 ");
@@ -5876,11 +7371,11 @@ void updateValues()
         lcd.print("PLAY ");
       if (currentSeq != selectedSeq)
       {
-        lcd.setCursor(selectedSeq * 2 + 1, 0);
+        lcd.setCursor((selectedSeq % 8) * 2 + 1, 0);
         lcd.print((char)127);
       }
-      arrow(currentSeq * 2 + 1, 0);
-      showValue(15, 1, selectedSeq);
+      arrow((currentSeq % 8) * 2 + 1, 0);
+      showValue(15, 1, selectedSeq % 8);
       lcd.setCursor(5, 1);
       switch (seqPlayMode)
       {
@@ -5930,11 +7425,12 @@ void updateValues()
       lcd.print("V1  V2  V3  V4  ");
       for (byte i = 0; i < 4; i++)
       {
-        if (seq[currentSeq].voice[i][seqEditStep] < 255)
+        int note = seqNote(currentSeq, i, seqEditStep);
+        if (note < 255)
         {
           lcd.setCursor(i * 4, 1);
-          lcd.print(noteName[(seq[currentSeq].voice[i][seqEditStep] + 60) % 12]);
-          lcd.print((seq[currentSeq].voice[i][seqEditStep] + 60) / 12 - 1);
+          lcd.print(noteName[(note + 60) % 12]);
+          lcd.print((note + 60) / 12 - 1);
           lcd.print(" ");
         }
         else
@@ -5956,9 +7452,30 @@ void updateValues()
       showValue(12, 1, seq[currentSeq].bpm);
       break;
 
+    case 240: // SEQ CC LANES
+      lcd.setCursor(0, 0);
+      lcd.print("Ln  CC  Gld Rte ");
+      showValue(0, 1, seqCCLane + 1);
+      lcd.print(" ");
+      if (seq[currentSeq].controlNum[seqCCLane] > 127)
+      {
+        lcd.setCursor(4, 1);
+        lcd.print("Off ");
+      }
+      else
+      {
+        showValue(4, 1, seq[currentSeq].controlNum[seqCCLane]);
+        lcd.print(" ");
+      }
+      lcd.setCursor(8, 1);
+      lcd.print(seqCCGlide ? "On  " : "Off ");
+      lcd.setCursor(12, 1);
+      lcd.print(seqCCRoute ? "Both" : "Out ");
+      break;
+
     case 230: // SEQ BANK SETTINGS
       lcd.setCursor(0, 0);
-      lcd.print("Mode            ");
+      lcd.print("Mode       Grp  ");
       lcd.setCursor(0, 1);
       lcd.print("                ");
       lcd.setCursor(0, 1);
@@ -5989,9 +7506,7 @@ void updateValues()
         lcd.setCursor(5, 1);
         lcd.print("No    ");
       }
-      //showValue(4, 1, seq[currentSeq].noteDur >> 2);
-      //showValue(8, 1, seq[currentSeq].swing >> 2);
-      //showValue(12, 1, seq[currentSeq].bpm);
+      showValue(11, 1, seqGroup + 1);
       break;
 
     case 250: // SEQUENCER BANK LOAD
@@ -6041,12 +7556,12 @@ void updateValues()
       saveSeqBank();
       break;
 
-    case 300: // SETTINGS MIDI
+    case 320: // SETTINGS TRIGGER MIDI
       lcd.setCursor(0, 0);
-      lcd.print("Out Chn Thr Sync");
+      lcd.print("Trg Chn No. Note");
       lcd.setCursor(0, 1);
       lcd.print("                ");
-      if (midiOut)
+      if (midiTriggerOut)
       {
         lcd.setCursor(0, 1);
         lcd.print("Yes ");
@@ -6056,83 +7571,116 @@ void updateValues()
         lcd.setCursor(0, 1);
         lcd.print("No  ");
       }
-      showValue(4, 1, midiChannel);
-      lcd.setCursor(8, 1);
-      switch (midiThruType)
-      {
-      case 0:
-        lcd.print("Off ");
-        break;
-      case 1:
-        lcd.print("All ");
-        break;
-      case 2:
-        lcd.print("Clk ");
-        break;
-      }
-      lcd.setCursor(12, 1);
-      switch (midiSync)
-      {
-      case 0:
-        lcd.print("None");
-        break;
-      case 1:
-        lcd.print("Mst");
-        break;
-      case 2:
-        lcd.print("Slv");
-        break;
-      }
+      showValue(4, 1, midiTriggerChannel);
+      showValue(8, 1, editTrigger + 1);
+      showValue(12, 1, midiTrigger[editTrigger]);
       break;
 
-    case 310: // SETTINGS KEYBOARD
+
+    case 340: // SETTINGS MIDI LEARN
+    {
       lcd.setCursor(0, 0);
-      lcd.print("Out Vel         ");
+      lcd.print("Prm CC  Chn Lrn ");
       lcd.setCursor(0, 1);
-      lcd.print("                ");
-      if (keysOut)
+      lcd.print(params[ccLearnParam].name);
+      byte channel;
+      byte number = ccLearned(ccLearnParam, &channel);
+      if (number == NO_PARAM)
       {
-        lcd.setCursor(0, 1);
-        lcd.print("Yes ");
+        lcd.setCursor(4, 1);
+        lcd.print("--  --  ");
       }
       else
       {
-        lcd.setCursor(0, 1);
-        lcd.print("No  ");
+        showValue(4, 1, number);
+        lcd.print(" ");
+        showValue(8, 1, channel + 1);
+        lcd.print(" ");
       }
-      showValue(4, 1, keyVelocity);
+      lcd.setCursor(12, 1);
+      if (ccLearn == 0)
+        lcd.print("Off ");
+      else if (ccLearn == 1)
+        lcd.print("On  ");
+      else
+        lcd.print("Clr ");
+    }
+    break;
+
+    case 15: // OSC1 - wavetable bank
+    case 25: // OSC2 - wavetable bank
+      lcd.setCursor(0, 0);
+      lcd.print("Wtb ");
+      lcd.print((wavetableFrames != 0) ? wavetableName : "None");
+      lcd.print("            ");
+      lcd.setCursor(0, 1);
+      lcd.print("    ");
+      lcd.print(wavetableChoiceName);
+      lcd.print("            ");
       break;
 
-    case 320: // SETTINGS TRIGGER MIDI
+    case 350: // SETTINGS TUNING
       lcd.setCursor(0, 0);
-      lcd.print("Trg Chn No. Note");
+      lcd.print("Now ");
+      lcd.print((tuningName[0] != 0) ? tuningName : "12-TET");
+      lcd.print("            ");
       lcd.setCursor(0, 1);
-      lcd.print("                ");
-      if (midiTriggerOut)
-      {
-        lcd.setCursor(0, 1);
-        lcd.print("Yes ");
-      }
-      else
+      lcd.print("    ");
+      lcd.print(tuningChoiceName);
+      lcd.print("            ");
+      break;
+
+    case 360: // SETTINGS DIAGNOSTICS
+      lcd.setCursor(0, 0);
+      lcd.print("Hit Mis Free Bt ");
+      lcd.setCursor(0, 1);
+      lcd.print(min(patchCacheHits, (uint32_t)999));
+      lcd.print("    ");
+      lcd.setCursor(4, 1);
+      lcd.print(min(patchCacheMisses, (uint32_t)999));
+      lcd.print("    ");
+      lcd.setCursor(8, 1);
+      lcd.print(freeMemory()); // bytes between the heap and the stack
+      lcd.print("     ");
+      lcd.setCursor(13, 1);
+      lcd.print(min(bootTime, 999UL)); // ms from reset to the end of setup()
+      lcd.print("   ");
+      break;
+
+    case 370: // SETTINGS SD TIMING - the last load and save in ms, through the file system and multi-block
+      for (byte i = 0; i < 2; i++)
       {
-        lcd.setCursor(0, 1);
-        lcd.print("No  ");
+        lcd.setCursor(0, i);
+        lcd.print(i == 0 ? "File" : "Blk ");
+        lcd.print(i == sdBlockIO ? ">" : " ");
+        lcd.print(sdLoadTime[i] / 1000.0, 1);
+        lcd.print("     ");
+        lcd.setCursor(11, i);
+        lcd.print(sdSaveTime[i] / 1000.0, 1);
+        lcd.print("     ");
       }
-      showValue(4, 1, midiTriggerChannel);
-      showValue(8, 1, editTrigger + 1);
-      showValue(12, 1, midiTrigger[editTrigger]);
       break;
 
-    case 330: // SETTINGS GENERAL
+    case 380: // SETTINGS SLOT STORE - the last and the slowest slot save in ms
       lcd.setCursor(0, 0);
-      lcd.print("Vol             ");
+      lcd.print("Slot Last  Worst");
       lcd.setCursor(0, 1);
-      lcd.print("                ");
-      showValue(0, 1, volume >> 2);
+      lcd.print(sdSlotStore ? "On   " : "Off  ");
+      lcd.print(slotSaveTime / 1000.0, 1);
+      lcd.print("      ");
+      lcd.setCursor(11, 1);
+      lcd.print(slotSaveWorst / 1000.0, 1);
+      lcd.print("     ");
       break;
     }
   }
 }
+
+int freeMemory()
+{
+  char top;
+  return &top - sbrk(0);
+}
 void arrow(byte x, byte y)
 {
   arrowAnimation = true;
@@ -6178,12 +7726,17 @@ void showTB2(byte x) // horizontal position
   lcd.write(7);
 }
 
-void showSequence() // displays the sequence currently being edited
+void showSequence() // displays the 16 steps around the one being edited
 {
   for (byte i = 0; i < 16; i++)
     showStep(i);
 }
 
+byte seqEditPage() // the first step on the display
+{
+  return seqEditStep - (seqEditStep % 16);
+}
+
 void seqBlinker()
 {
   if (menu == 210 && !seqRunning && doSeqBlink)
@@ -6192,25 +7745,30 @@ void seqBlinker()
     if (seqBlink != lastSeqBlink)
     {
       lastSeqBlink = seqBlink;
-      lcd.setCursor(seqEditStep, 0);
+      lcd.setCursor(seqEditStep % 16, 0);
       if (seqBlink)
         lcd.print(" ");
       else
-        showStep(seqEditStep);
+        showStep(seqEditStep % 16);
     }
   }
 }
 
-void showStep(byte Step)
+void showStep(byte Step) // the position on the display, on the edited step's page
 {
+  int patternStep = seqEditPage() + Step;
   lcd.setCursor(Step, 0);
-  if (seq[currentSeq].mute[Step])
+  if (patternStep >= seq[currentSeq].patternLength)
+    lcd.print(" ");
+  else if (seqFlag(currentSeq, patternStep, SEQ_MUTE))
     lcd.write(6);
-  else if (seq[currentSeq].tie[Step])
+  else if (seqFlag(currentSeq, patternStep, SEQ_TIE))
     lcd.write(7);
   //lcd.print((char)126); // forward arrow
-  else if (seq[currentSeq].voice[0][Step] == 255)
+  else if (seqNote(currentSeq, 0, patternStep) == 255)
     lcd.write(5);
+  else if (seqFlag(currentSeq, patternStep, SEQ_ACCENT))
+    lcd.print("*");
   else
     lcd.write(4);
 }
@@ -6232,12 +7790,12 @@ void clearLCD()
 void setVeloModulation(byte velocity)
 {
   if (velOsc1DetuneFactor != 0)
-    velOsc1Detune = (velocity * velOsc1DetuneFactor) << 6;
+    velOsc1Detune = (velocity * velOsc1DetuneFactor) >> 7; // in pitch units
   else
     velOsc1Detune = 0;
 
   if (velOsc2DetuneFactor != 0)
-    velOsc2Detune = (velocity * velOsc2DetuneFactor) << 6;
+    velOsc2Detune = (velocity * velOsc2DetuneFactor) >> 7;
   else
     velOsc2Detune = 0;
 
@@ -6256,6 +7814,11 @@ void setVeloModulation(byte velocity)
   else
     velPw = 0;
 
+  if (wavetableVelFactor != 0)
+    velWavetable = map(velocity, 0, 127, 0, wavetableVelFactor);
+  else
+    velWavetable = 0;
+
   if (velLfoRateFactor != 0)
     velLfoRate = constrain(lfoRate - map(velLfoRateFactor, 0, 1023, 0, velocity), 0, lfoRate);
   else
@@ -6302,3 +7865,118 @@ void createWaveShaper()
     }
   }
 }
+
+// WAVETABLE.ino
+boolean openWavetable(const char *name, SdFile *bank, waveFormat *format) // name without the extension, false if the bank can't be read
+{
+  char path[22];
+  sprintf(path, "/WTABLES/%s.WAV", name);
+  if (!bank->open(path, O_READ))
+    return false;
+  if (!readWaveFormat(bank, format))
+  {
+    bank->close();
+    return false;
+  }
+  return true;
+}
+
+boolean loadWavetable(const char *name) // a bank that can't be read leaves no bank loaded
+{
+  unloadWavetable();
+  if (!openWavetable(name, &wavetableFile, &wavetableFormat))
+    return false;
+  useWavetable(name);
+  return true;
+}
+
+void useWavetable(const char *name) // wavetableFile is open on the bank
+{
+  // frames of 2048 (Serum style), 600 (AKWF and the TB2's own) or 256 - otherwise the file is a single frame
+  static const uint16_t frameLengths[] = {2048, WAVE_SAMPLES, 256};
+  wavetableFrameLength = wavetableFormat.frames;
+  wavetableFrames = 1;
+  for (byte i = 0; i < 3; i++)
+  {
+    if (wavetableFormat.frames % frameLengths[i] == 0 && wavetableFormat.frames / frameLengths[i] >= 2)
+    {
+      wavetableFrameLength = frameLengths[i];
+      wavetableFrames = min(wavetableFormat.frames / frameLengths[i], (uint32_t)WAVETABLE_FRAMES);
+      break;
+    }
+  }
+  strncpy(wavetableName, name, 8);
+  wavetableName[8] = 0;
+}
+
+void unloadWavetable() // the oscillators keep playing the last blend
+{
+  if (wavetableFile.isOpen())
+    wavetableFile.close();
+  wavetableFrames = 0;
+  wavetableName[0] = 0;
+  for (byte i = 0; i < WAVETABLE_CACHE; i++)
+    wavetableCached[i] = -1;
+  lastWavetablePosition = -1;
+}
+
+const uint16_t *wavetableFrame(byte frame) // NULL if it had to be paged in - it's ready on the next pass
+{
+  byte oldest = 0;
+  for (byte i = 0; i < WAVETABLE_CACHE; i++)
+  {
+    if (wavetableCached[i] == frame)
+    {
+      wavetableUsed[i] = ++wavetableTicks;
+      return wavetableCache[i];
+    }
+    if (wavetableUsed[i] < wavetableUsed[oldest] || wavetableCached[i] < 0)
+      oldest = i;
+  }
+
+  waveFormat format = wavetableFormat;
+  format.dataStart += frame * wavetableFrameLength * format.channels * format.bytesPerSample;
+  format.frames = wavetableFrameLength;
+  wavetableCached[oldest] = -1;
+  if (resampleWave(&wavetableFile, &format, wavetableCache[oldest], sdScratch))
+  {
+    wavetableCached[oldest] = frame;
+    wavetableUsed[oldest] = ++wavetableTicks;
+  }
+  else
+    unloadWavetable(); // the card is gone
+  return NULL;
+}
+
+void updateWavetable() // at most one frame is read from the card per pass, so sweeping through a bank never stalls the loop for long
+{
+  if (wavetableFrames == 0 || (osc1WaveType != 9 && osc2WaveType != 9))
+    return;
+  int position = wavetablePosition + (((tmpLFO - 2048) * wavetableLfoFactor) >> 11) + ((envelopeVolume * wavetableEnvFactor) >> 10) + velWavetable;
+  position = constrain(position, 0, 1023);
+  if (position == lastWavetablePosition)
+    return;
+
+  uint32_t place = ((uint32_t)position * (wavetableFrames - 1) << 8) / 1023; // frames, 8 bits of fraction
+  byte frame = place >> 8;
+  int32_t fraction = place & 0xFF;
+  const uint16_t *from = wavetableFrame(frame);
+  if (from == NULL)
+    return;
+  const uint16_t *to = from;
+  if (fraction != 0)
+  {
+    to = wavetableFrame(frame + 1);
+    if (to == NULL)
+      return;
+  }
+  for (uint16_t i = 0; i < WAVE_SAMPLES; i++)
+    nWavetable[i] = from[i] + (((to[i] - from[i]) * fraction) >> 8);
+  lastWavetablePosition = position;
+}
+
+void getWavetableName(int choice) // the name of the choice-th .WAV in /WTABLES, without the extension
+{
+  if (choice == 0 || !getFolderFileName("/WTABLES", ".WAV", choice, wavetableChoiceName))
+    strcpy(wavetableChoiceName, "None");
+}
@@ -0,0 +1,221 @@
+// host test - replays contact bounce traces through the front-panel debounce, and held keys through the button events
+// run with: pio test -e native
+
+#include <unity.h>
+#include <TB2_Debounce.h>
+
+// a trace is the times in us at which a key's contact changes level, starting open
+// the bursts are typical of small tact switches: up to about 3 ms of chatter closing and 6 ms opening, inside DEBOUNCE
+const unsigned long chatterPress[] = {0, 180, 420, 510, 900, 1300, 2100, 2150, 2900};
+const unsigned long chatterRelease[] = {0, 1200, 1500, 180000, 180250, 180700, 181800, 183500, 184100, 186000};
+const unsigned long cleanTap[] = {0, 65000};
+const unsigned long shortTap[] = {0, 300, 700, 4000}; // let go inside the lockout
+
+typedef struct
+{
+  unsigned presses;
+  unsigned releases;
+  unsigned long firstPress;   // ms
+  unsigned long firstRelease; // ms
+} replayResult;
+
+uint16_t state;
+unsigned long edgeTime[16];
+
+void setUp(void)
+{
+  state = 0;
+  for (int i = 0; i < 16; i++)
+    edgeTime[i] = 0;
+}
+
+void tearDown(void)
+{
+}
+
+bool traceLevel(const unsigned long *edges, unsigned count, unsigned long us) // closed after an odd number of edges
+{
+  unsigned passed = 0;
+  for (unsigned i = 0; i < count; i++)
+  {
+    if (edges[i] <= us)
+      passed++;
+  }
+  return passed & 1;
+}
+
+// scan from start ms, every step ms (or an uneven mix of steps when step is 0), the trace on the given key
+replayResult replay(const unsigned long *edges, unsigned count, uint8_t key, unsigned long start, unsigned long step)
+{
+  const unsigned long uneven[] = {1, 3, 2, 1, 4, 1, 2};
+  replayResult result = {0, 0, 0, 0};
+  unsigned long end = start + edges[count - 1] / 1000 + 50;
+  unsigned n = 0;
+  for (unsigned long now = start; now < end; now += (step != 0) ? step : uneven[n++ % 7])
+  {
+    uint16_t raw = traceLevel(edges, count, (now - start) * 1000) ? (1 << key) : 0;
+    uint16_t changed = debounceKeys(raw, now, &state, edgeTime, 15);
+    TEST_ASSERT_EQUAL(0, changed & ~(1 << key)); // nothing on the other keys
+    if (changed & (1 << key))
+    {
+      if (state & (1 << key))
+      {
+        if (result.presses++ == 0)
+          result.firstPress = now - start;
+      }
+      else if (result.releases++ == 0)
+        result.firstRelease = now - start;
+    }
+  }
+  return result;
+}
+
+void test_chatter_on_press(void)
+{
+  replayResult r = replay(chatterPress, sizeof(chatterPress) / sizeof(chatterPress[0]), 3, 1000, 1);
+  TEST_ASSERT_EQUAL(1, r.presses);
+  TEST_ASSERT_EQUAL(0, r.releases); // the trace ends closed
+  TEST_ASSERT_EQUAL(0, r.firstPress); // reported on the first edge, not after the lockout
+}
+
+void test_chatter_on_release(void)
+{
+  replayResult r = replay(chatterRelease, sizeof(chatterRelease) / sizeof(chatterRelease[0]), 13, 1000, 1);
+  TEST_ASSERT_EQUAL(1, r.presses);
+  TEST_ASSERT_EQUAL(1, r.releases);
+  TEST_ASSERT_EQUAL(180, r.firstRelease);
+}
+
+void test_chatter_with_uneven_scans(void)
+{
+  replayResult r = replay(chatterRelease, sizeof(chatterRelease) / sizeof(chatterRelease[0]), 0, 1000, 0);
+  TEST_ASSERT_EQUAL(1, r.presses);
+  TEST_ASSERT_EQUAL(1, r.releases);
+  TEST_ASSERT_INT_WITHIN(4, 180, r.firstRelease); // the longest gap between scans
+}
+
+void test_clean_tap(void)
+{
+  replayResult r = replay(cleanTap, 2, 7, 1000, 1);
+  TEST_ASSERT_EQUAL(1, r.presses);
+  TEST_ASSERT_EQUAL(1, r.releases);
+  TEST_ASSERT_EQUAL(65, r.firstRelease);
+}
+
+void test_release_inside_lockout(void)
+{
+  // a tap shorter than the lockout still ends in a release, once the lockout is over
+  replayResult r = replay(shortTap, sizeof(shortTap) / sizeof(shortTap[0]), 14, 1000, 1);
+  TEST_ASSERT_EQUAL(1, r.presses);
+  TEST_ASSERT_EQUAL(1, r.releases);
+  TEST_ASSERT_EQUAL(DEBOUNCE, r.firstRelease);
+}
+
+void test_repeated_taps(void)
+{
+  for (int i = 0; i < 4; i++) // the key's last edge is long past by the next tap
+  {
+    replayResult r = replay(chatterRelease, sizeof(chatterRelease) / sizeof(chatterRelease[0]), 5, 1000 + i * 300, 1);
+    TEST_ASSERT_EQUAL(1, r.presses);
+    TEST_ASSERT_EQUAL(1, r.releases);
+  }
+}
+
+// the button events, as handlePresses() sees them: a chord or the chord key's repeat steps the value
+typedef struct
+{
+  uint8_t type;
+  uint8_t key;
+  uint8_t held;
+} heldEvent;
+
+heldEvent events[64];
+unsigned eventCount;
+buttonTimers timers;
+
+bool collect(uint8_t type, uint8_t key, uint8_t held, unsigned long time)
+{
+  if (eventCount < 64)
+    events[eventCount++] = {type, key, held};
+  return true;
+}
+
+void holdKeys(uint8_t first, uint8_t second, unsigned long until) // first down at 0 ms, second at 200 ms, both let go at until
+{
+  eventCount = 0;
+  timers = {0, 0, NO_SHIFT, {0}};
+  for (unsigned long now = 0; now < until + 50; now++)
+  {
+    uint16_t raw = 0;
+    if (now < until)
+      raw = (1 << first) | ((now >= 200) ? (1 << second) : 0);
+    uint16_t changed = debounceKeys(raw, now, &state, edgeTime, 15);
+    buttonEvents(state, changed, now, edgeTime, &timers, 15, collect);
+  }
+}
+
+int stepValue(int *steps) // what the fine adjust would do, counting the steps taken
+{
+  int value = 0;
+  *steps = 0;
+  for (unsigned i = 0; i < eventCount; i++)
+  {
+    heldEvent e = events[i];
+    if (e.type != BUTTON_CHORD && e.type != BUTTON_REPEAT)
+      continue;
+    int step = (e.key == SHIFT_ENTER && e.held == SHIFT_BACK) ? 1 : (e.key == SHIFT_BACK && e.held == SHIFT_ENTER) ? -1 : 0;
+    TEST_ASSERT_TRUE(step == 0 || *steps == 0 || (step > 0) == (value > 0)); // never turns round
+    value += step;
+    *steps += (step != 0);
+  }
+  return value;
+}
+
+void test_chord_steps_one_way(void)
+{
+  // hold back, press enter, hold both a second - only enter, the key that made the chord, repeats
+  holdKeys(SHIFT_BACK, SHIFT_ENTER, 1200);
+  int steps;
+  TEST_ASSERT_EQUAL(5, stepValue(&steps)); // the chord at 200 ms, long press at 700, then repeats at 800 - 1100
+  TEST_ASSERT_EQUAL(5, steps);
+  for (unsigned i = 0; i < eventCount; i++)
+  {
+    if (events[i].type == BUTTON_LONGPRESS || events[i].type == BUTTON_REPEAT)
+      TEST_ASSERT_EQUAL(SHIFT_ENTER, events[i].key);
+  }
+  TEST_ASSERT_EQUAL(NO_SHIFT, timers.chordKey);
+  TEST_ASSERT_EQUAL(0, timers.shifting);
+}
+
+void test_chord_steps_down(void)
+{
+  holdKeys(SHIFT_ENTER, SHIFT_BACK, 1200);
+  int steps;
+  TEST_ASSERT_EQUAL(-5, stepValue(&steps));
+  TEST_ASSERT_EQUAL(5, steps);
+}
+
+void test_long_press_without_chord(void)
+{
+  // one key held still long presses and repeats, the shift only goes quiet under a chord
+  holdKeys(SHIFT_BACK, SHIFT_BACK, 1000);
+  TEST_ASSERT_EQUAL(BUTTON_PRESS, events[0].type);
+  TEST_ASSERT_EQUAL(BUTTON_LONGPRESS, events[1].type);
+  TEST_ASSERT_EQUAL(BUTTON_REPEAT, events[2].type);
+  TEST_ASSERT_EQUAL(BUTTON_RELEASE, events[eventCount - 1].type);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_chatter_on_press);
+  RUN_TEST(test_chatter_on_release);
+  RUN_TEST(test_chatter_with_uneven_scans);
+  RUN_TEST(test_clean_tap);
+  RUN_TEST(test_release_inside_lockout);
+  RUN_TEST(test_repeated_taps);
+  RUN_TEST(test_chord_steps_one_way);
+  RUN_TEST(test_chord_steps_down);
+  RUN_TEST(test_long_press_without_chord);
+  return UNITY_END();
+}
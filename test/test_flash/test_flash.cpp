@@ -0,0 +1,192 @@
+// host test - the flash store's copies and records, over a page array standing in for bank 1
+// run with: pio test -e native
+
+#include <unity.h>
+#include <TB2_Flash.h>
+
+#define PAGES 40
+#define AREA_ROTATING 0
+#define AREA_SINGLE 1
+constexpr flashArea areas[2] = {{2, 3, 2}, {1, 1, 4}}; // 2 slots of 3 copies of 2 pages, then 1 slot of 1 copy of 4 pages
+static_assert(flashStoreBytes(areas, 2, 0) <= PAGES * FLASH_PAGE, "the test layout doesn't fit the page array");
+
+uint32_t memory[PAGES * FLASH_PAGE / 4];
+uint32_t page[FLASH_PAGE / 4];
+int pageWrites;
+int writesLeft; // the power goes after this many pages, -1 for never
+
+bool writePage(uint8_t *address, const uint32_t *data) // the controller's erase and write
+{
+  uint8_t *start = (uint8_t *)memory;
+  TEST_ASSERT_TRUE(address >= start && address + FLASH_PAGE <= start + sizeof(memory));
+  TEST_ASSERT_EQUAL(0, (address - start) % FLASH_PAGE);
+  if (writesLeft == 0)
+    return false;
+  if (writesLeft > 0)
+    writesLeft--;
+  memcpy(address, data, FLASH_PAGE);
+  pageWrites++;
+  return true;
+}
+
+const flashStore store = {(uint8_t *)memory, sizeof(memory), areas, 2, page, writePage};
+
+uint8_t data[4 * FLASH_PAGE];
+uint8_t readBack[4 * FLASH_PAGE];
+
+void setUp(void)
+{
+  memset(memory, 0xFF, sizeof(memory)); // erased
+  pageWrites = 0;
+  writesLeft = -1;
+}
+
+void tearDown(void)
+{
+}
+
+void fill(uint8_t seed, uint16_t count)
+{
+  for (uint16_t i = 0; i < count; i++)
+    data[i] = seed + i * 7;
+}
+
+uint8_t copyOf(const flashRecord *record, uint8_t area, uint8_t slot) // which copy a record is in
+{
+  return ((const uint8_t *)record - flashCopy(&store, area, slot, 0)) / ((areas[area].pages + 1) * FLASH_PAGE);
+}
+
+void test_layout(void)
+{
+  // packed down from the end, every copy apart from the others
+  TEST_ASSERT_TRUE(flashCopy(&store, AREA_SINGLE, 0, 0) + 5 * FLASH_PAGE == (uint8_t *)memory + sizeof(memory));
+  TEST_ASSERT_TRUE(flashCopy(&store, AREA_ROTATING, 1, 2) + 3 * FLASH_PAGE == flashCopy(&store, AREA_SINGLE, 0, 0));
+  TEST_ASSERT_TRUE(flashCopy(&store, AREA_ROTATING, 1, 0) == flashCopy(&store, AREA_ROTATING, 0, 2) + 3 * FLASH_PAGE);
+  TEST_ASSERT_TRUE(flashCopy(&store, AREA_ROTATING, 0, 0) >= (uint8_t *)memory);
+}
+
+void test_empty(void)
+{
+  TEST_ASSERT_NULL(findFlashRecord(&store, AREA_ROTATING, 0));
+  TEST_ASSERT_FALSE(readFlashRecord(&store, AREA_SINGLE, 0, readBack, 10));
+}
+
+void test_round_trip(void)
+{
+  fill(1, 700);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_SINGLE, 0, data, 700));
+  TEST_ASSERT_EQUAL(1 + 3 + 1, pageWrites); // the old header, 3 data pages and the new header
+  TEST_ASSERT_TRUE(readFlashRecord(&store, AREA_SINGLE, 0, readBack, 700));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(data, readBack, 700);
+  TEST_ASSERT_FALSE(writeFlashRecord(&store, AREA_SINGLE, 0, data, 4 * FLASH_PAGE + 1)); // more than the copy holds
+  TEST_ASSERT_NULL(findFlashRecord(&store, AREA_ROTATING, 0)); // nothing spilt into the next area
+}
+
+void test_rotation(void)
+{
+  // each save goes to the copy after the newest, round the 3 of them
+  for (uint8_t n = 0; n < 7; n++)
+  {
+    fill(n, 300);
+    TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 1, data, 300));
+    const flashRecord *newest = findFlashRecord(&store, AREA_ROTATING, 1);
+    TEST_ASSERT_NOT_NULL(newest);
+    TEST_ASSERT_EQUAL(n % 3, copyOf(newest, AREA_ROTATING, 1));
+    TEST_ASSERT_EQUAL(n + 1, newest->sequence);
+    TEST_ASSERT_TRUE(readFlashRecord(&store, AREA_ROTATING, 1, readBack, 300));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, readBack, 300);
+  }
+  TEST_ASSERT_NULL(findFlashRecord(&store, AREA_ROTATING, 0)); // the other slot is untouched
+}
+
+void test_sequence_wrap(void)
+{
+  fill(10, 100);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 100));
+  ((flashRecord *)flashCopy(&store, AREA_ROTATING, 0, 0))->sequence = 0xFFFFFFFD; // a long life of saves
+  const uint32_t expected[4] = {0xFFFFFFFE, 0, 1, 2}; // the erased value is stepped over
+  for (uint8_t n = 0; n < 4; n++)
+  {
+    fill(20 + n, 100);
+    TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 100));
+    const flashRecord *newest = findFlashRecord(&store, AREA_ROTATING, 0);
+    TEST_ASSERT_NOT_NULL(newest);
+    TEST_ASSERT_EQUAL_HEX32(expected[n], newest->sequence);
+    TEST_ASSERT_EQUAL((n + 1) % 3, copyOf(newest, AREA_ROTATING, 0));
+    TEST_ASSERT_TRUE(readFlashRecord(&store, AREA_ROTATING, 0, readBack, 100));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(data, readBack, 100);
+  }
+}
+
+void test_interrupted_write(void)
+{
+  fill(30, 400);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 400));
+  fill(40, 400);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 400));
+  fill(50, 400);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 400)); // all 3 copies hold a save
+  fill(60, 400);
+  writesLeft = 3; // the old header and both data pages go, the new header never does
+  TEST_ASSERT_FALSE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 400));
+  const flashRecord *newest = findFlashRecord(&store, AREA_ROTATING, 0);
+  TEST_ASSERT_NOT_NULL(newest);
+  TEST_ASSERT_EQUAL(3, newest->sequence);
+  fill(50, 400);
+  TEST_ASSERT_TRUE(readFlashRecord(&store, AREA_ROTATING, 0, readBack, 400));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(data, readBack, 400);
+  // the copy that was being written over has no header left to trust, not the oldest save's over the new data
+  TEST_ASSERT_EQUAL_HEX32(FLASH_ERASED, ((const flashRecord *)flashCopy(&store, AREA_ROTATING, 0, 0))->sequence);
+
+  writesLeft = -1; // the next save goes to the same copy again
+  fill(70, 400);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 400));
+  newest = findFlashRecord(&store, AREA_ROTATING, 0);
+  TEST_ASSERT_EQUAL(0, copyOf(newest, AREA_ROTATING, 0));
+  TEST_ASSERT_EQUAL(4, newest->sequence);
+}
+
+void test_write_in_passes(void)
+{
+  // the snapshot sync writes a page a pass - until its header is written the last whole copy is the one read
+  fill(80, 500);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 1, data, 500));
+  flashWriter flash;
+  TEST_ASSERT_TRUE(beginFlashRecord(&store, &flash, AREA_ROTATING, 1));
+  fill(90, 500);
+  for (uint16_t offset = 0; offset < 500; offset += FLASH_PAGE)
+  {
+    appendFlashBytes(&flash, data + offset, (500 - offset < FLASH_PAGE) ? 500 - offset : FLASH_PAGE);
+    TEST_ASSERT_EQUAL(1, findFlashRecord(&store, AREA_ROTATING, 1)->sequence);
+  }
+  TEST_ASSERT_TRUE(endFlashRecord(&flash));
+  TEST_ASSERT_EQUAL(2, findFlashRecord(&store, AREA_ROTATING, 1)->sequence);
+  TEST_ASSERT_TRUE(readFlashRecord(&store, AREA_ROTATING, 1, readBack, 500));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(data, readBack, 500);
+}
+
+void test_corrupt_copy(void)
+{
+  fill(100, 200);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 200));
+  fill(110, 200);
+  TEST_ASSERT_TRUE(writeFlashRecord(&store, AREA_ROTATING, 0, data, 200));
+  flashCopy(&store, AREA_ROTATING, 0, 1)[FLASH_PAGE + 5] ^= 1; // a bit of the newest fails
+  const flashRecord *newest = findFlashRecord(&store, AREA_ROTATING, 0);
+  TEST_ASSERT_NOT_NULL(newest);
+  TEST_ASSERT_EQUAL(1, newest->sequence);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_layout);
+  RUN_TEST(test_empty);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_rotation);
+  RUN_TEST(test_sequence_wrap);
+  RUN_TEST(test_interrupted_write);
+  RUN_TEST(test_write_in_passes);
+  RUN_TEST(test_corrupt_copy);
+  return UNITY_END();
+}
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Writes the patch fixtures test_patch.cpp reads - the same parameters and user waves as a legacy and a tagged file."""
+
+import os
+import struct
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PARAMS = 57
+SAMPLES = 600
+
+
+def params():
+    return [i * 37 - 500 for i in range(PARAMS)]
+
+
+def waves():
+    triangle = [1000 + i * 5 if i < 300 else 2500 - (i - 300) * 5 for i in range(SAMPLES)]
+    square = [0 if i < 300 else 4095 for i in range(SAMPLES)]
+    edges = [1000]  # every delta the packing has to tell apart: the largest either way, and -128, which is the escape
+    for i in range(1, SAMPLES):
+        edges.append(edges[-1] + (127, -128, 1, 0)[(i - 1) % 4])
+    return [triangle, square, edges]
+
+
+def pack_delta(wave):
+    out = struct.pack('<H', wave[0])
+    for previous, sample in zip(wave, wave[1:]):
+        delta = sample - previous
+        out += struct.pack('<b', delta) if -128 < delta < 128 else b'\x80' + struct.pack('<H', sample)
+    return out
+
+
+def record(tag, body):
+    return struct.pack('<BH', tag, len(body)) + body
+
+
+def write_legacy():
+    ints = params() + [12345] * (100 - PARAMS)  # the padding is read and dropped
+    for wave in waves():
+        ints += wave
+    with open(os.path.join(HERE, 'legacy.tb2'), 'wb') as out:
+        out.write(struct.pack('<1900i', *ints))
+
+
+def write_tagged():
+    triangle, square, edges = waves()
+    body = record(1, b''.join(struct.pack('<Bi', i, v) for i, v in enumerate(params())))
+    body += record(9, b'later!!')  # a record from a later format
+    body += record(2, bytes([0, 1]) + pack_delta(triangle))
+    body += record(2, bytes([1, 0]) + struct.pack('<600H', *square))
+    body += record(2, bytes([2, 1]) + pack_delta(edges))
+    header = b'TB2P' + struct.pack('<HHII', 2, 0, len(body), zlib.crc32(body) & 0xFFFFFFFF)
+    with open(os.path.join(HERE, 'tagged.tb2'), 'wb') as out:
+        out.write(header + body)
+
+
+write_legacy()
+write_tagged()
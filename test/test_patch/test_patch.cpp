@@ -0,0 +1,273 @@
+// host test - the tagged patch records and the legacy layout, written and read back in memory and from the fixtures in
+// test/test_patch/fixtures (made by make_fixtures.py)
+// run with: pio test -e native - from the project folder, where the fixture paths start
+
+#include <unity.h>
+#include <stdio.h>
+#include <TB2_Patch.h>
+
+#define FIXTURES "test/test_patch/fixtures/"
+
+// the fields the record reader and writer use, over a file held in memory
+struct memoryReader
+{
+  const uint8_t *data;
+  uint32_t size;
+  uint32_t at;
+  bool legacy;
+  uint32_t remaining;
+  uint32_t crc;
+  uint32_t expectedCrc;
+  uint32_t position;
+  bool failed;
+  uint16_t offset;
+  uint8_t used;
+  uint8_t filled;
+  uint8_t chunk[PATCH_CHUNK];
+  int *param;
+  uint16_t (*wave)[WAVE_SAMPLES];
+};
+
+struct memoryWriter
+{
+  uint8_t data[8192];
+  uint32_t size;
+  uint32_t length;
+  uint32_t crc;
+  bool ok;
+  uint8_t used;
+  uint8_t chunk[PATCH_CHUNK];
+};
+
+int fetchPatchBytes(memoryReader *r, uint8_t *data, uint16_t count)
+{
+  if (count > r->size - r->at)
+    count = r->size - r->at;
+  memcpy(data, r->data + r->at, count);
+  r->at += count;
+  return count;
+}
+
+bool putPatchBytes(memoryWriter *w, const uint8_t *data, uint16_t count)
+{
+  if (w->size + count > sizeof(w->data))
+    return false;
+  memcpy(w->data + w->size, data, count);
+  w->size += count;
+  return true;
+}
+
+uint8_t file[8192];
+uint32_t fileSize;
+memoryWriter writer;
+memoryReader reader;
+int param[PATCH_PARAMS];
+uint16_t wave[3][WAVE_SAMPLES];
+int expectedParam[PATCH_PARAMS];
+uint16_t expectedWave[3][WAVE_SAMPLES];
+
+void setUp(void) // the same patch as make_fixtures.py
+{
+  for (int i = 0; i < PATCH_PARAMS; i++)
+    expectedParam[i] = i * 37 - 500;
+  for (int i = 0; i < WAVE_SAMPLES; i++)
+  {
+    expectedWave[0][i] = (i < 300) ? 1000 + i * 5 : 2500 - (i - 300) * 5;
+    expectedWave[1][i] = (i < 300) ? 0 : 4095;
+  }
+  const int edges[4] = {127, -128, 1, 0}; // the largest deltas either way, and -128, which is the escape
+  expectedWave[2][0] = 1000;
+  for (int i = 1; i < WAVE_SAMPLES; i++)
+    expectedWave[2][i] = expectedWave[2][i - 1] + edges[(i - 1) % 4];
+  memset(param, 0, sizeof(param));
+  memset(wave, 0, sizeof(wave));
+  memset(&writer, 0, sizeof(writer));
+}
+
+void tearDown(void)
+{
+}
+
+void loadFixture(const char *name)
+{
+  char path[80];
+  sprintf(path, FIXTURES "%s", name);
+  FILE *f = fopen(path, "rb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path);
+  fileSize = fread(file, 1, sizeof(file), f);
+  fclose(f);
+}
+
+void openReader(uint32_t size) // the firmware's openPatchReader(), on the first size bytes of the file
+{
+  memset(&reader, 0, sizeof(reader));
+  reader.data = file;
+  reader.size = size;
+  reader.param = param;
+  reader.wave = wave;
+}
+
+int readPatch() // readPatchStep() to the end, as readPatch() does - 0 when it's all read
+{
+  int result = 1;
+  while (result == 1)
+    result = readPatchStep(&reader);
+  return result;
+}
+
+void writeRecords(bool unknown) // as writePatchRecords() lays them out, with a record from a later format if asked
+{
+  writer.crc = 0xFFFFFFFF;
+  writer.ok = true;
+  writer.size = sizeof(patchHeader); // filled in last, as on the card
+  uint16_t length = PATCH_PARAMS * 5;
+  uint8_t record[5] = {PATCH_TAG_PARAMS, (uint8_t)(length & 0xFF), (uint8_t)(length >> 8)};
+  writePatchBytes(&writer, record, 3);
+  for (uint8_t i = 0; i < PATCH_PARAMS; i++)
+  {
+    writePatchBytes(&writer, &i, 1);
+    writePatchBytes(&writer, &expectedParam[i], 4);
+  }
+  if (unknown)
+  {
+    const uint8_t later[] = {200, 4, 0, 1, 2, 3, 4};
+    writePatchBytes(&writer, later, sizeof(later));
+  }
+  for (uint8_t w = 0; w < 3; w++)
+  {
+    length = 2 + packWave<memoryWriter>(NULL, expectedWave[w]);
+    record[0] = PATCH_TAG_WAVE;
+    record[1] = length & 0xFF;
+    record[2] = length >> 8;
+    record[3] = w;
+    record[4] = PATCH_WAVE_DELTA;
+    writePatchBytes(&writer, record, 5);
+    packWave(&writer, expectedWave[w]);
+  }
+  patchHeader header;
+  fillPatchHeader(&writer, &header, "TB2P", PATCH_FORMAT);
+  memcpy(writer.data, &header, sizeof(header));
+  memcpy(file, writer.data, writer.size);
+  fileSize = writer.size;
+}
+
+void assertPatch()
+{
+  TEST_ASSERT_EQUAL_INT_ARRAY(expectedParam, param, PATCH_PARAMS);
+  for (int w = 0; w < 3; w++)
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(expectedWave[w], wave[w], WAVE_SAMPLES);
+}
+
+void test_crc(void)
+{
+  const char *check = "123456789"; // the standard CRC-32 check value
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926, crc32Update(0xFFFFFFFF, (const uint8_t *)check, 9) ^ 0xFFFFFFFF);
+}
+
+void test_round_trip(void)
+{
+  writeRecords(false);
+  TEST_ASSERT_TRUE(writer.ok);
+  TEST_ASSERT_EQUAL(fileSize - sizeof(patchHeader), writer.length);
+  openReader(fileSize);
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_EQUAL(0, readPatch());
+  assertPatch();
+}
+
+void test_delta_packing(void)
+{
+  // the first sample as 16 bits, then a byte a delta - a -128 delta is the escape and a 16 bit sample
+  TEST_ASSERT_EQUAL(2 + 599, packWave<memoryWriter>(NULL, expectedWave[0]));
+  TEST_ASSERT_EQUAL(2 + 598 + 3, packWave<memoryWriter>(NULL, expectedWave[1]));
+  TEST_ASSERT_EQUAL(2 + 449 + 150 * 3, packWave<memoryWriter>(NULL, expectedWave[2]));
+  writer.ok = true;
+  packWave(&writer, expectedWave[2]);
+  flushPatchWriter(&writer);
+  const uint8_t start[] = {0xE8, 0x03, 127, 0x80, 0xE7, 0x03, 1, 0, 127, 0x80};
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(start, writer.data, sizeof(start));
+}
+
+void test_unknown_tag(void)
+{
+  writeRecords(true);
+  openReader(fileSize);
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_EQUAL(0, readPatch());
+  assertPatch();
+}
+
+void test_truncated(void)
+{
+  writeRecords(false);
+  openReader(fileSize - 100); // the header says more than the file holds
+  TEST_ASSERT_FALSE(readPatchHeader(&reader, "TB2P", fileSize - 100));
+  openReader(fileSize - 100); // the card goes away part way through
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_EQUAL(-1, readPatch());
+  openReader(10); // not even a header
+  TEST_ASSERT_FALSE(readPatchHeader(&reader, "TB2P", 10));
+}
+
+void test_bad_crc(void)
+{
+  writeRecords(false);
+  file[fileSize - 50] ^= 0x10; // a sample in the last wave
+  openReader(fileSize);
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_EQUAL(-1, readPatch());
+  openReader(fileSize); // the bank loader checks first
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_FALSE(verifyPatchRecords(&reader));
+  openReader(fileSize);
+  TEST_ASSERT_FALSE(readPatchHeader(&reader, "TB2S", fileSize)); // a bank's magic
+}
+
+void test_tagged_fixture(void)
+{
+  // written by make_fixtures.py, not this code - a raw wave, two packed ones and a record from a later format
+  loadFixture("tagged.tb2");
+  openReader(fileSize);
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_TRUE(verifyPatchRecords(&reader));
+  openReader(fileSize);
+  TEST_ASSERT_TRUE(readPatchHeader(&reader, "TB2P", fileSize));
+  TEST_ASSERT_EQUAL(0, readPatch());
+  assertPatch();
+}
+
+void test_legacy_fixture(void)
+{
+  loadFixture("legacy.tb2");
+  TEST_ASSERT_EQUAL(PATCH_LEGACY_SIZE, fileSize);
+  openReader(fileSize);
+  TEST_ASSERT_FALSE(readPatchHeader(&reader, "TB2P", fileSize));
+  reader.legacy = true; // as openPatchReader() falls back, from the start of the file
+  reader.at = 0;
+  TEST_ASSERT_EQUAL(0, readPatch());
+  TEST_ASSERT_EQUAL(PATCH_LEGACY_SIZE / 4, reader.offset);
+  assertPatch();
+}
+
+void test_legacy_truncated(void)
+{
+  loadFixture("legacy.tb2");
+  openReader(4000);
+  reader.legacy = true;
+  TEST_ASSERT_EQUAL(-1, readPatch());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_crc);
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_delta_packing);
+  RUN_TEST(test_unknown_tag);
+  RUN_TEST(test_truncated);
+  RUN_TEST(test_bad_crc);
+  RUN_TEST(test_tagged_fixture);
+  RUN_TEST(test_legacy_fixture);
+  RUN_TEST(test_legacy_truncated);
+  return UNITY_END();
+}
@@ -0,0 +1,214 @@
+// host test - the pitch tables, and Scala scales and keyboard maps through to phase increments
+// run with: pio test -e native
+
+#include <unity.h>
+#include <TB2_Tuning.h>
+
+// feeds the parsers from a string, with SdFat's fgets(): up to size - 1 characters, the newline kept, 0 at the end
+struct textSource
+{
+  const char *text;
+  int fgets(char *line, int size)
+  {
+    int n = 0;
+    while (n < size - 1 && *text != 0)
+    {
+      line[n++] = *text++;
+      if (line[n - 1] == '\n')
+        break;
+    }
+    line[n] = 0;
+    return n;
+  }
+};
+
+// a 5 note just scale, with the keyboard map putting it on the white keys C D E G A
+const char justScale[] =
+    "! JUST5.SCL\r\n"
+    "!\r\n"
+    "Pentatonic just intonation\r\n"
+    " 5\r\n"
+    "!\r\n"
+    " 9/8\r\n"
+    " 5/4\r\n"
+    " 3/2\r\n"
+    " 5/3\r\n"
+    " 2/1\r\n";
+
+const char justMap[] =
+    "! JUST5.KBM\n"
+    "12\n"     // map size
+    "0\n"      // first note
+    "127\n"    // last note
+    "60\n"     // middle note, degree 0
+    "69\n"     // reference note
+    "440.0\n"  // reference frequency
+    "5\n"      // octave degree
+    "! the map\n"
+    "0\nx\n1\nx\n2\nx\nx\n3\nx\n4\nx\nx\n";
+
+const char equalCents[] =
+    "12-TET in cents\n"
+    "12\n"
+    "100.0\n200.0\n300.0\n400.0\n500.0\n600.0\n700.0\n800.0\n900.0\n1000.0\n1100.0\n1200.0\n";
+
+scaleTuning tuning;
+
+void setUp(void)
+{
+  resetScale(&tuning);
+}
+
+void tearDown(void)
+{
+}
+
+float incrementHz(uint32_t increment)
+{
+  return increment / TICKS_PER_CYCLE;
+}
+
+void loadJust(const char *map)
+{
+  textSource scale = {justScale};
+  TEST_ASSERT_TRUE(parseScale(scale, &tuning));
+  resetKeyboardMap(&tuning);
+  textSource keys = {map};
+  TEST_ASSERT_TRUE(parseKeyboardMap(keys, &tuning));
+  tuneReference(&tuning);
+}
+
+void test_equal_temperament_table(void)
+{
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 440.0, incrementHz(equalTemperament[69]));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 261.626, incrementHz(equalTemperament[60]));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 8.176, incrementHz(equalTemperament[0]));
+  TEST_ASSERT_UINT32_WITHIN(8, INCREMENT_CEILING, equalTemperament[127]);
+}
+
+void test_reset_is_equal_temperament(void)
+{
+  // the 12-TET scale rebuilds the constant table to within float rounding
+  tuneReference(&tuning);
+  for (int note = 0; note < MIDI_NOTES; note++)
+  {
+    uint32_t expected = equalTemperament[note];
+    TEST_ASSERT_UINT32_WITHIN(expected / 100000 + 2, expected, tuningIncrement(&tuning, note));
+  }
+}
+
+void test_note_cents_linear(void)
+{
+  float cents;
+  TEST_ASSERT_TRUE(noteCents(&tuning, 60, &cents));
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0, cents);
+  TEST_ASSERT_TRUE(noteCents(&tuning, 69, &cents));
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 900, cents);
+  TEST_ASSERT_TRUE(noteCents(&tuning, 47, &cents)); // below the middle note wraps into the period under it
+  TEST_ASSERT_FLOAT_WITHIN(0.001, -1300, cents);
+}
+
+void test_cents_scale(void)
+{
+  textSource scale = {equalCents};
+  TEST_ASSERT_TRUE(parseScale(scale, &tuning));
+  TEST_ASSERT_EQUAL(12, tuning.degrees);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 700, tuning.cents[7]);
+  resetKeyboardMap(&tuning);
+  tuneReference(&tuning);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 440.0, incrementHz(tuningIncrement(&tuning, 69)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 220.0, incrementHz(tuningIncrement(&tuning, 57)));
+}
+
+void test_scale_and_map(void)
+{
+  loadJust(justMap);
+  TEST_ASSERT_EQUAL(5, tuning.degrees);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 203.91, tuning.cents[1]); // 9/8
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 1200, tuning.cents[5]);
+
+  // A4 = 440 is degree 4, 5/3 above middle C - so C4 is 264Hz and the rest are just ratios of it
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 440.0, incrementHz(tuningIncrement(&tuning, 69)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 264.0, incrementHz(tuningIncrement(&tuning, 60)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 297.0, incrementHz(tuningIncrement(&tuning, 62)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 330.0, incrementHz(tuningIncrement(&tuning, 64)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 396.0, incrementHz(tuningIncrement(&tuning, 67)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 528.0, incrementHz(tuningIncrement(&tuning, 72)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 132.0, incrementHz(tuningIncrement(&tuning, 48)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 220.0, incrementHz(tuningIncrement(&tuning, 57)));
+}
+
+void test_unmapped_keys_are_silent(void)
+{
+  loadJust(justMap);
+  TEST_ASSERT_EQUAL(0, tuningIncrement(&tuning, 61));
+  TEST_ASSERT_EQUAL(0, tuningIncrement(&tuning, 66));
+  TEST_ASSERT_EQUAL(0, tuningIncrement(&tuning, 59));
+}
+
+void test_octave_degree_zero(void)
+{
+  // an octave degree of 0 falls back to the scale's period rather than repeating the map at one pitch
+  char map[sizeof(justMap)];
+  strcpy(map, justMap);
+  *strstr(map, "\n5\n") = 0;
+  strcat(map, "\n0\n");
+  strcat(map, strstr(justMap, "! the map"));
+  loadJust(map);
+  TEST_ASSERT_EQUAL(5, tuning.octaveDegree);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 528.0, incrementHz(tuningIncrement(&tuning, 72)));
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 132.0, incrementHz(tuningIncrement(&tuning, 48)));
+}
+
+void test_broken_scale(void)
+{
+  textSource tooMany = {"too many\n65\n"};
+  TEST_ASSERT_FALSE(parseScale(tooMany, &tuning));
+  textSource shortScale = {"short\n3\n9/8\n5/4\n"};
+  TEST_ASSERT_FALSE(parseScale(shortScale, &tuning));
+  textSource badRatio = {"bad\n1\n0/1\n"};
+  TEST_ASSERT_FALSE(parseScale(badRatio, &tuning));
+}
+
+void test_pitch_to_increment(void)
+{
+  uint32_t notes[MIDI_NOTES];
+  memcpy(notes, equalTemperament, sizeof(notes));
+  TEST_ASSERT_EQUAL(notes[69], pitchIncrement(notes, 69 * PITCH_SEMITONE));
+  // a quarter tone, then every sixteenth of a semitone against the exact ratio
+  TEST_ASSERT_FLOAT_WITHIN(0.02, 452.893, incrementHz(pitchIncrement(notes, 69 * PITCH_SEMITONE + 128)));
+  for (int fine = 0; fine < PITCH_SEMITONE; fine += 7)
+  {
+    float expected = 440.0 * pow(2.0, fine / 3072.0);
+    TEST_ASSERT_FLOAT_WITHIN(0.02, expected, incrementHz(pitchIncrement(notes, 69 * PITCH_SEMITONE + fine)));
+  }
+  TEST_ASSERT_EQUAL(notes[0], pitchIncrement(notes, -500)); // clamped to the table
+  TEST_ASSERT_TRUE(pitchIncrement(notes, 200 * PITCH_SEMITONE) <= INCREMENT_CEILING);
+}
+
+void test_pitch_through_a_scale(void)
+{
+  // the oscillators go through the retuned table, so a bend from a just key starts from the just pitch
+  loadJust(justMap);
+  uint32_t notes[MIDI_NOTES];
+  for (int note = 0; note < MIDI_NOTES; note++)
+    notes[note] = tuningIncrement(&tuning, note);
+  TEST_ASSERT_FLOAT_WITHIN(0.01, 264.0, incrementHz(pitchIncrement(notes, 60 * PITCH_SEMITONE)));
+  TEST_ASSERT_FLOAT_WITHIN(0.02, 264.0 * pow(2.0, 64 / 3072.0), incrementHz(pitchIncrement(notes, 60 * PITCH_SEMITONE + 64)));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_equal_temperament_table);
+  RUN_TEST(test_reset_is_equal_temperament);
+  RUN_TEST(test_note_cents_linear);
+  RUN_TEST(test_cents_scale);
+  RUN_TEST(test_scale_and_map);
+  RUN_TEST(test_unmapped_keys_are_silent);
+  RUN_TEST(test_octave_degree_zero);
+  RUN_TEST(test_broken_scale);
+  RUN_TEST(test_pitch_to_increment);
+  RUN_TEST(test_pitch_through_a_scale);
+  return UNITY_END();
+}
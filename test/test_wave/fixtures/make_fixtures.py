@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Writes the WAV fixtures test_wave.cpp reads - one cycle of a half scale sine in each layout."""
+
+import math
+import os
+import struct
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+GUID_TAIL = b'\x00\x00\x00\x00\x10\x00\x80\x00\x00\xaa\x00\x38\x9b\x71'  # KSDATAFORMAT_SUBTYPE_*, after the encoding
+
+
+def sine(frames):
+    return [0.5 * math.sin(2 * math.pi * i / frames) for i in range(frames)]
+
+
+def encode(value, encoding, width):
+    if encoding == 3:
+        return struct.pack('<f' if width == 4 else '<d', value)
+    if width == 1:
+        return bytes([int(round(128 + 127 * value))])
+    return int(round(value * ((1 << (8 * width - 1)) - 1))).to_bytes(width, 'little', signed=True)
+
+
+def chunk(name, body):
+    return name + struct.pack('<I', len(body)) + body + (b'\x00' if len(body) & 1 else b'')
+
+
+def write(name, samples, encoding=1, width=2, channels=(1.0,), extensible=False, order=('fmt ', 'data'), extra=()):
+    frames = b''.join(b''.join(encode(s * gain, encoding, width) for gain in channels) for s in samples)
+    count = len(channels)
+    fmt = struct.pack('<HHIIHH', 0xFFFE if extensible else encoding, count, 44100, 44100 * count * width, count * width, 8 * width)
+    if extensible:
+        fmt += struct.pack('<HHI', 22, 8 * width, 0) + struct.pack('<H', encoding) + GUID_TAIL
+    chunks = {'fmt ': chunk(b'fmt ', fmt), 'data': chunk(b'data', frames)}
+    body = b'WAVE' + b''.join(chunk(n, b) for n, b in extra) + b''.join(chunks[n] for n in order)
+    with open(os.path.join(HERE, name), 'wb') as out:
+        out.write(b'RIFF' + struct.pack('<I', len(body)) + body)
+
+
+write('pcm8.wav', sine(60), width=1)
+write('pcm16.wav', sine(60))
+write('pcm24_stereo.wav', sine(60), width=3, channels=(1.0, 0.0))  # the right channel is silent, so the mix is quarter scale
+write('pcm32.wav', sine(60), width=4)
+write('float32.wav', sine(60), encoding=3, width=4)
+write('float64_stereo.wav', sine(60), encoding=3, width=8, channels=(1.0, 1.0), extensible=True)
+write('extensible16_stereo.wav', sine(60), channels=(1.0, 1.0), extensible=True)
+write('chunk_order.wav', sine(60), order=('data', 'fmt '), extra=((b'LIST', b'INFOabc'),))  # an odd length chunk, then the data first
+write('long16.wav', sine(2400))
+write('adpcm.wav', [0.0] * 8, encoding=2)
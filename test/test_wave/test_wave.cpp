@@ -0,0 +1,225 @@
+// host test - the WAV reader and resampler, on the fixtures in test/test_wave/fixtures (made by make_fixtures.py)
+// run with: pio test -e native - from the project folder, where the fixture paths start
+
+#include <unity.h>
+#include <stdio.h>
+#include <TB2_Wave.h>
+
+#define FIXTURES "test/test_wave/fixtures/"
+
+// SdFat's file calls, on a file read into memory
+struct memorySource
+{
+  uint8_t data[65536];
+  uint32_t size;
+  uint32_t position;
+  int read(void *buffer, uint32_t count)
+  {
+    if (count > size - position)
+      count = size - position;
+    memcpy(buffer, data + position, count);
+    position += count;
+    return count;
+  }
+  bool seekSet(uint32_t to)
+  {
+    if (to > size)
+      return false;
+    position = to;
+    return true;
+  }
+  uint32_t curPosition()
+  {
+    return position;
+  }
+  uint32_t fileSize()
+  {
+    return size;
+  }
+};
+
+memorySource file;
+waveFormat format;
+uint16_t table[WAVE_SAMPLES];
+uint32_t scratch[WAVE_SCRATCH / 4];
+
+void setUp(void)
+{
+  memset(&format, 0, sizeof(format));
+  memset(table, 0, sizeof(table));
+}
+
+void tearDown(void)
+{
+}
+
+void loadFixture(const char *name)
+{
+  char path[80];
+  sprintf(path, FIXTURES "%s", name);
+  FILE *f = fopen(path, "rb");
+  TEST_ASSERT_NOT_NULL_MESSAGE(f, path);
+  file.size = fread(file.data, 1, sizeof(file.data), f);
+  file.position = 0;
+  fclose(f);
+}
+
+void makeWave(uint32_t frames, float amplitude) // a 16 bit mono cycle, too long for the fixtures
+{
+  const uint8_t header[] = {'R', 'I', 'F', 'F', 0, 0, 0, 0, 'W', 'A', 'V', 'E', 'f', 'm', 't', ' ', 16, 0, 0, 0,
+                            1, 0, 1, 0, 0x44, 0xAC, 0, 0, 0x88, 0x58, 1, 0, 2, 0, 16, 0, 'd', 'a', 't', 'a'};
+  memcpy(file.data, header, sizeof(header));
+  uint32_t bytes = frames * 2;
+  memcpy(file.data + sizeof(header), &bytes, 4);
+  for (uint32_t i = 0; i < frames; i++)
+  {
+    int16_t sample = 32767 * amplitude * sin(2 * PI * i / frames);
+    memcpy(file.data + sizeof(header) + 4 + i * 2, &sample, 2);
+  }
+  file.size = sizeof(header) + 4 + bytes;
+  file.position = 0;
+}
+
+void assertSine(float amplitude, int tolerance) // the table holds one cycle at the amplitude, 12 bit around 2048
+{
+  for (int i = 0; i < WAVE_SAMPLES; i++)
+    TEST_ASSERT_INT_WITHIN(tolerance, 2048 + (int)(2047.94 * amplitude * sin(2 * PI * i / WAVE_SAMPLES)), table[i]);
+}
+
+void checkFixture(const char *name, uint16_t encoding, uint16_t channels, uint16_t bytesPerSample, float amplitude)
+{
+  loadFixture(name);
+  TEST_ASSERT_TRUE_MESSAGE(readWaveFormat(&file, &format), name);
+  TEST_ASSERT_EQUAL(encoding, format.encoding);
+  TEST_ASSERT_EQUAL(channels, format.channels);
+  TEST_ASSERT_EQUAL(bytesPerSample, format.bytesPerSample);
+  TEST_ASSERT_EQUAL(60, format.frames);
+  TEST_ASSERT_TRUE(resampleWave(&file, &format, table, scratch));
+  assertSine(amplitude, (bytesPerSample == 1) ? 16 : 3); // 8 bit samples are 16 steps of the 12 bit table
+}
+
+void test_pcm8(void)
+{
+  checkFixture("pcm8.wav", WAVE_PCM, 1, 1, 0.5);
+}
+
+void test_pcm16(void)
+{
+  checkFixture("pcm16.wav", WAVE_PCM, 1, 2, 0.5);
+}
+
+void test_pcm24_stereo(void)
+{
+  checkFixture("pcm24_stereo.wav", WAVE_PCM, 2, 3, 0.25); // mixed with a silent right channel
+}
+
+void test_pcm32(void)
+{
+  checkFixture("pcm32.wav", WAVE_PCM, 1, 4, 0.5);
+}
+
+void test_float32(void)
+{
+  checkFixture("float32.wav", WAVE_FLOAT, 1, 4, 0.5);
+}
+
+void test_float64_extensible(void)
+{
+  checkFixture("float64_stereo.wav", WAVE_FLOAT, 2, 8, 0.5);
+}
+
+void test_pcm16_extensible(void)
+{
+  checkFixture("extensible16_stereo.wav", WAVE_PCM, 2, 2, 0.5);
+}
+
+void test_chunk_order(void)
+{
+  // an odd length chunk with its pad byte, then "data" before "fmt "
+  checkFixture("chunk_order.wav", WAVE_PCM, 1, 2, 0.5);
+}
+
+void test_decimate(void)
+{
+  loadFixture("long16.wav");
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  TEST_ASSERT_EQUAL(2400, format.frames);
+  TEST_ASSERT_TRUE(resampleWave(&file, &format, table, scratch));
+  assertSine(0.5, 3);
+}
+
+void test_long_cycle(void)
+{
+  // a second of audio is box averaged down before the kernel, so the window still holds its reach
+  makeWave(30000, 0.5);
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  TEST_ASSERT_EQUAL(30000, format.frames);
+  TEST_ASSERT_TRUE(resampleWave(&file, &format, table, scratch));
+  assertSine(0.5, 3);
+}
+
+void test_short_cycle(void)
+{
+  // fewer frames than the kernel reaches, so the window wraps around the cycle more than once
+  makeWave(3, 0.5);
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  TEST_ASSERT_TRUE(resampleWave(&file, &format, table, scratch));
+  for (int i = 0; i < WAVE_SAMPLES; i++)
+    TEST_ASSERT_TRUE(table[i] > 900 && table[i] < 3200);
+}
+
+void test_frame_window(void)
+{
+  // a wavetable frame is a slice of the data, as wavetableFrame() pages them in
+  makeWave(1200, 0.5);
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  format.dataStart += 300 * 2;
+  format.frames = 600;
+  TEST_ASSERT_TRUE(resampleWave(&file, &format, table, scratch));
+  for (int i = 0; i < WAVE_SAMPLES; i++)
+    TEST_ASSERT_INT_WITHIN(3, 2048 + (int)(2047.94 * 0.5 * sin(2 * PI * (i + 300) / 1200)), table[i]);
+}
+
+void test_rejected(void)
+{
+  loadFixture("adpcm.wav");
+  TEST_ASSERT_FALSE(readWaveFormat(&file, &format));
+  loadFixture("pcm16.wav");
+  file.data[0] = 'X';
+  TEST_ASSERT_FALSE(readWaveFormat(&file, &format));
+  loadFixture("pcm16.wav");
+  file.size = 44; // the header, but not a frame of data
+  TEST_ASSERT_FALSE(readWaveFormat(&file, &format));
+  loadFixture("pcm16.wav");
+  file.size = 44 + 30; // cut short, the frames that are there still load
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  TEST_ASSERT_EQUAL(15, format.frames);
+}
+
+void test_truncated_read(void)
+{
+  loadFixture("pcm16.wav");
+  TEST_ASSERT_TRUE(readWaveFormat(&file, &format));
+  file.size -= 20; // the card goes away under the resampler
+  TEST_ASSERT_FALSE(resampleWave(&file, &format, table, scratch));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_pcm8);
+  RUN_TEST(test_pcm16);
+  RUN_TEST(test_pcm24_stereo);
+  RUN_TEST(test_pcm32);
+  RUN_TEST(test_float32);
+  RUN_TEST(test_float64_extensible);
+  RUN_TEST(test_pcm16_extensible);
+  RUN_TEST(test_chunk_order);
+  RUN_TEST(test_decimate);
+  RUN_TEST(test_long_cycle);
+  RUN_TEST(test_short_cycle);
+  RUN_TEST(test_frame_window);
+  RUN_TEST(test_rejected);
+  RUN_TEST(test_truncated_read);
+  return UNITY_END();
+}
@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""Build include/factoryWaves.h, the factory wave library compiled into flash.
+
+    python3 tools/wav2tb2.py AKWF_folder [more folders or .wav files] -o include/factoryWaves.h
+    python3 tools/wav2tb2.py --additive -o include/factoryWaves.h
+
+Every WAV is a single cycle (AKWF waves are 600 samples, the TB2's table size). Other lengths are
+resampled. The RIFF chunks are walked by hand, in any order, so plain and EXTENSIBLE files of 8 to 32
+bit integer or 32/64 bit float samples all read; up to 8 channels are mixed down to mono. These are
+the rules of readWaveFormat() in lib/TB2_Wave, so a file that works here loads as a user wave too.
+Samples are stored as unsigned 8 bits, 128 = silence - the oscillators read them straight from flash
+and shift them up to 12 bits. The name shown on the LCD is the first 8 characters of the file name,
+without any "AKWF_" prefix.
+
+Each wave costs 600 bytes of flash, and the whole sketch has to stay in flash bank 0 - flash_store.ld
+fails the link if it doesn't. --additive makes the set shipped with the firmware, built from harmonic
+recipes.
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+WAVE_SAMPLES = 600
+NAME_LENGTH = 8
+
+
+WAVE_PCM = 1
+WAVE_FLOAT = 3
+WAVE_EXTENSIBLE = 0xFFFE
+
+
+def read_chunks(path):
+    """The "fmt " and "data" chunks, whatever else comes before, between or after them."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < 12 or data[0:4] != b'RIFF' or data[8:12] != b'WAVE':
+        raise ValueError('%s: not a WAV file' % path)
+    chunks = {}
+    position = 12
+    while position + 8 <= len(data) and not (b'fmt ' in chunks and b'data' in chunks):
+        name = data[position:position + 4]
+        size = struct.unpack('<I', data[position + 4:position + 8])[0]
+        chunks.setdefault(name, data[position + 8:position + 8 + size])  # a short last chunk keeps what is there
+        position += 8 + size + (size & 1)  # chunks are padded to an even length
+    if b'fmt ' not in chunks or b'data' not in chunks:
+        raise ValueError('%s: no format or no data' % path)
+    return chunks[b'fmt '], chunks[b'data']
+
+
+def read_wav(path):
+    fmt, frames = read_chunks(path)
+    if len(fmt) < 16:
+        raise ValueError('%s: short format chunk' % path)
+    encoding, channels, _, _, block_align, bits = struct.unpack('<HHIIHH', fmt[:16])
+    if encoding == WAVE_EXTENSIBLE:
+        if len(fmt) < 26:
+            raise ValueError('%s: short extensible format' % path)
+        encoding = struct.unpack('<H', fmt[24:26])[0]  # the first two bytes of the sub-format GUID
+    if channels < 1 or channels > 8 or block_align % channels != 0:
+        raise ValueError('%s: %d channels in %d byte frames' % (path, channels, block_align))
+    width = block_align // channels  # block align, so 20 bit in 3 bytes works too
+    if encoding == WAVE_FLOAT and width in (4, 8):
+        unpack = struct.Struct('<f' if width == 4 else '<d').unpack_from
+        decode = lambda frame, offset: unpack(frame, offset)[0]
+    elif encoding == WAVE_PCM and width == 1:
+        decode = lambda frame, offset: (frame[offset] - 128) / 128.0  # 8 bit is unsigned
+    elif encoding == WAVE_PCM and 2 <= width <= 4:
+        scale = float(1 << (8 * width - 1))
+        decode = lambda frame, offset: int.from_bytes(frame[offset:offset + width], 'little', signed=True) / scale
+    else:
+        raise ValueError('%s: %d bit samples, encoding %d' % (path, bits, encoding))
+    samples = []
+    for start in range(0, len(frames) - block_align + 1, block_align):  # mixed down to mono
+        samples.append(sum(decode(frames, start + c * width) for c in range(channels)) / channels)
+    if not samples:
+        raise ValueError('%s: no samples' % path)
+    return samples
+
+
+def resample(samples):
+    if len(samples) == WAVE_SAMPLES:
+        return samples
+    out = []
+    for i in range(WAVE_SAMPLES):  # linear, around the cycle
+        position = i * len(samples) / WAVE_SAMPLES
+        index = int(position)
+        fraction = position - index
+        a = samples[index % len(samples)]
+        b = samples[(index + 1) % len(samples)]
+        out.append(a + (b - a) * fraction)
+    return out
+
+
+def to_bytes(samples, normalise=False):
+    peak = max(abs(s) for s in samples) if normalise else 1.0
+    if peak == 0:
+        peak = 1.0
+    return [max(0, min(255, int(round(128 + 127 * s / peak)))) for s in samples]
+
+
+def wave_name(path):
+    name = os.path.splitext(os.path.basename(path))[0]
+    if name.upper().startswith('AKWF_'):
+        name = name[5:]
+    return name.upper()[:NAME_LENGTH]
+
+
+def collect(paths):
+    files = []
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in sorted(os.walk(path)):
+                files += [os.path.join(root, n) for n in sorted(names) if n.lower().endswith('.wav')]
+        else:
+            files.append(path)
+    return files
+
+
+def harmonics(amplitudes, phase=0.0):
+    return [sum(a * math.sin(2 * math.pi * (n + 1) * i / WAVE_SAMPLES + phase * n) for n, a in enumerate(amplitudes))
+            for i in range(WAVE_SAMPLES)]
+
+
+def additive():
+    """The shipped set - 8 families of 8."""
+    waves = []
+    for n in (2, 3, 4, 6, 8, 12, 16, 24):  # band limited saws
+        waves.append(('SAW %d' % n, harmonics([1.0 / k for k in range(1, n + 1)])))
+    for n in (3, 5, 7, 9, 13, 17, 25, 33):  # band limited squares
+        waves.append(('SQR %d' % n, harmonics([(1.0 / k if k % 2 else 0) for k in range(1, n + 1)])))
+    for width in (5, 10, 15, 20, 25, 30, 35, 40):  # band limited pulses, in percent
+        waves.append(('PUL %d' % width, harmonics([math.sin(math.pi * k * width / 100.0) / k for k in range(1, 33)], math.pi / 2)))
+    drawbars = ((8, 8, 8, 0, 0, 0, 0, 0, 0), (8, 8, 0, 8, 0, 0, 0, 0, 8), (6, 8, 8, 6, 0, 0, 0, 0, 0), (8, 0, 8, 0, 0, 0, 0, 0, 8),
+                (8, 8, 8, 8, 8, 8, 8, 8, 8), (0, 0, 8, 8, 8, 0, 0, 0, 0), (8, 6, 8, 0, 0, 0, 4, 0, 0), (8, 8, 6, 8, 0, 5, 0, 3, 6))
+    for number, bars in enumerate(drawbars):  # tonewheel registrations - 16', 5 1/3', 8', 4', 2 2/3', 2', 1 3/5', 1 1/3', 1'
+        ratios = (1, 3, 2, 4, 6, 8, 10, 12, 16)
+        amplitudes = [0.0] * 16
+        for bar, ratio in zip(bars, ratios):
+            amplitudes[ratio - 1] += bar / 8.0
+        waves.append(('ORGAN %d' % (number + 1), harmonics(amplitudes)))
+    for centre in (2, 3, 4, 6, 8, 10, 12, 16):  # a formant around one harmonic
+        waves.append(('FORM %d' % centre, harmonics([math.exp(-((k - centre) / 1.5) ** 2) + 0.3 / k for k in range(1, 33)])))
+    for ratio in (1.5, 2, 2.5, 3, 3.5, 4, 5, 6):  # a hard synced sine
+        waves.append(('SYNC %g' % ratio, [math.sin(2 * math.pi * ratio * i / WAVE_SAMPLES) for i in range(WAVE_SAMPLES)]))
+    for modulator, index in ((1, 1), (1, 3), (2, 1), (2, 3), (3, 2), (4, 2), (5, 1.5), (7, 1)):  # two operator FM
+        waves.append(('FM %d %g' % (modulator, index), [math.sin(2 * math.pi * i / WAVE_SAMPLES + index * math.sin(2 * math.pi * modulator * i / WAVE_SAMPLES))
+                                                          for i in range(WAVE_SAMPLES)]))
+    for gain in (1.5, 2, 3, 4, 5, 6, 8, 10):  # a wavefolded sine
+        waves.append(('FOLD %g' % gain, [math.sin(gain * math.sin(2 * math.pi * i / WAVE_SAMPLES)) for i in range(WAVE_SAMPLES)]))
+    return [(name[:NAME_LENGTH], to_bytes(samples, True)) for name, samples in waves]
+
+
+def write_header(waves, path, source):
+    with open(path, 'w') as out:
+        out.write('// the factory wave library - made by tools/wav2tb2.py from %s, don\'t edit\n' % source)
+        out.write('// %d single cycle waves of %d unsigned 8 bit samples, 128 is silence\n' % (len(waves), WAVE_SAMPLES))
+        out.write('#define FACTORY_WAVES %d\n' % len(waves))
+        out.write('const char factoryWaveNames[FACTORY_WAVES][%d] = {\n' % (NAME_LENGTH + 1))
+        for name, _ in waves:
+            out.write('    "%s",\n' % name.replace('\\', '').replace('"', ''))
+        out.write('};\n')
+        out.write('const uint8_t factoryWaves[FACTORY_WAVES][%d] = {\n' % WAVE_SAMPLES)
+        for name, samples in waves:
+            out.write('    {// %s\n' % name)
+            for start in range(0, WAVE_SAMPLES, 24):
+                out.write('     ' + ''.join('%d,' % s for s in samples[start:start + 24]) + '\n')
+            out.write('    },\n')
+        out.write('};\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert single cycle WAVs to the TB2 factory wave library.')
+    parser.add_argument('inputs', nargs='*', help='WAV files, or folders searched for them')
+    parser.add_argument('-o', '--output', default=os.path.join(os.path.dirname(__file__), '..', 'include', 'factoryWaves.h'))
+    parser.add_argument('--additive', action='store_true', help='build the shipped set instead of reading WAVs')
+    parser.add_argument('--normalise', action='store_true', help='scale every wave to full range')
+    parser.add_argument('--limit', type=int, default=255, help='at most this many waves (the index is a byte)')
+    args = parser.parse_args()
+
+    if args.additive:
+        waves = additive()
+        source = 'harmonic recipes (--additive)'
+    else:
+        files = collect(args.inputs)
+        if not files:
+            parser.error('no WAV files given')
+        waves = []
+        for path in files[:args.limit]:
+            try:
+                waves.append((wave_name(path), to_bytes(resample(read_wav(path)), args.normalise)))
+            except ValueError as error:
+                print('skipped %s' % error, file=sys.stderr)
+        source = ', '.join(os.path.basename(os.path.normpath(p)) for p in args.inputs)
+    waves = waves[:args.limit]
+    write_header(waves, args.output, source)
+    print('%d waves, %d bytes of flash' % (len(waves), len(waves) * WAVE_SAMPLES))
+
+
+if __name__ == '__main__':
+    main()